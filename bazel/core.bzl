@@ -136,6 +136,10 @@ MLN_CORE_SOURCE = [
     "src/mbgl/geometry/dem_data.hpp",
     "src/mbgl/geometry/feature_index.cpp",
     "src/mbgl/geometry/feature_index.hpp",
+    "src/mbgl/geometry/heatmap_density.cpp",
+    "src/mbgl/geometry/heatmap_density.hpp",
+    "src/mbgl/geometry/hillshade_prepare.cpp",
+    "src/mbgl/geometry/hillshade_prepare.hpp",
     "src/mbgl/geometry/line_atlas.cpp",
     "src/mbgl/geometry/line_atlas.hpp",
     "src/mbgl/gfx/attribute.cpp",
@@ -145,14 +149,19 @@ MLN_CORE_SOURCE = [
     "src/mbgl/gfx/index_buffer.hpp",
     "src/mbgl/gfx/index_vector.hpp",
     "src/mbgl/gfx/offscreen_texture.hpp",
+    "src/mbgl/gfx/polygon_triangulation.cpp",
     "src/mbgl/gfx/polyline_generator.cpp",
     "src/mbgl/gfx/render_pass.hpp",
     "src/mbgl/gfx/renderer_backend.cpp",
     "src/mbgl/gfx/rendering_stats.cpp",
     "src/mbgl/gfx/shader_registry.cpp",
     "src/mbgl/gfx/shader_group.cpp",
+    "src/mbgl/gfx/shared_mesh_registry.cpp",
     "src/mbgl/gfx/uniform.hpp",
+    "src/mbgl/gfx/upload_pass.cpp",
     "src/mbgl/gfx/upload_pass.hpp",
+    "src/mbgl/gfx/vector_pool.cpp",
+    "src/mbgl/gfx/vector_pool.hpp",
     "src/mbgl/gfx/vertex_vector.hpp",
     "src/mbgl/layermanager/background_layer_factory.cpp",
     "src/mbgl/layermanager/circle_layer_factory.cpp",
@@ -273,6 +282,8 @@ MLN_CORE_SOURCE = [
     "src/mbgl/renderer/renderer_impl.cpp",
     "src/mbgl/renderer/renderer_impl.hpp",
     "src/mbgl/renderer/renderer_state.cpp",
+    "src/mbgl/renderer/shader_warm_up.cpp",
+    "src/mbgl/renderer/shader_warm_up.hpp",
     "src/mbgl/renderer/sources/render_custom_geometry_source.cpp",
     "src/mbgl/renderer/sources/render_custom_geometry_source.hpp",
     "src/mbgl/renderer/sources/render_geojson_source.cpp",
@@ -525,6 +536,7 @@ MLN_CORE_SOURCE = [
     "src/mbgl/util/bounding_volumes.cpp",
     "src/mbgl/util/chrono.cpp",
     "src/mbgl/util/client_options.cpp",
+    "src/mbgl/util/compressed_image.cpp",
     "src/mbgl/util/constants.cpp",
     "src/mbgl/util/convert.cpp",
     "src/mbgl/util/event.cpp",
@@ -543,6 +555,8 @@ MLN_CORE_SOURCE = [
     "src/mbgl/util/i18n.cpp",
     "src/mbgl/util/i18n.hpp",
     "src/mbgl/util/identity.cpp",
+    "src/mbgl/util/image_pool.cpp",
+    "src/mbgl/util/image_pool.hpp",
     "src/mbgl/util/interpolate.cpp",
     "src/mbgl/util/intersection_tests.cpp",
     "src/mbgl/util/intersection_tests.hpp",
@@ -561,6 +575,8 @@ MLN_CORE_SOURCE = [
     "src/mbgl/util/mat4.hpp",
     "src/mbgl/util/math.hpp",
     "src/mbgl/util/padding.cpp",
+    "src/mbgl/util/parallel_for.cpp",
+    "src/mbgl/util/parallel_for.hpp",
     "src/mbgl/util/premultiply.cpp",
     "src/mbgl/util/quaternion.cpp",
     "src/mbgl/util/quaternion.hpp",
@@ -622,6 +638,7 @@ MLN_CORE_HEADERS = [
     "include/mbgl/gfx/draw_scope.hpp",
     "include/mbgl/gfx/fill_generator.hpp",
     "include/mbgl/gfx/gfx_types.hpp",
+    "include/mbgl/gfx/polygon_triangulation.hpp",
     "include/mbgl/gfx/polyline_generator.hpp",
     "include/mbgl/gfx/renderbuffer.hpp",
     "include/mbgl/gfx/renderable.hpp",
@@ -630,6 +647,7 @@ MLN_CORE_HEADERS = [
     "include/mbgl/gfx/shader_registry.hpp",
     "include/mbgl/gfx/shader_group.hpp",
     "include/mbgl/gfx/shader.hpp",
+    "include/mbgl/gfx/shared_mesh_registry.hpp",
     "include/mbgl/gfx/stencil_mode.hpp",
     "include/mbgl/gfx/types.hpp",
     "include/mbgl/gfx/vertex_buffer.hpp",
@@ -780,6 +798,7 @@ MLN_CORE_HEADERS = [
     "include/mbgl/util/chrono.hpp",
     "include/mbgl/util/client_options.hpp",
     "include/mbgl/util/color.hpp",
+    "include/mbgl/util/compressed_image.hpp",
     "include/mbgl/util/compression.hpp",
     "include/mbgl/util/constants.hpp",
     "include/mbgl/util/containers.hpp",
@@ -836,6 +855,7 @@ MLN_CORE_HEADERS = [
 MLN_OPENGL_SOURCE = [
     "src/mbgl/gl/attribute.cpp",
     "src/mbgl/gl/attribute.hpp",
+    "src/mbgl/gl/buffer_storage_extension.hpp",
     "src/mbgl/gl/command_encoder.cpp",
     "src/mbgl/gl/command_encoder.hpp",
     "src/mbgl/gl/context.cpp",
@@ -900,6 +920,7 @@ MLN_DRAWABLES_SOURCE = [
     "src/mbgl/gfx/drawable_custom_layer_host_tweaker.cpp",
     "src/mbgl/gfx/dynamic_texture.cpp",
     "src/mbgl/gfx/dynamic_texture_atlas.cpp",
+    "src/mbgl/gfx/fill_extrusion_drawable_data.hpp",
     "src/mbgl/gfx/gpu_expression.cpp",
     "src/mbgl/gfx/hillshade_prepare_drawable_data.hpp",
     "src/mbgl/gfx/image_drawable_data.hpp",
@@ -8,6 +8,7 @@
 #include <mbgl/storage/network_status.hpp>
 #include <mbgl/storage/resource_options.hpp>
 #include <mbgl/style/image.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
 #include <mbgl/style/layers/symbol_layer.hpp>
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/style/style.hpp>
@@ -15,6 +16,7 @@
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#include <algorithm>
 #include <sstream>
 #include <optional>
 
@@ -41,6 +43,121 @@ void prepare(Map& map, std::optional<std::string> json = std::nullopt) {
     map.getStyle().addImage(std::make_unique<style::Image>("test-icon", std::move(image), 1.0f));
 }
 
+// Counts the frames that compiled shaders while rendering, rather than ahead of time
+class ShaderHitchObserver : public MapObserver {
+public:
+    void onWillStartRenderingFrame() override {
+        inFrame = true;
+        compiledInFrame = 0;
+    }
+
+    void onPostCompileShader(shaders::BuiltIn, gfx::Backend::Type, const std::string&) override {
+        if (inFrame) {
+            compiledInFrame++;
+        }
+    }
+
+    void onDidFinishRenderingFrame(const RenderFrameStatus& status) override {
+        inFrame = false;
+        if (compiledInFrame > 0) {
+            hitchFrames++;
+        }
+        fullyRendered = status.mode == RenderMode::Full;
+    }
+
+    bool inFrame = false;
+    bool fullyRendered = false;
+    std::size_t compiledInFrame = 0;
+    std::size_t hitchFrames = 0;
+};
+
+// Render a new map frame by frame until everything in the style has appeared
+void renderFirstAppearance(::benchmark::State& state, bool warmUp) {
+    constexpr std::size_t maxFrames = 1000;
+    RenderBenchmark bench;
+    std::size_t hitchFrames = 0;
+    double slowestFrame = 0.0;
+
+    for (auto _ : state) {
+        ShaderHitchObserver observer;
+        HeadlessFrontend frontend{size,
+                                  pixelRatio,
+                                  gfx::HeadlessBackend::SwapBehaviour::NoFlush,
+                                  gfx::ContextMode::Unique,
+                                  std::nullopt,
+                                  /*invalidateOnUpdate=*/false};
+        Map map{frontend,
+                observer,
+                MapOptions().withMapMode(MapMode::Continuous).withSize(size).withPixelRatio(pixelRatio),
+                ResourceOptions().withCachePath(cachePath).withApiKey("foobar")};
+        prepare(map);
+
+        if (warmUp) {
+            frontend.warmUpShaders();
+        }
+
+        for (std::size_t frame = 0; !observer.fullyRendered && frame < maxFrames; ++frame) {
+            frontend.renderFrame();
+            slowestFrame = std::max(slowestFrame, frontend.getFrameTime());
+            if (!observer.fullyRendered) {
+                bench.loop.runOnce();
+            }
+        }
+        hitchFrames += observer.hitchFrames;
+    }
+
+    state.counters["hitch_frames"] = ::benchmark::Counter(static_cast<double>(hitchFrames),
+                                                          ::benchmark::Counter::kAvgIterations);
+    state.counters["first_appearance_ms"] = slowestFrame * 1000.0;
+}
+
+// Counts the frames that were drawn, and whether the last one left nothing to load or fade
+class FrameCountObserver : public MapObserver {
+public:
+    void onDidFinishRenderingFrame(const RenderFrameStatus& status) override {
+        drawnFrames++;
+        settled = status.mode == RenderMode::Full && !status.needsRepaint && !status.placementChanged;
+    }
+
+    bool settled = false;
+    std::size_t drawnFrames = 0;
+};
+
+// Keep rendering a continuous map that has finished loading and fading, like a frontend with a fixed frame rate
+void renderIdle(::benchmark::State& state, bool skipUnchangedFrames) {
+    constexpr std::size_t maxFrames = 1000;
+    constexpr std::size_t idleFrames = 60;
+    RenderBenchmark bench;
+    FrameCountObserver observer;
+    HeadlessFrontend frontend{size,
+                              pixelRatio,
+                              gfx::HeadlessBackend::SwapBehaviour::NoFlush,
+                              gfx::ContextMode::Unique,
+                              std::nullopt,
+                              /*invalidateOnUpdate=*/false};
+    Map map{frontend,
+            observer,
+            MapOptions().withMapMode(MapMode::Continuous).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withApiKey("foobar")};
+    prepare(map);
+    frontend.getRenderer()->setSkipUnchangedFrames(skipUnchangedFrames);
+
+    for (std::size_t frame = 0; !observer.settled && frame < maxFrames; ++frame) {
+        frontend.renderFrame();
+        bench.loop.runOnce();
+    }
+
+    observer.drawnFrames = 0;
+    for (auto _ : state) {
+        for (std::size_t frame = 0; frame < idleFrames; ++frame) {
+            frontend.renderFrame();
+        }
+    }
+
+    state.counters["drawn_frames"] = ::benchmark::Counter(static_cast<double>(observer.drawnFrames),
+                                                          ::benchmark::Counter::kAvgIterations);
+}
+
 void prepare_map2(Map& map, std::optional<std::string> json = std::nullopt) {
     map.getStyle().loadJSON(json ? *json : util::read_file("benchmark/fixtures/api/style.json"));
     map.jumpTo(CameraOptions().withCenter(LatLng{41.379800, 2.176810}).withZoom(15.0)); // Barcelona
@@ -65,6 +182,41 @@ static void API_renderStill_reuse_map(::benchmark::State& state) {
     }
 }
 
+// Redraw a fully loaded map without any change to the camera or the style
+static void API_renderStill_idle_redraw(::benchmark::State& state) {
+    RenderBenchmark bench;
+    HeadlessFrontend frontend{size, pixelRatio};
+    Map map{frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withApiKey("foobar")};
+    prepare(map);
+    frontend.render(map);
+
+    for (auto _ : state) {
+        frontend.renderFrame();
+    }
+}
+
+// A pitched view over a dense city, where most of the buildings of the tile cover are behind the horizon or the camera
+static void API_renderStill_pitched_city(::benchmark::State& state) {
+    RenderBenchmark bench;
+    HeadlessFrontend frontend{size, pixelRatio};
+    Map map{frontend,
+            MapObserver::nullObserver(),
+            MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+            ResourceOptions().withCachePath(cachePath).withApiKey("foobar")};
+    prepare(map);
+    map.jumpTo(CameraOptions().withZoom(16.0).withPitch(60.0).withBearing(30.0));
+
+    int culledDrawables = 0;
+    for (auto _ : state) {
+        culledDrawables = frontend.render(map).stats.numCulledDrawables;
+    }
+
+    state.counters["culled_drawables"] = culledDrawables;
+}
+
 static void API_renderStill_reuse_map_formatted_labels(::benchmark::State& state) {
     RenderBenchmark bench;
     HeadlessFrontend frontend{size, pixelRatio};
@@ -154,9 +306,56 @@ static void API_renderStill_multiple_sources(::benchmark::State& state) {
     }
 }
 
+static void API_renderStill_zoom_ranged_layers(::benchmark::State& state) {
+    using namespace mbgl::style;
+    RenderBenchmark bench;
+    const int kLayersCount = 500;
+
+    for (auto _ : state) {
+        HeadlessFrontend frontend{size, pixelRatio};
+        Map map{frontend,
+                MapObserver::nullObserver(),
+                MapOptions().withMapMode(MapMode::Static).withSize(size).withPixelRatio(pixelRatio),
+                ResourceOptions().withCachePath(cachePath).withApiKey("foobar")};
+        prepare(map);
+        auto& style = map.getStyle();
+        style.addSource(std::make_unique<GeoJSONSource>("ranged"));
+        // Layers that only show up well past the camera zoom.
+        for (int i = 0; i < kLayersCount; ++i) {
+            auto layer = std::make_unique<FillLayer>("ranged#" + std::to_string(i), "ranged");
+            layer->setMinZoom(18.0f);
+            style.addLayer(std::move(layer));
+        }
+        frontend.render(map);
+    }
+}
+
+static void API_renderContinuous_first_appearance(::benchmark::State& state) {
+    renderFirstAppearance(state, false);
+}
+
+static void API_renderContinuous_first_appearance_warm_up(::benchmark::State& state) {
+    renderFirstAppearance(state, true);
+}
+
+static void API_renderContinuous_idle(::benchmark::State& state) {
+    renderIdle(state, false);
+}
+
+static void API_renderContinuous_idle_skip_unchanged(::benchmark::State& state) {
+    renderIdle(state, true);
+}
+
 BENCHMARK(API_renderStill_reuse_map)->Unit(benchmark::kMillisecond)->Iterations(50);
+BENCHMARK(API_renderStill_idle_redraw)->Unit(benchmark::kMillisecond)->Iterations(50);
+BENCHMARK(API_renderStill_pitched_city)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_reuse_map_formatted_labels)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_reuse_map_switch_styles)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_recreate_map)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_recreate_map_2)->Unit(benchmark::kMillisecond)->Iterations(50);
 BENCHMARK(API_renderStill_multiple_sources)->Unit(benchmark::kMillisecond)->Iterations(50);
+BENCHMARK(API_renderStill_zoom_ranged_layers)->Unit(benchmark::kMillisecond)->Iterations(50);
+BENCHMARK(API_renderContinuous_first_appearance)->Unit(benchmark::kMillisecond)->Iterations(10);
+BENCHMARK(API_renderContinuous_first_appearance_warm_up)->Unit(benchmark::kMillisecond)->Iterations(10);
+BENCHMARK(API_renderContinuous_idle)->Unit(benchmark::kMillisecond)->Iterations(10);
+BENCHMARK(API_renderContinuous_idle_skip_unchanged)->Unit(benchmark::kMillisecond)->Iterations(10);
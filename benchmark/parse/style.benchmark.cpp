@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/parser.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <sstream>
+
+using namespace mbgl;
+
+namespace {
+
+// A style with `layerCount` layers alternating between a vector source and an
+// inline GeoJSON source holding `featureCount` points.
+std::string generateStyle(std::size_t layerCount, std::size_t featureCount) {
+    std::stringstream ss;
+    ss << R"({"version":8,"sources":{"vector":{"type":"vector","tiles":["https://example.com/{z}/{x}/{y}.pbf"]},)"
+       << R"("points":{"type":"geojson","data":{"type":"FeatureCollection","features":[)";
+    for (std::size_t i = 0; i < featureCount; ++i) {
+        ss << (i ? "," : "") << R"({"type":"Feature","properties":{"id":)" << i
+           << R"(},"geometry":{"type":"Point","coordinates":[)" << (i % 360) - 180.0 << "," << (i % 170) - 85.0
+           << "]}}";
+    }
+    ss << R"(]}}},"layers":[)";
+    for (std::size_t i = 0; i < layerCount; ++i) {
+        ss << (i ? "," : "");
+        if (i % 2) {
+            ss << R"({"id":"circle-)" << i << R"(","type":"circle","source":"points","minzoom":)" << (i % 16)
+               << R"(,"paint":{"circle-radius":["interpolate",["linear"],["zoom"],0,1,16,8]}})";
+        } else {
+            ss << R"({"id":"line-)" << i << R"(","type":"line","source":"vector","source-layer":"roads",)"
+               << R"("filter":["==",["get","class"],"road-)" << i << R"("],)"
+               << R"("paint":{"line-color":["match",["get","kind"],"a","#f00","b","#0f0","#00f"],"line-width":2}})";
+        }
+    }
+    ss << "]}";
+    return ss.str();
+}
+
+void parseStyle(benchmark::State& state, const std::string& json, bool streaming) {
+    while (state.KeepRunning()) {
+        style::Parser parser;
+        auto error = streaming ? parser.parseStreaming(json) : parser.parse(json);
+        benchmark::DoNotOptimize(error);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * json.size()));
+}
+
+} // namespace
+
+static void Parse_Style(benchmark::State& state) {
+    parseStyle(state, util::read_file("benchmark/fixtures/api/style.json"), false);
+}
+
+static void Parse_StyleStreaming(benchmark::State& state) {
+    parseStyle(state, util::read_file("benchmark/fixtures/api/style.json"), true);
+}
+
+static void Parse_LargeStyle(benchmark::State& state) {
+    parseStyle(state, generateStyle(static_cast<std::size_t>(state.range(0)), 10000), false);
+}
+
+static void Parse_LargeStyleStreaming(benchmark::State& state) {
+    parseStyle(state, generateStyle(static_cast<std::size_t>(state.range(0)), 10000), true);
+}
+
+BENCHMARK(Parse_Style);
+BENCHMARK(Parse_StyleStreaming);
+BENCHMARK(Parse_LargeStyle)->Arg(200)->Arg(800);
+BENCHMARK(Parse_LargeStyleStreaming)->Arg(200)->Arg(800);
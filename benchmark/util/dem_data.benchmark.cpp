@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/geometry/dem_data.hpp>
+
+#include <cmath>
+
+using namespace mbgl;
+
+namespace {
+
+constexpr uint32_t tileSize = 512;
+
+// Rolling terrain, packed with the Mapbox encoding
+PremultipliedImage makeTerrain(uint32_t seed) {
+    PremultipliedImage image({tileSize, tileSize});
+    for (uint32_t y = 0; y < tileSize; y++) {
+        for (uint32_t x = 0; x < tileSize; x++) {
+            const double elevation = 1000.0 + 800.0 * std::sin((x + seed) * 0.02) * std::cos((y + seed) * 0.015);
+            const auto value = static_cast<uint32_t>((elevation + 10000.0) * 10.0);
+            uint8_t* pixel = image.data.get() + (y * tileSize + x) * 4;
+            pixel[0] = static_cast<uint8_t>(value >> 16);
+            pixel[1] = static_cast<uint8_t>(value >> 8);
+            pixel[2] = static_cast<uint8_t>(value);
+            pixel[3] = 255;
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+static void DEMData_Construct(benchmark::State& state) {
+    const auto image = makeTerrain(0);
+    while (state.KeepRunning()) {
+        DEMData dem(image, Tileset::DEMEncoding::Mapbox);
+        benchmark::DoNotOptimize(dem.getImage());
+    }
+}
+
+static void DEMData_DecodeGet(benchmark::State& state) {
+    const DEMData dem(makeTerrain(0), Tileset::DEMEncoding::Mapbox);
+    std::vector<float> elevations(static_cast<std::size_t>(dem.stride) * dem.stride);
+    while (state.KeepRunning()) {
+        auto* out = elevations.data();
+        for (int32_t y = -1; y <= dem.dim; y++) {
+            for (int32_t x = -1; x <= dem.dim; x++) {
+                *out++ = static_cast<float>(dem.get(x, y));
+            }
+        }
+        benchmark::DoNotOptimize(elevations.data());
+    }
+}
+
+static void DEMData_DecodeScalar(benchmark::State& state) {
+    const DEMData dem(makeTerrain(0), Tileset::DEMEncoding::Mapbox);
+    std::vector<float> elevations(static_cast<std::size_t>(dem.stride) * dem.stride);
+    while (state.KeepRunning()) {
+        DEMData::decodeElevationsScalar(
+            dem.getImage()->data.get(), elevations.size(), dem.getUnpackVector(), elevations.data());
+        benchmark::DoNotOptimize(elevations.data());
+    }
+}
+
+static void DEMData_DecodeVectorized(benchmark::State& state) {
+    const DEMData dem(makeTerrain(0), Tileset::DEMEncoding::Mapbox);
+    std::vector<float> elevations(static_cast<std::size_t>(dem.stride) * dem.stride);
+    while (state.KeepRunning()) {
+        DEMData::decodeElevations(
+            dem.getImage()->data.get(), elevations.size(), dem.getUnpackVector(), elevations.data());
+        benchmark::DoNotOptimize(elevations.data());
+    }
+}
+
+static void DEMData_BackfillBorder(benchmark::State& state) {
+    DEMData dem(makeTerrain(0), Tileset::DEMEncoding::Mapbox);
+    const DEMData neighbor(makeTerrain(tileSize), Tileset::DEMEncoding::Mapbox);
+    while (state.KeepRunning()) {
+        for (int8_t dy = -1; dy <= 1; dy++) {
+            for (int8_t dx = -1; dx <= 1; dx++) {
+                if (dx != 0 || dy != 0) {
+                    dem.backfillBorder(neighbor, dx, dy);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(dem.getImage());
+    }
+}
+
+BENCHMARK(DEMData_Construct);
+BENCHMARK(DEMData_DecodeGet);
+BENCHMARK(DEMData_DecodeScalar);
+BENCHMARK(DEMData_DecodeVectorized);
+BENCHMARK(DEMData_BackfillBorder);
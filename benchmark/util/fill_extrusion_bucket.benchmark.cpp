@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/actor/scheduler.hpp>
+#include <mbgl/renderer/buckets/fill_extrusion_bucket.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer_impl.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer_properties.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <memory>
+#include <optional>
+
+using namespace mbgl;
+
+namespace {
+
+struct BuildingTile {
+    // Features read their properties from the layer
+    std::unique_ptr<GeometryTileLayer> layer;
+    std::vector<std::unique_ptr<GeometryTileFeature>> features;
+    std::vector<GeometryCollection> geometries;
+};
+
+// Buildings of the dense z14 tiles
+std::vector<BuildingTile> loadBuildings() {
+    std::vector<BuildingTile> tiles;
+    for (const char* name : {"14-8802-5374", "14-8802-5375", "14-8803-5374", "14-8803-5375"}) {
+        VectorTileData data(
+            std::make_shared<std::string>(util::read_file(std::string("metrics/integration/tiles/") + name + ".mvt")));
+        auto layer = data.getLayer("building");
+        if (!layer) {
+            continue;
+        }
+        BuildingTile tile{std::move(layer), {}, {}};
+        for (std::size_t i = 0; i < tile.layer->featureCount(); i++) {
+            auto feature = tile.layer->getFeature(i);
+            if (feature->getType() == FeatureType::Polygon) {
+                tile.geometries.push_back(feature->getGeometries().clone());
+                tile.features.push_back(std::move(feature));
+            }
+        }
+        tiles.push_back(std::move(tile));
+    }
+    return tiles;
+}
+
+void buildExtrusions(benchmark::State& state, bool batch, bool parallel) {
+    const auto tiles = loadBuildings();
+
+    style::FillExtrusionLayer layer("building", "source");
+    const std::map<std::string, Immutable<style::LayerProperties>> layerProperties{
+        {"building",
+         makeMutable<style::FillExtrusionLayerProperties>(
+             staticImmutableCast<style::FillExtrusionLayer::Impl>(layer.baseImpl))}};
+    const PatternLayerMap patterns;
+    const CanonicalTileID canonical(14, 8802, 5374);
+
+    std::optional<TaggedScheduler> threadPool;
+    if (parallel) {
+        threadPool.emplace(Scheduler::GetBackground(), util::SimpleIdentity{});
+    }
+
+    std::size_t vertexCount = 0;
+    while (state.KeepRunning()) {
+        for (const auto& tile : tiles) {
+            FillExtrusionBucket bucket{{}, layerProperties, 14.0f, 1};
+            if (batch) {
+                std::vector<FillExtrusionBucket::LayoutFeature> features;
+                features.reserve(tile.features.size());
+                for (std::size_t i = 0; i < tile.features.size(); ++i) {
+                    features.push_back({*tile.features[i], tile.geometries[i], patterns, i});
+                }
+                bucket.addFeatures(features, {}, canonical, threadPool);
+            } else {
+                for (std::size_t i = 0; i < tile.features.size(); ++i) {
+                    bucket.addFeature(*tile.features[i], tile.geometries[i], {}, patterns, i, canonical);
+                }
+            }
+            vertexCount += bucket.vertices.elements();
+        }
+    }
+    state.counters["vertices"] = benchmark::Counter(static_cast<double>(vertexCount), benchmark::Counter::kIsRate);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(buildExtrusions, Serial, false, false);
+BENCHMARK_CAPTURE(buildExtrusions, Batch, true, false);
+BENCHMARK_CAPTURE(buildExtrusions, Parallel, true, true);
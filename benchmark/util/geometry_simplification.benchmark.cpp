@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/gfx/fill_generator.hpp>
+#include <mbgl/gfx/polyline_generator.hpp>
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+struct WorldTile {
+    OverscaledTileID id;
+    std::vector<std::pair<FeatureType, GeometryCollection>> features;
+};
+
+// Low zoom world tiles, including an overzoomed one
+std::vector<WorldTile> loadWorldTiles() {
+    const std::vector<std::pair<OverscaledTileID, std::string>> tiles = {
+        {OverscaledTileID(0, 0, 0), "0-0-0"},
+        {OverscaledTileID(2, 1, 1), "2-1-1"},
+        {OverscaledTileID(2, 1, 2), "2-1-2"},
+        {OverscaledTileID(2, 2, 1), "2-2-1"},
+        {OverscaledTileID(2, 2, 2), "2-2-2"},
+        {OverscaledTileID(5, 0, {2, 2, 1}), "2-2-1"},
+    };
+
+    std::vector<WorldTile> result;
+    for (const auto& [id, name] : tiles) {
+        VectorTileData data(
+            std::make_shared<std::string>(util::read_file("metrics/integration/tiles/" + name + ".mvt")));
+        WorldTile tile{id, {}};
+        for (const char* layerName : {"landcover", "hillshade", "water", "admin"}) {
+            auto layer = data.getLayer(layerName);
+            if (!layer) {
+                continue;
+            }
+            for (std::size_t i = 0; i < layer->featureCount(); i++) {
+                auto feature = layer->getFeature(i);
+                if (feature->getType() != FeatureType::Point) {
+                    tile.features.emplace_back(feature->getType(), feature->getGeometries().clone());
+                }
+            }
+        }
+        result.push_back(std::move(tile));
+    }
+    return result;
+}
+
+void layoutWorldTiles(benchmark::State& state, float pixels) {
+    const auto tiles = loadWorldTiles();
+
+    gfx::PolylineGeneratorOptions options;
+    options.type = FeatureType::LineString;
+
+    std::size_t vertexCount = 0;
+    while (state.KeepRunning()) {
+        FillBucket::VertexVector fillVertices;
+        FillBucket::TriangleIndexVector fillTriangles;
+        SegmentVector fillSegments;
+        LineBucket::VertexVector lineVertices;
+        LineBucket::TriangleIndexVector lineTriangles;
+        SegmentVector lineSegments;
+        gfx::PolylineGenerator<LineLayoutVertex, SegmentBase> generator(
+            lineVertices,
+            LineBucket::layoutVertex,
+            lineSegments,
+            [](std::size_t vertexOffset, std::size_t indexOffset) -> SegmentBase {
+                return SegmentBase(vertexOffset, indexOffset);
+            },
+            [](auto& seg) -> SegmentBase& { return seg; },
+            lineTriangles);
+
+        for (const auto& tile : tiles) {
+            // Same tolerance as the geometry tile worker uses
+            const double tolerance = pixels * util::EXTENT / (util::tileSize_D * tile.id.overscaleFactor());
+            for (const auto& [type, geometry] : tile.features) {
+                const auto simplified = simplifyGeometry(geometry, type, tolerance);
+                if (type == FeatureType::Polygon) {
+                    gfx::generateFillBuffers(simplified, fillVertices, fillTriangles, fillSegments);
+                } else {
+                    for (const auto& line : simplified) {
+                        generator.generate(line, options);
+                    }
+                }
+            }
+        }
+        vertexCount = fillVertices.elements() + lineVertices.elements();
+    }
+    state.counters["vertices"] = static_cast<double>(vertexCount);
+}
+
+} // namespace
+
+static void GeometrySimplification_Layout(benchmark::State& state, float pixels) {
+    layoutWorldTiles(state, pixels);
+}
+
+BENCHMARK_CAPTURE(GeometrySimplification_Layout, None, 0.0f);
+BENCHMARK_CAPTURE(GeometrySimplification_Layout, HalfPixel, 0.5f);
+BENCHMARK_CAPTURE(GeometrySimplification_Layout, OnePixel, 1.0f);
@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/gfx/polygon_triangulation.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <optional>
+
+using namespace mbgl;
+
+namespace {
+
+// Polygons of the given layers of a dense z14 tile, prepared the way the fill buckets see them
+std::vector<GeometryCollection> loadPolygons(std::initializer_list<const char*> layerNames) {
+    VectorTileData tile(std::make_shared<std::string>(util::read_file("metrics/integration/tiles/14-8802-5375.mvt")));
+    std::vector<GeometryCollection> polygons;
+    for (const auto* layerName : layerNames) {
+        auto layer = tile.getLayer(layerName);
+        if (!layer) {
+            continue;
+        }
+        for (std::size_t i = 0; i < layer->featureCount(); i++) {
+            auto feature = layer->getFeature(i);
+            if (feature->getType() != FeatureType::Polygon) {
+                continue;
+            }
+            for (auto& polygon : classifyRings(feature->getGeometries())) {
+                limitHoles(polygon, 500);
+                polygons.push_back(std::move(polygon));
+            }
+        }
+    }
+    return polygons;
+}
+
+void triangulate(benchmark::State& state,
+                 std::initializer_list<const char*> layerNames,
+                 std::optional<gfx::TriangulationStrategy> strategy) {
+    const auto polygons = loadPolygons(layerNames);
+
+    std::size_t triangles = 0;
+    while (state.KeepRunning()) {
+        for (const auto& polygon : polygons) {
+            const auto indices = strategy ? gfx::triangulatePolygon(polygon, *strategy)
+                                          : gfx::triangulatePolygon(polygon);
+            triangles += indices.size() / 3;
+        }
+    }
+    state.counters["triangles"] = benchmark::Counter(static_cast<double>(triangles), benchmark::Counter::kIsRate);
+}
+
+} // namespace
+
+static void PolygonTriangulation_Landcover(benchmark::State& state) {
+    triangulate(state, {"landcover", "landuse"}, std::nullopt);
+}
+
+static void PolygonTriangulation_LandcoverEarcut(benchmark::State& state) {
+    triangulate(state, {"landcover", "landuse"}, gfx::TriangulationStrategy::Earcut);
+}
+
+static void PolygonTriangulation_Building(benchmark::State& state) {
+    triangulate(state, {"building"}, std::nullopt);
+}
+
+static void PolygonTriangulation_BuildingEarcut(benchmark::State& state) {
+    triangulate(state, {"building"}, gfx::TriangulationStrategy::Earcut);
+}
+
+BENCHMARK(PolygonTriangulation_Landcover);
+BENCHMARK(PolygonTriangulation_LandcoverEarcut);
+BENCHMARK(PolygonTriangulation_Building);
+BENCHMARK(PolygonTriangulation_BuildingEarcut);
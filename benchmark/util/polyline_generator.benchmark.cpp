@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/gfx/polyline_generator.hpp>
+#include <mbgl/renderer/buckets/line_bucket.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+// Road lines of a dense z14 tile
+std::vector<GeometryCollection> loadRoads() {
+    VectorTileData tile(std::make_shared<std::string>(util::read_file("metrics/integration/tiles/14-8803-5375.mvt")));
+    std::vector<GeometryCollection> roads;
+    if (auto layer = tile.getLayer("road")) {
+        for (std::size_t i = 0; i < layer->featureCount(); i++) {
+            auto feature = layer->getFeature(i);
+            if (feature->getType() == FeatureType::LineString) {
+                roads.push_back(feature->getGeometries());
+            }
+        }
+    }
+    return roads;
+}
+
+void generateRoads(benchmark::State& state, style::LineJoinType joinType, style::LineCapType capType) {
+    const auto roads = loadRoads();
+
+    gfx::PolylineGeneratorOptions options;
+    options.type = FeatureType::LineString;
+    options.joinType = joinType;
+    options.beginCap = capType;
+    options.endCap = capType;
+
+    std::size_t vertexCount = 0;
+    while (state.KeepRunning()) {
+        LineBucket::VertexVector vertices;
+        LineBucket::TriangleIndexVector triangles;
+        SegmentVector segments;
+        gfx::PolylineGenerator<LineLayoutVertex, SegmentBase> generator(
+            vertices,
+            LineBucket::layoutVertex,
+            segments,
+            [](std::size_t vertexOffset, std::size_t indexOffset) -> SegmentBase {
+                return SegmentBase(vertexOffset, indexOffset);
+            },
+            [](auto& seg) -> SegmentBase& { return seg; },
+            triangles);
+
+        for (const auto& road : roads) {
+            for (const auto& line : road) {
+                generator.generate(line, options);
+            }
+        }
+        vertexCount += vertices.elements();
+    }
+    benchmark::DoNotOptimize(vertexCount);
+}
+
+} // namespace
+
+static void PolylineGenerator_MiterButt(benchmark::State& state) {
+    generateRoads(state, style::LineJoinType::Miter, style::LineCapType::Butt);
+}
+
+static void PolylineGenerator_RoundRound(benchmark::State& state) {
+    generateRoads(state, style::LineJoinType::Round, style::LineCapType::Round);
+}
+
+BENCHMARK(PolylineGenerator_MiterButt);
+BENCHMARK(PolylineGenerator_RoundRound);
@@ -7,9 +7,11 @@
 #include <mbgl/gfx/draw_scope.hpp>
 #include <mbgl/gfx/renderbuffer.hpp>
 #include <mbgl/gfx/rendering_stats.hpp>
+#include <mbgl/gfx/shared_mesh_registry.hpp>
 #include <mbgl/gfx/types.hpp>
 
 #include <mbgl/gfx/uniform_buffer.hpp>
+#include <mbgl/util/compressed_image.hpp>
 
 #include <memory>
 #include <string>
@@ -91,6 +93,9 @@ public:
     gfx::RenderingStats& renderingStats() { return stats; }
     const gfx::RenderingStats& renderingStats() const { return stats; }
 
+    /// Geometry shared between drawables, see `DrawableBuilder::setSharedGeometry`
+    SharedMeshRegistry& getSharedMeshes() { return sharedMeshes; }
+
 #if !defined(NDEBUG)
     virtual void visualizeStencilBuffer() = 0;
     virtual void visualizeDepthBuffer(float depthRangeSize) = 0;
@@ -132,6 +137,15 @@ public:
     /// Create a texture
     virtual Texture2DPtr createTexture2D() = 0;
 
+    /// The block compressed texture formats that can be sampled from
+    virtual TextureCompressionSupport getTextureCompressionSupport() const = 0;
+
+    /// Whether the device rasterizes in software, such as llvmpipe or SwiftShader
+    virtual bool isSoftwareRenderer() const = 0;
+
+    /// Whether shader programs can be created on a thread other than the render thread
+    virtual bool supportsBackgroundShaderCompilation() const { return false; }
+
     /// Create a render target
     virtual RenderTargetPtr createRenderTarget(const Size size, const TextureChannelDataType type) = 0;
 
@@ -170,6 +184,7 @@ protected:
     virtual std::unique_ptr<DrawScopeResource> createDrawScopeResource() = 0;
 
     gfx::RenderingStats stats;
+    SharedMeshRegistry sharedMeshes;
     ContextObserver* observer;
 };
 
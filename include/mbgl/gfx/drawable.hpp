@@ -109,6 +109,9 @@ public:
     /// @brief Get the texture at the given internal ID.
     const gfx::Texture2DPtr& getTexture(size_t id) const;
 
+    /// @brief Get the collection of textures bound to this drawable
+    const Textures& getTextures() const noexcept { return textures; }
+
     /// @brief Set the collection of textures bound to this drawable
     /// @param textures_ A Textures collection to set
     void setTextures(const Textures& textures_) noexcept { textures = textures_; }
@@ -139,6 +139,12 @@ public:
     /// The attribute id for vertex/position attribute
     void setVertexAttrId(const size_t id) { vertexAttrId = id; }
 
+    /// Whether emitted drawables share their positions and indexes with any other drawables that have the same ones,
+    /// through `Context::getSharedMeshes`. Only for geometry that is never updated, and it replaces the vertex
+    /// attributes set on the builder.
+    bool getSharedGeometry() const { return sharedGeometry; }
+    void setSharedGeometry(bool value) { sharedGeometry = value; }
+
     /// @brief Get the texture at the given internal ID.
     const gfx::Texture2DPtr& getTexture(size_t id) const;
 
@@ -235,6 +241,7 @@ protected:
     bool enableStencil = false;
     bool enableDepth = true;
     bool is3D = false;
+    bool sharedGeometry = false;
     float lineWidth = 1.0f;
     DrawPriority drawPriority = 0;
     int32_t subLayerIndex = 0;
@@ -52,6 +52,16 @@ public:
     TexturePixelType getPixelFormat() const;
     bool isEmpty() const;
 
+    /// Texture memory in bytes
+    std::size_t getMemorySize() const;
+
+    /// Share of the texture covered by images that are in use, from 0 to 1
+    float getOccupancy() const;
+
+    /// Whether new images are kept out of this texture, so that it drains and can be released
+    bool isRetired() const { return retired; }
+    void retire() { retired = true; }
+
     std::optional<TextureHandle> reserveSize(const Size& size, int32_t uniqueId);
     void uploadImage(const uint8_t* pixelData, TextureHandle& texHandle);
 
@@ -70,6 +80,9 @@ private:
     Texture2DPtr texture;
     mapbox::ShelfPack shelfPack;
     int numTextures = 0;
+    /// Pixels covered by the images that are in use
+    std::size_t usedArea = 0;
+    bool retired = false;
     bool deferredCreation = false;
     ImagesToUpload imagesToUpload;
     std::mutex mutex;
@@ -38,11 +38,37 @@ public:
 
     void removeTextures(const std::vector<TextureHandle>& textureHandles, const DynamicTexturePtr& dynamicTexture);
 
+    struct Usage {
+        /// Number of textures, including retired ones
+        std::size_t numTextures = 0;
+        /// Number of textures that no longer take new images
+        std::size_t numRetiredTextures = 0;
+        /// Memory of all the textures in bytes
+        std::size_t textureBytes = 0;
+        /// Memory covered by the images that are in use
+        std::size_t usedBytes = 0;
+    };
+    Usage getUsage() const;
+
+    /// Limit the memory of the textures that take new images, in bytes, or 0 for no limit.
+    /// Over the limit, the textures that are mostly unused are retired: new images go to other textures, and retired
+    /// ones are released when the last tile using them is. Images are never moved, since their positions are baked
+    /// into the symbol and pattern geometry of the tiles.
+    void setMemoryBudget(std::size_t bytes);
+    std::size_t getMemoryBudget() const { return memoryBudget; }
+
+    /// Retire the textures that are mostly unused regardless of the budget, keeping the newest one of each format
+    void reduceMemoryUse();
+
 private:
+    /// Retire the sparsest textures until the rest fit in `budget`
+    void retireSparseTextures(std::size_t budget);
+
     Context& context;
     std::vector<DynamicTexturePtr> dynamicTextures;
     std::unordered_map<TexturePixelType, DynamicTexturePtr> dummyDynamicTexture;
-    std::mutex mutex;
+    std::size_t memoryBudget = 0;
+    mutable std::mutex mutex;
 };
 
 } // namespace gfx
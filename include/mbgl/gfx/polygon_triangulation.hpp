@@ -0,0 +1,32 @@
+#pragma once
+
+#include <mbgl/tile/geometry_tile_data.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+namespace gfx {
+
+enum class TriangulationStrategy : uint8_t {
+    /// Fan from the first vertex, for convex polygons without holes
+    Fan,
+    /// Sweep-line decomposition into y-monotone pieces, for large polygons with many holes
+    Monotone,
+    /// Ear clipping, handles anything
+    Earcut,
+};
+
+/// Choose how to triangulate a polygon, given as its outer ring followed by its holes
+TriangulationStrategy selectTriangulationStrategy(const GeometryCollection& polygon);
+
+/// Triangulate a polygon, given as its outer ring followed by its holes, with the strategy chosen by
+/// `selectTriangulationStrategy`.
+/// @return Indexes into the concatenated vertices of all the rings, three per triangle, wound like earcut's
+std::vector<uint32_t> triangulatePolygon(const GeometryCollection& polygon);
+
+/// Triangulate a polygon with the given strategy, falling back to earcut if the strategy fails
+std::vector<uint32_t> triangulatePolygon(const GeometryCollection& polygon, TriangulationStrategy);
+
+} // namespace gfx
+} // namespace mbgl
@@ -28,6 +28,12 @@ struct RenderingStats {
     int numDrawCalls = 0;
     /// Total number of draw calls executed during all the frames
     int totalDrawCalls = 0;
+    /// Number of batches of drawables sharing a shader, textures and render state drawn during the most recent frame
+    int numDrawableBatches = 0;
+    /// Number of indirect draw calls, each drawing several segments, executed during the most recent frame
+    int numIndirectDrawCalls = 0;
+    /// Number of 3D drawables skipped during the most recent frame because they were outside the view frustum
+    int numCulledDrawables = 0;
 
     /// Total number of textures created
     int numCreatedTextures = 0;
@@ -65,6 +71,10 @@ struct RenderingStats {
     int numVertexBuffers = 0;
     /// Sum of vertex buffers update sizes
     std::size_t vertexUpdateBytes = 0;
+    /// Number of vertex buffer updates limited to the modified ranges
+    std::size_t vertexPartialUpdates = 0;
+    /// Sum of the sizes of partial vertex buffer updates
+    std::size_t vertexPartialUpdateBytes = 0;
 
     /// Number of active uniform buffers
     int numUniformBuffers = 0;
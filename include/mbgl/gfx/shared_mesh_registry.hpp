@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+namespace mbgl {
+namespace gfx {
+
+class IndexVectorBase;
+class VertexVectorBase;
+
+using IndexVectorBasePtr = std::shared_ptr<IndexVectorBase>;
+using VertexVectorBasePtr = std::shared_ptr<VertexVectorBase>;
+
+/// Deduplicates immutable geometry, such as the quads that are repeated for every tile, so that identical vertex and
+/// index vectors share one buffer. Entries are held weakly and go away with the last drawable that references them.
+class SharedMeshRegistry {
+public:
+    /// Get a vertex vector with the same contents, registering the given one if there is none.
+    /// A registered vector must not be modified.
+    VertexVectorBasePtr share(VertexVectorBasePtr);
+
+    /// Get an index vector with the same contents, registering the given one if there is none.
+    /// A registered vector must not be modified.
+    IndexVectorBasePtr share(IndexVectorBasePtr);
+
+    /// Number of registered vectors that are still in use
+    std::size_t size() const;
+
+private:
+    /// Registered vectors by the hash of their contents
+    template <typename T>
+    struct Entries {
+        std::unordered_multimap<std::size_t, std::weak_ptr<T>> map;
+        /// Size at which expired entries are removed next
+        std::size_t pruneSize = 64;
+    };
+
+    template <typename T>
+    static std::shared_ptr<T> share(Entries<T>&, std::shared_ptr<T>&&, std::string_view contents);
+
+    template <typename T>
+    static void prune(Entries<T>&);
+
+    Entries<VertexVectorBase> vertices;
+    Entries<IndexVectorBase> indexes;
+};
+
+} // namespace gfx
+} // namespace mbgl
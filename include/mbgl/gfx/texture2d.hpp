@@ -1,5 +1,6 @@
 #pragma once
 #include <mbgl/gfx/types.hpp>
+#include <mbgl/util/compressed_image.hpp>
 #include <mbgl/util/image.hpp>
 
 #include <cstddef>
@@ -55,6 +56,10 @@ public:
     /// @param image_ Image data to transfer
     virtual Texture2D& setImage(std::shared_ptr<PremultipliedImage> image_) noexcept = 0;
 
+    /// @brief Sets the internal image to block compressed pixel data
+    /// @param image_ Compressed data to transfer, in a format the context supports
+    virtual Texture2D& setCompressedImage(std::shared_ptr<CompressedImage> image_) noexcept = 0;
+
     /// @brief Get the pixel format of the texture
     /// @return Pixel format of the texture
     virtual TexturePixelType getFormat() const noexcept = 0;
@@ -107,6 +107,9 @@ enum class TexturePixelType : uint8_t {
     Stencil,   ///< Stencil
     Depth,     ///< Depth component
     Luminance, ///< Luminance
+    ETC2,      ///< ETC2 RGB, block compressed
+    BC1,       ///< BC1 (DXT1) RGB, block compressed
+    ASTC,      ///< ASTC LDR with 4x4 blocks, block compressed
 };
 
 /// Texture channel data type
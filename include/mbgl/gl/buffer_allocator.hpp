@@ -15,6 +15,10 @@ namespace gl {
 class Context;
 class Fence;
 
+namespace extension {
+class BufferStorage;
+} // namespace extension
+
 class BufferRef {
 public:
     BufferRef(size_t pointer, size_t offset, size_t size_)
@@ -168,6 +172,9 @@ public:
     size_t pageSize() const noexcept override;
     int32_t getBufferID(size_t bufferIndex) const noexcept override;
 
+    /// Create buffers that stay mapped from now on, so that writes are plain copies without GL calls
+    void enablePersistentMapping(const extension::BufferStorage&) noexcept;
+
 private:
     class Impl;
     std::unique_ptr<Impl> impl;
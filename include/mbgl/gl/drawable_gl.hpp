@@ -34,6 +34,11 @@ public:
 
     void draw(PaintParameters&) const override;
 
+    /// Draw as part of a batch of drawables with the same shader, textures and render state, see
+    /// `TileLayerGroup::batchDrawables`. Only the first drawable of a batch sets that state up and the textures stay
+    /// bound until the last one.
+    void draw(PaintParameters&, bool firstInBatch, bool lastInBatch) const;
+
     struct DrawSegmentGL;
     void setIndexData(gfx::IndexVectorBasePtr, std::vector<UniqueDrawSegment> segments) override;
 
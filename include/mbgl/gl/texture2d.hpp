@@ -27,6 +27,8 @@ public: // gfx::Texture2D
 
     Texture2D& setImage(std::shared_ptr<PremultipliedImage> image_) noexcept override;
 
+    Texture2D& setCompressedImage(std::shared_ptr<CompressedImage> image_) noexcept override;
+
     gfx::TexturePixelType getFormat() const noexcept override { return pixelFormat; }
 
     Size getSize() const noexcept override { return size; }
@@ -43,7 +45,7 @@ public: // gfx::Texture2D
     void uploadSubRegion(const void* pixelData, const Size& size, uint16_t xOffset, uint16_t yOffset) noexcept override;
     void upload() noexcept override;
 
-    bool needsUpload() const noexcept override { return !!image; };
+    bool needsUpload() const noexcept override { return image || compressedImage; };
 
 public:
     /// @brief Get the OpenGL handle ID for the underlying resource
@@ -74,6 +76,7 @@ private:
     gfx::TextureChannelDataType channelType{gfx::TextureChannelDataType::UnsignedByte};
 
     std::shared_ptr<PremultipliedImage> image{nullptr};
+    std::shared_ptr<CompressedImage> compressedImage{nullptr};
     Size size{0, 0};
     bool samplerStateDirty{false};
     bool storageDirty{false};
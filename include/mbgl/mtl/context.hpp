@@ -98,6 +98,10 @@ public:
 
     gfx::Texture2DPtr createTexture2D() override;
 
+    TextureCompressionSupport getTextureCompressionSupport() const override;
+
+    bool isSoftwareRenderer() const override;
+
     RenderTargetPtr createRenderTarget(const Size size, const gfx::TextureChannelDataType type) override;
 
     void resetState(gfx::DepthMode depthMode, gfx::ColorMode colorMode) override;
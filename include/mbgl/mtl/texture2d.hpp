@@ -29,6 +29,8 @@ public:
 
     gfx::Texture2D& setImage(std::shared_ptr<PremultipliedImage>) noexcept override;
 
+    gfx::Texture2D& setCompressedImage(std::shared_ptr<CompressedImage>) noexcept override;
+
     gfx::TexturePixelType getFormat() const noexcept override { return pixelFormat; }
 
     Size getSize() const noexcept override { return size; }
@@ -45,7 +47,7 @@ public:
     void uploadSubRegion(const void* pixelData, const Size& size, uint16_t xOffset, uint16_t yOffset) noexcept override;
     void upload() noexcept override;
 
-    bool needsUpload() const noexcept override { return !!image; };
+    bool needsUpload() const noexcept override { return image || compressedImage; };
 
     gfx::Texture2D& setUsage(MTL::TextureUsage usage_) noexcept;
 
@@ -78,6 +80,7 @@ private:
     SamplerState samplerState{};
 
     std::shared_ptr<PremultipliedImage> image{nullptr};
+    std::shared_ptr<CompressedImage> compressedImage{nullptr};
     bool textureDirty{true};
     bool samplerStateDirty{true};
 };
@@ -15,6 +15,10 @@ DECLARE_MAPLIBRE_SETTING(EXPERIMENTAL_THREAD_PRIORITY_FILE, thread_priority_file
 DECLARE_MAPLIBRE_SETTING(EXPERIMENTAL_THREAD_PRIORITY_NETWORK, thread_priority_network);
 DECLARE_MAPLIBRE_SETTING(EXPERIMENTAL_THREAD_PRIORITY_DATABASE, thread_priority_database);
 
+// The value for EXPERIMENTAL_STREAMING_STYLE_PARSER must be a bool. When true, styles are
+// parsed with a SAX reader that converts sources and layers as they are read.
+DECLARE_MAPLIBRE_SETTING(EXPERIMENTAL_STREAMING_STYLE_PARSER, streaming_style_parser);
+
 /// Settings class provides non-persistent, in-process key-value storage.
 class Settings final {
 public:
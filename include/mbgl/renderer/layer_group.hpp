@@ -149,6 +149,7 @@ public:
             } else {
                 // Removed, take it out of the collections
                 sortedDrawables.erase(drawable.get());
+                batchedDrawables.clear();
                 i = drawablesByTile.erase(i);
             }
             assert(drawablesByTile.size() == sortedDrawables.size());
@@ -167,6 +168,22 @@ public:
 
     std::size_t clearDrawables() override;
 
+    /// A range of `getBatchedDrawables()` whose drawables share a shader, textures and render state, so that only the
+    /// first of them needs to set that state up
+    struct DrawableBatch {
+        std::size_t begin;
+        std::size_t end;
+    };
+
+    /// Collect the enabled drawables for a render pass in drawing order and split them into batches.
+    /// In the opaque pass, drawables with the same state are moved next to each other, as long as that doesn't change
+    /// the order of the drawables of a tile or of drawables with different priorities. Other passes keep their order
+    /// and only batch consecutive drawables.
+    const std::vector<DrawableBatch>& batchDrawables(mbgl::RenderPass);
+
+    /// The drawables collected by the last call to `batchDrawables`
+    const std::vector<gfx::Drawable*>& getBatchedDrawables() const { return batchedDrawables; }
+
     void setStencilTiles(RenderTiles);
 
     void updateLayerIndex(int32_t value) override { layerIndex = value; }
@@ -195,6 +212,11 @@ private:
 
     using DrawableMap = std::set<gfx::Drawable*, gfx::DrawableLessByPriority>;
     DrawableMap sortedDrawables;
+
+    // Reused between frames by `batchDrawables`
+    std::vector<gfx::Drawable*> batchedDrawables;
+    std::vector<DrawableBatch> drawableBatches;
+    std::vector<std::pair<std::size_t, gfx::Drawable*>> batchScratch;
 };
 
 /**
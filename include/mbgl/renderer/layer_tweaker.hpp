@@ -5,9 +5,12 @@
 #include <mbgl/util/immutable.hpp>
 #include <mbgl/util/containers.hpp>
 #include <mbgl/util/mat4.hpp>
+#include <mbgl/util/size.hpp>
 
 #include <array>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace mbgl {
@@ -69,11 +72,38 @@ protected:
                                              bool nearClipped,
                                              bool aligned);
 
+    /// Whether the uniforms of the layer group's drawables have to be computed again.
+    /// They depend on the camera, the evaluated properties and the drawables with their tiles and textures. When all
+    /// of those are the same as the last time this returned true, the uniforms computed then are still current.
+    bool drawablesNeedUpdate(LayerGroupBase&, const PaintParameters&);
+
+    /// Compute the uniforms of the drawables again on the next frame, for inputs `drawablesNeedUpdate` doesn't track
+    void invalidateDrawables() { drawablesState.reset(); }
+
     std::string id;
     Immutable<style::LayerProperties> evaluatedProperties;
 
     // Indicates that the evaluated properties have changed
     bool propertiesUpdated = true;
+
+private:
+    // Incremented whenever the evaluated properties change
+    std::uint64_t propertiesVersion = 0;
+
+    struct DrawablesState {
+        std::uint64_t propertiesVersion;
+        mat4 projMatrix;
+        double zoom;
+        Size size;
+        float pixelRatio;
+        uint32_t currentLayer;
+        std::size_t drawablesHash;
+
+        bool operator==(const DrawablesState&) const = default;
+    };
+
+    // The inputs of the drawable uniforms at their last update
+    std::optional<DrawablesState> drawablesState;
 };
 
 } // namespace mbgl
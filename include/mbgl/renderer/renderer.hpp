@@ -51,7 +51,43 @@ public:
 
     void setObserver(RendererObserver*);
 
-    void render(const std::shared_ptr<UpdateParameters>&);
+    /**
+     * @brief Render a frame for the given update.
+     *
+     * @return Whether a frame was drawn. A frame is only left out when
+     * skipping unchanged frames is enabled, in which case the frontend should
+     * present the previous frame again.
+     */
+    bool render(const std::shared_ptr<UpdateParameters>&);
+
+    /**
+     * @brief In Continuous map mode, don't draw a frame that would be the same
+     * as the last one: the update is the one that was last rendered, the view
+     * has the same size, and the last frame was fully loaded with nothing
+     * fading or in transition.
+     *
+     * The map creates a new update for every change, including tiles and
+     * resources that finished loading, so an idle map calling `render()` in a
+     * loop doesn't rebuild and upload anything. Only enable this when the
+     * frontend can present the previous frame again, such as a framebuffer
+     * that is preserved between frames.
+     *
+     * Disabled by default.
+     */
+    void setSkipUnchangedFrames(bool);
+    bool getSkipUnchangedFrames() const;
+
+    /**
+     * @brief Compile the shader variants that the layers of the style are
+     * expected to draw with, so that building their drawables doesn't stall
+     * the first frame each layer appears in.
+     *
+     * The variants are predicted from the data-driven paint properties of
+     * each layer. Backends that can create shaders off the render thread
+     * compile them in the background, the others compile before returning.
+     * Like `render()`, this must be called with the backend active.
+     */
+    void warmUpShaders(const std::shared_ptr<UpdateParameters>&);
 
     /// Feature queries
     std::vector<Feature> queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions& options = {}) const;
@@ -113,6 +149,17 @@ public:
     void reduceMemoryUse();
     void clearData();
 
+    /**
+     * @brief Limit the memory of the glyph and icon atlas textures that new
+     * tiles are laid out into, in bytes. Zero, the default, means no limit.
+     *
+     * Over the limit, atlas textures that are mostly unused stop taking new
+     * images and are released once the tiles using them are, so that a long
+     * running map doesn't keep growing atlases that are mostly dead space.
+     */
+    void setAtlasMemoryBudget(std::size_t bytes);
+    std::size_t getAtlasMemoryBudget() const;
+
 #if MLN_RENDER_BACKEND_OPENGL
     void enableAndroidEmulatorGoldfishMitigation(bool enable);
 #endif
@@ -69,11 +69,11 @@ public:
             shader = context.createProgram(
                 ShaderID, shaderName, vertexSource, fragmentSource, programParameters, additionalDefines);
             assert(shader);
-            if (!shader || !registerShader(shader, shaderName)) {
-                assert(false);
-                throw std::runtime_error("Failed to register " + shaderName + " with shader group!");
+            if (!shader) {
+                throw std::runtime_error("Failed to create " + shaderName);
             }
 
+            // Finish the program before it's registered, other threads may pick it up right away
             using ShaderClass = shaders::ShaderSource<ShaderID, gfx::Backend::Type::Vulkan>;
             for (const auto& attrib : ShaderClass::attributes) {
                 if (!propertiesAsUniforms.second.contains(attrib.id)) {
@@ -86,6 +86,14 @@ public:
             for (const auto& texture : ShaderClass::textures) {
                 shader->initTexture(texture);
             }
+
+            if (!registerShader(shader, shaderName)) {
+                // Shaders can be warmed up in the background, another thread may have compiled the same one first
+                if (auto existing = get<vulkan::ShaderProgram>(shaderName)) {
+                    return existing;
+                }
+                throw std::runtime_error("Failed to register " + shaderName + " with shader group!");
+            }
         }
         return shader;
     }
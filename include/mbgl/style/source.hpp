@@ -116,6 +116,17 @@ public:
     // so any parent tile may be used.
     void setMaxOverscaleFactorForParentTiles(std::optional<uint8_t> overscaleFactor) noexcept;
     std::optional<uint8_t> getMaxOverscaleFactorForParentTiles() const noexcept;
+
+    // Sets a tolerance, in screen pixels, for simplifying line and polygon
+    // geometry before it is laid out for fill, line and fill-extrusion layers.
+    //
+    // Vertices closer than the tolerance to the simplified shape at the
+    // tile's own zoom level are dropped, which reduces the amount of work
+    // for low zoom and overzoomed tiles at the cost of accuracy. Feature
+    // queries still use the original geometry. By default, geometry is not
+    // simplified.
+    void setSimplificationTolerance(std::optional<float> pixels) noexcept;
+    std::optional<float> getSimplificationTolerance() const noexcept;
     void dumpDebugLogs() const;
 
     virtual bool supportsLayerType(const mbgl::style::LayerTypeInfo*) const = 0;
@@ -9,6 +9,10 @@ namespace style {
 
 struct RasterDEMOptions {
     std::optional<Tileset::DEMEncoding> encoding = std::nullopt;
+    // Compute the slopes for hillshade layers on the worker threads when tiles
+    // are parsed, instead of in a render pass. Meant for software renderers,
+    // where the extra render pass for every tile is expensive.
+    bool prepareHillshadeOnCPU = false;
 };
 
 // NOTE: Any derived class must invalidate `weakFactory` in the destructor
@@ -7,23 +7,34 @@
 namespace mbgl {
 namespace style {
 
+struct RasterOptions {
+    // Block compress the textures of decoded tiles on the worker threads, to
+    // keep more tiles within the same texture memory. Only applies to fully
+    // opaque tiles. Tiles served as KTX2 are always uploaded as they are.
+    Tileset::TextureCompression textureCompression = Tileset::TextureCompression::None;
+};
+
 class RasterSource : public TileSource {
 public:
     RasterSource(std::string id,
                  variant<std::string, Tileset> urlOrTileset,
                  uint16_t tileSize,
                  SourceType sourceType = SourceType::Raster);
+    RasterSource(std::string id, variant<std::string, Tileset> urlOrTileset, uint16_t tileSize, RasterOptions options);
 
     bool supportsLayerType(const mbgl::style::LayerTypeInfo*) const override;
 
     mapbox::base::WeakPtr<Source> makeWeakPtr() override { return weakFactory.makeWeakPtr(); }
 
 protected:
+    void setTilesetOverrides(Tileset& tileset) override;
+
     // Allows derived classes (e.g. RasterDEMSource) to invalidate weak pointers
     // early in their destructor before their own members are torn down.
     void invalidateWeakPtrsEarly() { weakFactory.invalidateWeakPtrs(); }
 
 private:
+    std::optional<RasterOptions> options;
     mapbox::base::WeakPtrFactory<Source> weakFactory{this}; // Must remain last
 };
 
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <mbgl/gfx/types.hpp>
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace mbgl {
+
+// Whether the pixel type is one of the block compressed formats
+constexpr bool isCompressed(gfx::TexturePixelType format) {
+    return format == gfx::TexturePixelType::ETC2 || format == gfx::TexturePixelType::BC1 ||
+           format == gfx::TexturePixelType::ASTC;
+}
+
+// Size of compressed pixel data, which is stored in blocks of 4x4 pixels
+std::size_t compressedDataSize(gfx::TexturePixelType format, Size size);
+
+// Pixel data in a block compressed format, without mipmaps
+class CompressedImage : private util::noncopyable {
+public:
+    CompressedImage() = default;
+
+    CompressedImage(gfx::TexturePixelType format_, Size size_)
+        : format(format_),
+          size(size_),
+          data(std::make_unique<uint8_t[]>(bytes())) {}
+
+    CompressedImage(CompressedImage&& o) noexcept
+        : format(o.format),
+          size(o.size),
+          data(std::move(o.data)) {
+        o.size.width = o.size.height = 0;
+    }
+
+    CompressedImage& operator=(CompressedImage&& o) noexcept {
+        format = o.format;
+        size = o.size;
+        data = std::move(o.data);
+        o.size.width = o.size.height = 0;
+        return *this;
+    }
+
+    bool valid() const { return !size.isEmpty() && data != nullptr; }
+
+    std::size_t bytes() const { return compressedDataSize(format, size); }
+
+    gfx::TexturePixelType format = gfx::TexturePixelType::ETC2;
+    Size size;
+    std::unique_ptr<uint8_t[]> data;
+};
+
+// The block compressed formats that a renderer can sample from
+struct TextureCompressionSupport {
+    bool etc2 = false;
+    bool bc1 = false;
+    bool astc = false;
+
+    bool supports(gfx::TexturePixelType format) const {
+        switch (format) {
+            case gfx::TexturePixelType::ETC2:
+                return etc2;
+            case gfx::TexturePixelType::BC1:
+                return bc1;
+            case gfx::TexturePixelType::ASTC:
+                return astc;
+            default:
+                return false;
+        }
+    }
+};
+
+bool isKTX2(const std::string&);
+
+// Reads the base level of a KTX2 container holding ETC2 RGB, BC1 or 4x4 ASTC
+// data without supercompression. Throws for anything else.
+CompressedImage decodeKTX2(const std::string&);
+
+// Compresses an image to ETC2 or BC1. Neither keeps an alpha channel here, so
+// an image that isn't fully opaque returns an invalid image.
+CompressedImage compressImage(const PremultipliedImage&, gfx::TexturePixelType format);
+
+} // namespace mbgl
@@ -8,6 +8,7 @@
 #include <cstring>
 #include <memory>
 #include <algorithm>
+#include <functional>
 
 namespace mbgl {
 
@@ -177,6 +178,18 @@ using AlphaImage = Image<ImageAlphaMode::Exclusive>;
 
 // TODO: don't use std::string for binary data.
 PremultipliedImage decodeImage(const std::string&);
+
+// Allocates the image that decoded pixels are written to
+using ImageAllocator = std::function<PremultipliedImage(Size)>;
+
+// Decodes the image into pixels allocated by `allocate`, where the platform
+// decoder allows it, so that pooled storage can be reused without a copy.
+PremultipliedImage decodeImage(const std::string&, const ImageAllocator& allocate);
+
+// Decodes a preview of the image at 1/`scale` of its size along each side,
+// with `scale` being 2, 4 or 8, if the image format can be decoded at that
+// size much faster than at full size. Returns an invalid image otherwise.
+PremultipliedImage decodeImagePreview(const std::string&, uint32_t scale, const ImageAllocator& allocate);
 std::string encodePNG(const PremultipliedImage&);
 
 } // namespace mbgl
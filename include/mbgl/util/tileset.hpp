@@ -22,6 +22,13 @@ public:
         Mapbox,
         Terrarium
     };
+    enum class TextureCompression : uint8_t {
+        None,
+        // The first of ETC2 and BC1 that the renderer supports
+        Automatic,
+        ETC2,
+        BC1
+    };
 
     std::vector<std::string> tiles;
     Range<uint8_t> zoomRange;
@@ -29,6 +36,10 @@ public:
     Scheme scheme;
     // DEMEncoding is not supported by the TileJSON spec
     DEMEncoding encoding;
+    // Nor is computing hillshade slopes on the CPU
+    bool prepareHillshadeOnCPU = false;
+    // Nor is compressing raster tile textures
+    TextureCompression textureCompression = TextureCompression::None;
     std::optional<LatLngBounds> bounds;
 
     Tileset(std::vector<std::string> tiles_ = std::vector<std::string>(),
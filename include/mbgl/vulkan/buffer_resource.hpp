@@ -71,12 +71,16 @@ public:
     /// Used to detect whether buffer contents have changed
     VersionType getVersion() const noexcept { return version; }
 
+    /// Identifies the Vulkan buffer, unlike its handle, which can be reused once it's destroyed
+    uint64_t getResourceID() const noexcept { return resourceID; }
+
 protected:
     Context& context;
     std::size_t size;
     std::uint32_t usage;
     VersionType version = 0;
     bool persistent;
+    uint64_t resourceID = 0;
 
     SharedBufferAllocation bufferAllocation;
     size_t bufferWindowSize = 0;
@@ -4,6 +4,10 @@
 #include <mbgl/util/containers.hpp>
 #include <mbgl/vulkan/renderer_backend.hpp>
 
+#include <array>
+#include <string>
+#include <vector>
+
 namespace mbgl {
 namespace gfx {
 class Renderable;
@@ -22,7 +26,11 @@ public:
 
     vulkan::Context& getContext() { return context; }
     const vulkan::Context& getContext() const { return context; }
-    const vk::UniqueCommandBuffer& getCommandBuffer() const { return commandBuffer; }
+
+    /// The command buffer that commands are recorded into, which is one of the render pass' secondary command
+    /// buffers while it's encoded in parallel, see `RenderPass::encodeParallel`
+    const vk::UniqueCommandBuffer& getCommandBuffer() const { return *commandBuffer; }
+    const vk::UniqueCommandBuffer& getPrimaryCommandBuffer() const { return primaryCommandBuffer; }
 
     std::unique_ptr<gfx::UploadPass> createUploadPass(const char* name, gfx::Renderable&) override;
     std::unique_ptr<gfx::RenderPass> createRenderPass(const char* name, const gfx::RenderPassDescriptor&) override;
@@ -38,8 +46,24 @@ private:
     friend class RenderPass;
     friend class UploadPass;
 
+    void setCommandBuffer(const vk::UniqueCommandBuffer& buffer) { commandBuffer = &buffer; }
+
+    /// Begin the labels that are open in the secondary command buffers in `buffer`
+    void beginSecondaryDebugGroups(const vk::UniqueCommandBuffer& buffer) const;
+    /// End the labels that are open in the secondary command buffers in `buffer`, before it's ended
+    void endSecondaryDebugGroups(const vk::UniqueCommandBuffer& buffer) const;
+
+    struct DebugLabel {
+        std::string name;
+        std::array<float, 4> color;
+    };
+
     vulkan::Context& context;
-    const vk::UniqueCommandBuffer& commandBuffer;
+    const vk::UniqueCommandBuffer& primaryCommandBuffer;
+    const vk::UniqueCommandBuffer* commandBuffer;
+    // Labels pushed while recording into a secondary command buffer. A label can't span command buffers, so these are
+    // ended and begun again in each secondary command buffer of the render pass.
+    std::vector<DebugLabel> secondaryDebugGroups;
 };
 
 } // namespace vulkan
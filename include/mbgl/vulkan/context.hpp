@@ -13,6 +13,8 @@
 #include <mbgl/vulkan/pipeline.hpp>
 #include <mbgl/vulkan/descriptor_set.hpp>
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -22,6 +24,7 @@ namespace mbgl {
 
 class ProgramParameters;
 class RenderStaticData;
+class ThreadedScheduler;
 
 namespace gfx {
 class VertexAttributeArray;
@@ -89,6 +92,11 @@ public:
 
     gfx::Texture2DPtr createTexture2D() override;
 
+    TextureCompressionSupport getTextureCompressionSupport() const override;
+
+    bool isSoftwareRenderer() const override;
+    bool supportsBackgroundShaderCompilation() const override { return true; }
+
     RenderTargetPtr createRenderTarget(const Size size, const gfx::TextureChannelDataType type) override;
 
     void resetState(gfx::DepthMode, gfx::ColorMode) override {}
@@ -143,15 +151,36 @@ public:
     const vk::UniquePipelineLayout& getPushConstantPipelineLayout();
 
     uint8_t getCurrentFrameResourceIndex() const { return frameResourceIndex; }
+    /// Counts the frames begun so far
+    uint64_t getFrameNumber() const { return frameNumber; }
+    /// A new ID for a buffer, image or sampler, which descriptor sets are cached by
+    uint64_t nextResourceID() { return ++lastResourceID; }
     void enqueueDeletion(std::function<void(Context&)>&& function);
     void submitOneTimeCommand(const std::function<void(const vk::UniqueCommandBuffer&)>& function) const;
 
     void requestSurfaceUpdate(bool useDelay = true);
 
+    /// Number of threads that layer groups can be encoded on in parallel, see `RenderPass::encodeParallel`.
+    /// Zero when render passes are recorded directly into the frame's primary command buffer.
+    std::size_t getEncoderThreadCount() const { return encoderThreadCount; }
+    ThreadedScheduler& getEncoderScheduler() { return *encoderScheduler; }
+
+    /// Get a secondary command buffer from the pool of an encoder thread, or from the render thread's pool with
+    /// `thread == getEncoderThreadCount()`. The buffers are reset when the frame's resources are reused.
+    const vk::UniqueCommandBuffer& acquireSecondaryCommandBuffer(std::size_t thread);
+
 private:
+    // Command buffers can only be recorded on one thread at a time per pool
+    struct SecondaryCommandPool {
+        vk::UniqueCommandPool pool;
+        std::deque<vk::UniqueCommandBuffer> buffers;
+        std::size_t used = 0;
+    };
+
     struct FrameResources {
         vk::UniqueCommandBuffer commandBuffer;
         vk::UniqueFence flightFrameFence;
+        std::vector<SecondaryCommandPool> secondaryPools;
 
         std::vector<std::function<void(Context&)>> deletionQueue;
 
@@ -188,7 +217,11 @@ private:
     vk::UniquePipelineLayout pushConstantPipelineLayout;
 
     uint8_t frameResourceIndex = 0;
+    uint64_t frameNumber = 0;
+    std::atomic<uint64_t> lastResourceID{0};
     std::vector<FrameResources> frameResources;
+    std::size_t encoderThreadCount = 0;
+    std::unique_ptr<ThreadedScheduler> encoderScheduler;
     bool surfaceUpdateRequested{false};
     int32_t surfaceUpdateLatency{0};
     int32_t currentFrameCount{0};
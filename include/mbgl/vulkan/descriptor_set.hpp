@@ -2,8 +2,11 @@
 
 #include <mbgl/gfx/uniform_buffer.hpp>
 #include <mbgl/vulkan/buffer_resource.hpp>
+#include <functional>
+#include <memory>
 #include <span>
-#include <queue>
+#include <unordered_map>
+#include <vector>
 
 namespace mbgl {
 namespace vulkan {
@@ -22,13 +25,25 @@ struct DescriptorPoolGrowable {
     struct PoolInfo {
         vk::UniqueDescriptorPool pool;
         uint32_t remainingSets{0};
-        std::queue<std::vector<vk::DescriptorSet>> unusedSets;
 
         PoolInfo(vk::UniqueDescriptorPool&& pool_, uint32_t remainingSets_)
             : pool(std::move(pool_)),
               remainingSets(remainingSets_) {}
     };
 
+    /// A descriptor set that's never written again once it's cached, so that it can be shared
+    struct CachedSet {
+        vk::DescriptorSet set;
+        uint64_t lastUsedFrame{0};
+    };
+
+    /// The IDs and offsets of the resources a descriptor set is written with
+    using CacheKey = std::vector<uint64_t>;
+
+    struct CacheKeyHash {
+        std::size_t operator()(const CacheKey& key) const noexcept;
+    };
+
     const uint32_t maxSets{0};
     const uint32_t descriptorStoragePerSet{0};
     const uint32_t descriptorUniformsPerSet{0};
@@ -38,8 +53,18 @@ struct DescriptorPoolGrowable {
     std::vector<PoolInfo> pools;
     int32_t currentPoolIndex{-1};
 
+    std::unordered_map<CacheKey, std::shared_ptr<CachedSet>, CacheKeyHash> cache;
+    // Sets of evicted cache entries, to be written again
+    std::vector<vk::DescriptorSet> freeSets;
+    // Reused to look up the cache without allocating
+    CacheKey scratchKey;
+
     PoolInfo& current() { return pools[currentPoolIndex]; }
 
+    /// Make the sets that nothing refers to, and that the GPU is done with, available again
+    /// @param completedFrame The last frame whose commands are known to have completed
+    void releaseUnusedSets(uint64_t completedFrame);
+
     DescriptorPoolGrowable() = default;
     DescriptorPoolGrowable(uint32_t maxSets_,
                            uint32_t descriptorStoragePerSet_,
@@ -53,17 +78,27 @@ struct DescriptorPoolGrowable {
           growFactor(growFactor_) {}
 };
 
+/// The descriptor set to bind for each frame in flight. Sets are looked up by the resources they're written with in
+/// the pool's cache, so that everything binding the same resources shares one set, and a set is only written when
+/// the resources first show up.
 class DescriptorSet {
 public:
     DescriptorSet(Context& context_, DescriptorSetType type_);
     virtual ~DescriptorSet();
 
-    void allocate();
-
     virtual void markDirty();
     void bind(CommandEncoder& encoder);
+    void bind(const vk::UniqueCommandBuffer& commandBuffer) const;
 
 protected:
+    /// Whether the set of the current frame has to be looked up again. Otherwise it's marked as used.
+    bool needsUpdate();
+
+    /// Use the set cached for the pool's `scratchKey` in the current frame, calling `write` on a new set if there's
+    /// none
+    void useCachedSet(const std::function<void(vk::DescriptorSet)>& write);
+
+    vk::DescriptorSet allocate(DescriptorPoolGrowable& growablePool);
     void createDescriptorPool(DescriptorPoolGrowable& growablePool);
 
 protected:
@@ -71,8 +106,7 @@ protected:
     DescriptorSetType type;
 
     std::vector<bool> dirty;
-    std::vector<vk::DescriptorSet> descriptorSets;
-    int32_t descriptorPoolIndex{-1};
+    std::vector<std::shared_ptr<DescriptorPoolGrowable::CachedSet>> descriptorSets;
 };
 
 class UniformDescriptorSet : public DescriptorSet {
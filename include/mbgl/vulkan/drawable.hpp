@@ -17,7 +17,7 @@ class StencilMode;
 
 namespace vulkan {
 
-class CommandEncoder;
+class Context;
 class UploadPass;
 
 class Drawable : public gfx::Drawable {
@@ -28,6 +28,18 @@ public:
     void upload(gfx::UploadPass&);
     void draw(PaintParameters&) const override;
 
+    /// Draw as part of a batch of drawables with the same shader, textures and render state, see
+    /// `TileLayerGroup::batchDrawables`. Binding the pipeline is skipped when the batch already has it bound.
+    void draw(PaintParameters&, vk::Pipeline& boundPipeline) const;
+
+    /// Update the descriptor sets and look up the pipelines for the next draw, which isn't safe to do on more than one
+    /// thread at a time. Returns false if there's nothing to draw.
+    bool prepareDraw(PaintParameters&) const;
+
+    /// Record a draw set up by `prepareDraw`. Only the drawable itself is modified, so different drawables can be
+    /// recorded into different command buffers in parallel.
+    void encodeDraw(Context&, const vk::UniqueCommandBuffer&, vk::Pipeline& boundPipeline) const;
+
     void setIndexData(gfx::IndexVectorBasePtr, std::vector<UniqueDrawSegment> segments) override;
     void setVertices(std::vector<uint8_t>&&, std::size_t, gfx::AttributeDataType) override;
 
@@ -54,11 +66,15 @@ public:
 protected:
     void buildVulkanInputBindings() noexcept;
 
-    bool bindAttributes(CommandEncoder&) const noexcept;
-    bool bindDescriptors(CommandEncoder&) const noexcept;
+    void bindAttributes(Context&, const vk::UniqueCommandBuffer&) const noexcept;
+    bool prepareDescriptors(Context&) const noexcept;
+    void bindDescriptors(const vk::UniqueCommandBuffer&) const noexcept;
 
     void uploadTextures(UploadPass&) const noexcept;
 
+    /// Record the segments as a single indirect draw where the device supports it
+    void buildIndirectCommands(UploadPass&);
+
     class Impl;
     const std::unique_ptr<Impl> impl;
 };
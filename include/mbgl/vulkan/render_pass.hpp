@@ -1,9 +1,12 @@
 #pragma once
 
 #include <mbgl/gfx/render_pass.hpp>
+#include <mbgl/vulkan/renderer_backend.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace mbgl {
 namespace vulkan {
@@ -23,15 +26,36 @@ public:
 
     void clearStencil(uint32_t value = 0) const;
 
+    /// Called once the global uniform buffers are bound, so that they can be bound again in each secondary command
+    /// buffer
+    void setGlobalUniformBuffersBound() { globalUniformBuffersBound = true; }
+
+    /// Record commands into `taskCount` secondary command buffers on the encoder threads, which are executed in
+    /// order after everything recorded so far. Each starts with only the global descriptor set bound, within the open
+    /// debug labels.
+    /// @param taskCount At most `Context::getEncoderThreadCount()`
+    /// @return false, without calling `encode`, if this render pass isn't recorded into secondary command buffers
+    bool encodeParallel(std::size_t taskCount,
+                        const std::function<void(std::size_t task, const vk::UniqueCommandBuffer&)>& encode);
+
     void addDebugSignpost(const char* name) override;
 
 private:
     void pushDebugGroup(const char* name) override;
     void popDebugGroup() override;
 
+    const vk::UniqueCommandBuffer& beginSecondaryCommandBuffer(std::size_t thread);
+    void endSecondaryCommandBuffer(const vk::UniqueCommandBuffer& buffer) const;
+
 private:
     gfx::RenderPassDescriptor descriptor;
     vulkan::CommandEncoder& commandEncoder;
+
+    vk::CommandBufferInheritanceInfo inheritanceInfo;
+    bool useSecondaryCommandBuffers = false;
+    bool globalUniformBuffersBound = false;
+    // In the order they're executed in
+    std::vector<vk::CommandBuffer> secondaryCommandBuffers;
 };
 
 } // namespace vulkan
@@ -52,6 +52,7 @@ public:
     gfx::Texture2D& setFormat(gfx::TexturePixelType, gfx::TextureChannelDataType) noexcept override;
     gfx::Texture2D& setSize(Size size_) noexcept override;
     gfx::Texture2D& setImage(std::shared_ptr<PremultipliedImage>) noexcept override;
+    gfx::Texture2D& setCompressedImage(std::shared_ptr<CompressedImage>) noexcept override;
     gfx::Texture2D& setUsage(Texture2DUsage) noexcept;
 
     gfx::TexturePixelType getFormat() const noexcept override { return pixelFormat; }
@@ -74,7 +75,7 @@ public:
                          uint16_t yOffset,
                          const vk::UniqueCommandBuffer& buffer) noexcept;
 
-    bool needsUpload() const noexcept override { return !!imageData; };
+    bool needsUpload() const noexcept override { return imageData || compressedImageData; };
 
     vk::Format getVulkanFormat() const { return vulkanFormat(pixelFormat, channelType); }
 
@@ -83,6 +84,9 @@ public:
     const vk::Image& getVulkanImage() const { return imageAllocation->image; }
     const vk::Sampler& getVulkanSampler();
 
+    /// Changes whenever the image or sampler is created again, see `BufferResource::getResourceID`
+    uint64_t getResourceID() const { return resourceID; }
+
     void copyImage(vk::Image image);
     std::shared_ptr<PremultipliedImage> readImage();
 
@@ -113,9 +117,11 @@ private:
     SamplerState samplerState{};
 
     std::shared_ptr<PremultipliedImage> imageData{nullptr};
+    std::shared_ptr<CompressedImage> compressedImageData{nullptr};
     bool textureDirty{true};
     bool samplerStateDirty{true};
     std::chrono::duration<double> lastModified{0};
+    uint64_t resourceID{0};
 
     SharedImageAllocation imageAllocation;
     vk::ImageLayout imageLayout{vk::ImageLayout::eUndefined};
@@ -4,6 +4,7 @@
 #include <mbgl/renderer/layer_group.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace mbgl {
 
@@ -28,7 +29,16 @@ public:
     gfx::UniformBufferArray& mutableUniformBuffers() override { return uniformBuffers; }
 
 protected:
+    /// Record the drawables on the encoder threads, see `RenderPass::encodeParallel`.
+    /// Returns false if the layer group is too small for it to pay off, without recording anything.
+    bool encodeParallel(PaintParameters&,
+                        const std::optional<gfx::DepthMode>& depthMode3d,
+                        const std::optional<gfx::StencilMode>& stencilMode3d);
+
     UniformBufferArray uniformBuffers;
+
+    // Whether each of the batched drawables has anything to draw
+    std::vector<bool> preparedDrawables;
 };
 
 } // namespace vulkan
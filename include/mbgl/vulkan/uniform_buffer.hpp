@@ -69,6 +69,12 @@ public:
     void bind(gfx::RenderPass& renderPass) override;
 
     void bindDescriptorSets(CommandEncoder& encoder);
+
+    /// Update the descriptor set of the current frame, which isn't safe to do on more than one thread at a time
+    void prepareDescriptorSets(Context& context);
+    /// Bind the descriptor set prepared for the current frame
+    void bindDescriptorSets(const vk::UniqueCommandBuffer& commandBuffer) const;
+
     void freeDescriptorSets() { descriptorSet.reset(); }
 
 private:
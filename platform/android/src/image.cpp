@@ -17,4 +17,13 @@ PremultipliedImage decodeImage(const std::string& string) {
     return android::Bitmap::GetImage(*env, android::BitmapFactory::DecodeByteArray(*env, array, 0, string.size()));
 }
 
+PremultipliedImage decodeImage(const std::string& string, const ImageAllocator&) {
+    // The platform decoder allocates the pixels itself
+    return decodeImage(string);
+}
+
+PremultipliedImage decodeImagePreview(const std::string&, uint32_t, const ImageAllocator&) {
+    return {};
+}
+
 } // namespace mbgl
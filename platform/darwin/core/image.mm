@@ -93,4 +93,13 @@ PremultipliedImage decodeImage(const std::string& source) {
     return MLNPremultipliedImageFromCGImage(*image);
 }
 
+PremultipliedImage decodeImage(const std::string& string, const ImageAllocator&) {
+    // The platform decoder allocates the pixels itself
+    return decodeImage(string);
+}
+
+PremultipliedImage decodeImagePreview(const std::string&, uint32_t, const ImageAllocator&) {
+    return {};
+}
+
 } // namespace mbgl
@@ -59,6 +59,8 @@ public:
     RenderResult render(Map&);
     void renderOnce(Map&);
     void renderFrame();
+    /// Compile the shaders of the style from the last update ahead of rendering it
+    void warmUpShaders();
 
     std::optional<TransformState> getTransformState() const;
 
@@ -179,6 +179,13 @@ void HeadlessFrontend::renderFrame() {
     }
 }
 
+void HeadlessFrontend::warmUpShaders() {
+    if (renderer && updateParameters) {
+        gfx::BackendScope guard{*getBackend()};
+        renderer->warmUpShaders(updateParameters);
+    }
+}
+
 std::optional<TransformState> HeadlessFrontend::getTransformState() const {
     if (updateParameters) {
         return updateParameters->transformState;
@@ -4,11 +4,34 @@
 
 namespace mbgl {
 
-PremultipliedImage decodePNG(const uint8_t*, size_t);
-PremultipliedImage decodeJPEG(const uint8_t*, size_t);
-PremultipliedImage decodeWEBP(const uint8_t*, size_t);
+PremultipliedImage decodePNG(const uint8_t*, size_t, const ImageAllocator&);
+PremultipliedImage decodeJPEG(const uint8_t*, size_t, uint32_t scale, const ImageAllocator&);
+PremultipliedImage decodeWEBP(const uint8_t*, size_t, const ImageAllocator&);
+
+namespace {
+
+bool isJPEG(const uint8_t* data, size_t size) {
+    return size >= 2 && (((data[0] << 8) | data[1]) & 0xffff) == 0xFFD8;
+}
+
+} // namespace
 
 PremultipliedImage decodeImage(const std::string& string) {
+    return decodeImage(string, [](Size size) { return PremultipliedImage(size); });
+}
+
+PremultipliedImage decodeImagePreview(const std::string& string, uint32_t scale, const ImageAllocator& allocate) {
+    const auto* data = reinterpret_cast<const uint8_t*>(string.data());
+    const size_t size = string.size();
+
+    // Only JPEG can skip work when decoding at a smaller size, by scaling the DCT
+    if (isJPEG(data, size)) {
+        return decodeJPEG(data, size, scale, allocate);
+    }
+    return {};
+}
+
+PremultipliedImage decodeImage(const std::string& string, const ImageAllocator& allocate) {
     const auto* data = reinterpret_cast<const uint8_t*>(string.data());
     const size_t size = string.size();
 
@@ -23,22 +46,19 @@ PremultipliedImage decodeImage(const std::string& string) {
         uint32_t magic2 = readUInt(data, 0x8);
         // RIFF <xxxx = file size> WEBP
         if (magic1 == 0x52494646 && magic2 == 0x57454250) {
-            return decodeWEBP(data, size);
+            return decodeWEBP(data, size, allocate);
         }
     }
 
     if (size >= 4) {
         uint32_t magic = readUInt(data, 0x0);
         if (magic == 0x89504E47U) {
-            return decodePNG(data, size);
+            return decodePNG(data, size, allocate);
         }
     }
 
-    if (size >= 2) {
-        uint16_t magic = ((data[0] << 8) | data[1]) & 0xffff;
-        if (magic == 0xFFD8) {
-            return decodeJPEG(data, size);
-        }
+    if (isJPEG(data, size)) {
+        return decodeJPEG(data, size, 1, allocate);
     }
 
     throw std::runtime_error("unsupported image type");
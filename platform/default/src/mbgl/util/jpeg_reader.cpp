@@ -85,7 +85,7 @@ struct jpeg_info_guard {
     jpeg_decompress_struct* i_;
 };
 
-PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
+PremultipliedImage decodeJPEG(const uint8_t* data, size_t size, uint32_t scale, const ImageAllocator& allocate) {
     util::CharArrayBuffer dataBuffer{reinterpret_cast<const char*>(data), size};
     std::istream stream(&dataBuffer);
 
@@ -101,6 +101,14 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
     int ret = jpeg_read_header(&cinfo, TRUE);
     if (ret != JPEG_HEADER_OK) throw std::runtime_error("JPEG Reader: failed to read header");
 
+    // The IDCT produces the smaller image directly, skipping most of the work
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = scale;
+    if (scale > 1) {
+        cinfo.dct_method = JDCT_IFAST;
+        cinfo.do_fancy_upsampling = FALSE;
+    }
+
     jpeg_start_decompress(&cinfo);
 
     if (cinfo.out_color_space == JCS_UNKNOWN)
@@ -114,7 +122,7 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
     size_t components = cinfo.output_components;
     size_t rowStride = components * width;
 
-    PremultipliedImage image({static_cast<uint32_t>(width), static_cast<uint32_t>(height)});
+    PremultipliedImage image = allocate({static_cast<uint32_t>(width), static_cast<uint32_t>(height)});
     uint8_t* dst = image.data.get();
 
     JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)(
@@ -144,4 +152,8 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
     return image;
 }
 
+PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
+    return decodeJPEG(data, size, 1, [](Size imageSize) { return PremultipliedImage(imageSize); });
+}
+
 } // namespace mbgl
@@ -67,7 +67,7 @@ struct png_struct_guard {
     png_infopp i_;
 };
 
-PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
+PremultipliedImage decodePNG(const uint8_t* data, size_t size, const ImageAllocator& allocate) {
     util::CharArrayBuffer dataBuffer{reinterpret_cast<const char*>(data), size};
     std::istream stream(&dataBuffer);
 
@@ -99,7 +99,8 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
     int color_type = 0;
     png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, nullptr, nullptr, nullptr);
 
-    UnassociatedImage image({static_cast<uint32_t>(width), static_cast<uint32_t>(height)});
+    PremultipliedImage pixels = allocate({static_cast<uint32_t>(width), static_cast<uint32_t>(height)});
+    UnassociatedImage image(pixels.size, std::move(pixels.data));
 
     if (color_type == PNG_COLOR_TYPE_PALETTE) png_set_expand(png_ptr);
 
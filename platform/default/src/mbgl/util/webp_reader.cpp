@@ -7,14 +7,15 @@
 
 namespace mbgl {
 
-PremultipliedImage decodeWEBP(const uint8_t* data, size_t size) {
+PremultipliedImage decodeWEBP(const uint8_t* data, size_t size, const ImageAllocator& allocate) {
     int32_t width, height;
     if (!WebPGetInfo(data, size, &width, &height)) {
         Log::Warning(Event::Image, "Failed to decode WebP image header!");
         return {};
     }
 
-    auto img = UnassociatedImage({static_cast<uint32_t>(width), static_cast<uint32_t>(height)});
+    PremultipliedImage pixels = allocate({static_cast<uint32_t>(width), static_cast<uint32_t>(height)});
+    auto img = UnassociatedImage(pixels.size, std::move(pixels.data));
     if (!WebPDecodeRGBAInto(data, size, img.data.get(), img.bytes(), static_cast<int32_t>(img.stride()))) {
         Log::Warning(Event::Image, "Failed to decode WebP image contents!");
         return {};
@@ -48,4 +48,14 @@ PremultipliedImage decodeImage(const std::string& string) {
 
     return {{static_cast<uint32_t>(image.width()), static_cast<uint32_t>(image.height())}, std::move(img)};
 }
+
+PremultipliedImage decodeImage(const std::string& string, const ImageAllocator&) {
+    // The platform decoder allocates the pixels itself
+    return decodeImage(string);
+}
+
+PremultipliedImage decodeImagePreview(const std::string&, uint32_t, const ImageAllocator&) {
+    return {};
+}
+
 } // namespace mbgl
@@ -1,5 +1,7 @@
 #include "allocation_index.hpp"
 
+#include <mbgl/gfx/vector_pool.hpp>
+
 #include <atomic>
 #include <cassert>
 #include <cstdlib>
@@ -11,6 +13,7 @@ namespace {
 std::atomic_size_t indexedMemorySize{0};
 std::atomic_size_t indexedMemoryPeak{0};
 std::atomic_size_t allocationsCount{0};
+std::atomic_size_t pooledAllocationsBaseline{0};
 std::unordered_map<void*, size_t> memoryIndex;
 std::atomic_bool suppresIndexing{false};
 std::atomic_bool active{false};
@@ -56,6 +59,9 @@ inline bool canModifyIndex() {
 
 // static
 void AllocationIndex::setActive(bool active_) {
+    if (active_ && !active) {
+        pooledAllocationsBaseline = mbgl::gfx::getVectorPoolStats().reused;
+    }
     active = active_;
 }
 
@@ -72,6 +78,7 @@ void AllocationIndex::reset() {
     indexedMemorySize = 0;
     allocationsCount = 0;
     indexedMemoryPeak = 0;
+    pooledAllocationsBaseline = mbgl::gfx::getVectorPoolStats().reused;
 }
 
 // static
@@ -101,3 +108,8 @@ size_t AllocationIndex::getAllocationsCount() {
 size_t AllocationIndex::getAllocatedSizePeak() {
     return indexedMemoryPeak;
 }
+
+// static
+size_t AllocationIndex::getPooledAllocationsCount() {
+    return mbgl::gfx::getVectorPoolStats().reused - pooledAllocationsBaseline;
+}
@@ -51,4 +51,12 @@ public:
      * @return size_t
      */
     static size_t getAllocatedSizePeak();
+
+    /**
+     * @brief Returns the number of vertex and index vector allocations that
+     * were served from pooled storage instead of `malloc()`, since indexing start.
+     *
+     * @return size_t
+     */
+    static size_t getPooledAllocationsCount();
 };
@@ -71,13 +71,16 @@ struct FileSizeProbe {
 
 struct MemoryProbe {
     MemoryProbe() = default;
-    MemoryProbe(size_t peak_, size_t allocations_)
+    MemoryProbe(size_t peak_, size_t allocations_, size_t pooledAllocations_ = 0)
         : peak(peak_),
           allocations(allocations_),
+          pooledAllocations(pooledAllocations_),
           tolerance(0.0f) {}
 
     size_t peak;
     size_t allocations;
+    // Informational, not compared against the expectations
+    size_t pooledAllocations = 0;
     float tolerance;
 
     static std::tuple<bool, float> checkPeak(const MemoryProbe& expected, const MemoryProbe& actual) {
@@ -224,6 +224,7 @@ std::string serializeMetrics(const TestMetrics& metrics) {
             writer.String(memoryProbe.first.c_str());
             writer.Uint64(memoryProbe.second.peak);
             writer.Uint64(memoryProbe.second.allocations);
+            writer.Uint64(memoryProbe.second.pooledAllocations);
             writer.EndArray();
         }
         writer.EndArray();
@@ -993,7 +994,8 @@ TestOperations parseTestOperations(TestMetadata& metadata) {
                     std::piecewise_construct,
                     std::forward_as_tuple(std::move(mark)),
                     std::forward_as_tuple(AllocationIndex::getAllocatedSizePeak(),
-                                          AllocationIndex::getAllocationsCount()));
+                                          AllocationIndex::getAllocationsCount(),
+                                          AllocationIndex::getPooledAllocationsCount()));
                 if (tolerance >= 0.0f) emplaced.first->second.tolerance = tolerance;
                 return true;
             });
@@ -568,10 +568,12 @@ TestOperations getBeforeOperations(const Manifest& manifest) {
             result.emplace_back([](TestContext& ctx) {
                 assert(!AllocationIndex::isActive());
                 AllocationIndex::setActive(true);
-                ctx.getMetadata().metrics.memory.emplace(std::piecewise_construct,
-                                                         std::forward_as_tuple(memoryProbeOp + mark),
-                                                         std::forward_as_tuple(AllocationIndex::getAllocatedSizePeak(),
-                                                                               AllocationIndex::getAllocationsCount()));
+                ctx.getMetadata().metrics.memory.emplace(
+                    std::piecewise_construct,
+                    std::forward_as_tuple(memoryProbeOp + mark),
+                    std::forward_as_tuple(AllocationIndex::getAllocatedSizePeak(),
+                                          AllocationIndex::getAllocationsCount(),
+                                          AllocationIndex::getPooledAllocationsCount()));
                 return true;
             });
             continue;
@@ -614,7 +616,8 @@ TestOperations getAfterOperations(const Manifest& manifest) {
                     std::piecewise_construct,
                     std::forward_as_tuple(memoryProbeOp + mark),
                     std::forward_as_tuple(AllocationIndex::getAllocatedSizePeak(),
-                                          AllocationIndex::getAllocationsCount()));
+                                          AllocationIndex::getAllocationsCount(),
+                                          AllocationIndex::getPooledAllocationsCount()));
                 assert(emplaced.second);
                 // TODO: Improve tolerance handling for memory tests.
                 emplaced.first->second.tolerance = 0.2f;
@@ -1,6 +1,16 @@
 #include <mbgl/geometry/dem_data.hpp>
 #include <mbgl/math/clamp.hpp>
 
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MLN_DEM_SSE2 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MLN_DEM_NEON 1
+#endif
+
 namespace mbgl {
 
 DEMData::DEMData(const PremultipliedImage& _image, Tileset::DEMEncoding _encoding)
@@ -80,10 +90,10 @@ void DEMData::backfillBorder(const DEMData& borderTileData, int8_t dx, int8_t dy
     auto* dest = reinterpret_cast<uint32_t*>(image->data.get());
     auto* source = reinterpret_cast<uint32_t*>(o.image->data.get());
 
+    // Rows of the range are contiguous in both images
+    const auto count = static_cast<std::size_t>(xMax - xMin);
     for (int32_t y = yMin; y < yMax; y++) {
-        for (int32_t x = xMin; x < xMax; x++) {
-            dest[idx(x, y)] = source[idx(x + ox, y + oy)];
-        }
+        std::memcpy(dest + idx(xMin, y), source + idx(xMin + ox, y + oy), count * 4);
     }
 }
 
@@ -93,6 +103,68 @@ int32_t DEMData::get(const int32_t x, const int32_t y) const {
     return static_cast<int32_t>(value[0] * unpack[0] + value[1] * unpack[1] + value[2] * unpack[2] - unpack[3]);
 }
 
+std::vector<float> DEMData::getElevations() const {
+    std::vector<float> elevations(static_cast<std::size_t>(stride) * stride);
+    decodeElevations(image->data.get(), elevations.size(), getUnpackVector(), elevations.data());
+    return elevations;
+}
+
+void DEMData::decodeElevations(const uint8_t* pixels,
+                               std::size_t count,
+                               const std::array<float, 4>& unpack,
+                               float* out) {
+    std::size_t i = 0;
+
+    // Four pixels at a time. The operations are done in the same order as the scalar
+    // version, without fused multiply-adds, so that both give the same results.
+#if defined(MLN_DEM_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const __m128 u0 = _mm_set1_ps(unpack[0]);
+    const __m128 u1 = _mm_set1_ps(unpack[1]);
+    const __m128 u2 = _mm_set1_ps(unpack[2]);
+    const __m128 u3 = _mm_set1_ps(unpack[3]);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + i * 4));
+        const __m128 r = _mm_cvtepi32_ps(_mm_and_si128(rgba, mask));
+        const __m128 g = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 8), mask));
+        const __m128 b = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(rgba, 16), mask));
+        const __m128 elevation = _mm_sub_ps(
+            _mm_add_ps(_mm_add_ps(_mm_mul_ps(r, u0), _mm_mul_ps(g, u1)), _mm_mul_ps(b, u2)), u3);
+        _mm_storeu_ps(out + i, elevation);
+    }
+#elif defined(MLN_DEM_NEON)
+    const uint32x4_t mask = vdupq_n_u32(0xFF);
+    const float32x4_t u0 = vdupq_n_f32(unpack[0]);
+    const float32x4_t u1 = vdupq_n_f32(unpack[1]);
+    const float32x4_t u2 = vdupq_n_f32(unpack[2]);
+    const float32x4_t u3 = vdupq_n_f32(unpack[3]);
+    for (; i + 4 <= count; i += 4) {
+        const uint32x4_t rgba = vreinterpretq_u32_u8(vld1q_u8(pixels + i * 4));
+        const float32x4_t r = vcvtq_f32_u32(vandq_u32(rgba, mask));
+        const float32x4_t g = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(rgba, 8), mask));
+        const float32x4_t b = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(rgba, 16), mask));
+        const float32x4_t elevation = vsubq_f32(
+            vaddq_f32(vaddq_f32(vmulq_f32(r, u0), vmulq_f32(g, u1)), vmulq_f32(b, u2)), u3);
+        vst1q_f32(out + i, elevation);
+    }
+#endif
+
+    decodeElevationsScalar(pixels + i * 4, count - i, unpack, out + i);
+}
+
+void DEMData::decodeElevationsScalar(const uint8_t* pixels,
+                                     std::size_t count,
+                                     const std::array<float, 4>& unpack,
+                                     float* out) {
+    for (std::size_t i = 0; i < count; i++) {
+        const uint8_t* value = pixels + i * 4;
+        const float r = value[0] * unpack[0];
+        const float g = value[1] * unpack[1];
+        const float b = value[2] * unpack[2];
+        out[i] = r + g + b - unpack[3];
+    }
+}
+
 const std::array<float, 4>& DEMData::getUnpackVector() const {
     // https://www.mapbox.com/help/access-elevation-data/#mapbox-terrain-rgb
     static const std::array<float, 4> unpackMapbox = {{6553.6f, 25.6f, 0.1f, 10000.0f}};
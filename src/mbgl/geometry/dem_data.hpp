@@ -19,6 +19,21 @@ public:
     int32_t get(int32_t x, int32_t y) const;
     const std::array<float, 4>& getUnpackVector() const;
 
+    /// Decode the elevations of all the pixels, border included, into `stride * stride` values in row order.
+    /// Unlike `get`, the elevations aren't truncated to whole meters.
+    std::vector<float> getElevations() const;
+
+    /// Decode `count` RGBA pixels into elevations with the given unpack vector, using SSE2 or NEON where available
+    static void decodeElevations(const uint8_t* pixels,
+                                 std::size_t count,
+                                 const std::array<float, 4>& unpack,
+                                 float* out);
+    /// Scalar version of `decodeElevations`
+    static void decodeElevationsScalar(const uint8_t* pixels,
+                                       std::size_t count,
+                                       const std::array<float, 4>& unpack,
+                                       float* out);
+
     const PremultipliedImage* getImage() const { return &*image; }
     const std::shared_ptr<PremultipliedImage>& getImagePtr() const { return image; }
 
@@ -135,6 +135,8 @@ void FeatureIndex::insert(const GeometryCollection& geometries,
     const std::string& emplacedLeaderID =
         bucketLayerIDs.insert(std::make_pair(bucketLeaderID, std::vector<std::string>{})).first->first;
 
+    bucketFeatureIndices[emplacedLeaderID].push_back(index);
+
     auto featureSortIndex = sortIndex++;
     for (const auto& ring : geometries) {
         const auto envelope = mapbox::geometry::envelope(ring);
@@ -336,6 +338,12 @@ void FeatureIndex::setBucketLayerIDs(const std::string& bucketLeaderID, const st
     bucketLayerIDs[bucketLeaderID] = layerIDs;
 }
 
+const std::vector<std::size_t>& FeatureIndex::getBucketFeatureIndices(const std::string& bucketLeaderID) const {
+    static const std::vector<std::size_t> empty;
+    const auto it = bucketFeatureIndices.find(bucketLeaderID);
+    return it != bucketFeatureIndices.end() ? it->second : empty;
+}
+
 DynamicFeatureIndex::~DynamicFeatureIndex() = default;
 
 void DynamicFeatureIndex::query(std::unordered_map<std::string, std::vector<Feature>>& result,
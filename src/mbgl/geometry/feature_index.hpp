@@ -138,6 +138,10 @@ public:
 
     void setBucketLayerIDs(const std::string& bucketLeaderID, const std::vector<std::string>& layerIDs);
 
+    /// Indices of the features inserted for the given bucket, in insertion order.
+    /// Used to re-populate the index when a bucket is carried over from a previous parse.
+    const std::vector<std::size_t>& getBucketFeatureIndices(const std::string& bucketLeaderID) const;
+
     std::unordered_map<std::string, std::vector<Feature>> lookupSymbolFeatures(
         const std::vector<IndexedSubfeature>& symbolFeatures,
         const RenderedQueryOptions& options,
@@ -166,6 +170,7 @@ private:
     //     container elements, but may invalidate all iterators to the container.
     std::unordered_map<std::string, std::vector<std::string>> bucketLayerIDs;
     std::unordered_set<std::string> uniqueLayerIDs;
+    std::unordered_map<std::string, std::vector<std::size_t>> bucketFeatureIndices;
     std::unique_ptr<const GeometryTileData> tileData;
 };
 } // namespace mbgl
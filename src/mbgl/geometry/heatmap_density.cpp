@@ -0,0 +1,281 @@
+#include <mbgl/geometry/heatmap_density.hpp>
+
+#include <mbgl/util/instrumentation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MLN_HEATMAP_SSE2 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MLN_HEATMAP_NEON 1
+#endif
+
+namespace mbgl {
+
+namespace {
+
+// Same as `heatmap.vertex.glsl`: the density a kernel is cut off at, and the Gaussian kernel coefficient
+constexpr float kernelZero = 1.0f / 255.0f / 16.0f;
+constexpr float gaussCoef = 0.3989422804014327f;
+
+// row[i] += scale * kernel[i]
+void addScaledRow(float* row, const float* kernel, float scale, std::size_t count) {
+    std::size_t i = 0;
+#if defined(MLN_HEATMAP_SSE2)
+    const __m128 s = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(row + i, _mm_add_ps(_mm_loadu_ps(row + i), _mm_mul_ps(s, _mm_loadu_ps(kernel + i))));
+    }
+#elif defined(MLN_HEATMAP_NEON)
+    const float32x4_t s = vdupq_n_f32(scale);
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(row + i, vaddq_f32(vld1q_f32(row + i), vmulq_f32(s, vld1q_f32(kernel + i))));
+    }
+#endif
+    for (; i < count; i++) {
+        row[i] += scale * kernel[i];
+    }
+}
+
+// A point with its kernel scaled into tile units
+struct Kernel {
+    float x;
+    float y;
+    // Peak density
+    float peak;
+    // Tile units per unit of the kernel
+    float scale;
+    // Half the width of the square the kernel is drawn in, in tile units
+    float extent;
+};
+
+// Fills `factors` with the kernel along one axis for the cells in `[first, last]`
+void kernelFactors(
+    float center, float origin, float cellSize, float scale, int32_t first, int32_t last, std::vector<float>& factors) {
+    factors.resize(static_cast<std::size_t>(last - first + 1));
+    for (int32_t i = first; i <= last; i++) {
+        const float d = (origin + (static_cast<float>(i) + 0.5f) * cellSize - center) / scale;
+        factors[static_cast<std::size_t>(i - first)] = std::exp(-0.5f * 3.0f * 3.0f * d * d);
+    }
+}
+
+} // namespace
+
+float HeatmapDensity::sample(float x, float y) const {
+    if (empty()) {
+        return 0.0f;
+    }
+
+    const float fx = (x - originX) / cellSize - 0.5f;
+    const float fy = (y - originY) / cellSize - 0.5f;
+    const float x0 = std::floor(fx);
+    const float y0 = std::floor(fy);
+    if (x0 < -1.0f || y0 < -1.0f || x0 >= static_cast<float>(size.width) || y0 >= static_cast<float>(size.height)) {
+        return 0.0f;
+    }
+
+    const auto ix = static_cast<int32_t>(x0);
+    const auto iy = static_cast<int32_t>(y0);
+    const auto value = [&](int32_t cx, int32_t cy) {
+        if (cx < 0 || cy < 0 || cx >= static_cast<int32_t>(size.width) || cy >= static_cast<int32_t>(size.height)) {
+            return 0.0f;
+        }
+        return values[static_cast<std::size_t>(cy) * size.width + static_cast<std::size_t>(cx)];
+    };
+
+    const float tx = fx - x0;
+    const float ty = fy - y0;
+    const float top = value(ix, iy) * (1.0f - tx) + value(ix + 1, iy) * tx;
+    const float bottom = value(ix, iy + 1) * (1.0f - tx) + value(ix + 1, iy + 1) * tx;
+    return top * (1.0f - ty) + bottom * ty;
+}
+
+HeatmapDensity accumulateHeatmapDensity(const std::vector<HeatmapPoint>& points,
+                                        float intensity,
+                                        float extrudeScale,
+                                        float cellSize,
+                                        uint32_t maxCells) {
+    MLN_TRACE_FUNC();
+    assert(cellSize > 0.0f && maxCells > 1);
+
+    std::vector<Kernel> kernels;
+    kernels.reserve(points.size());
+    float minX = std::numeric_limits<float>::max();
+    float minY = std::numeric_limits<float>::max();
+    float maxX = std::numeric_limits<float>::lowest();
+    float maxY = std::numeric_limits<float>::lowest();
+    for (const auto& point : points) {
+        const float peak = point.weight * intensity * gaussCoef;
+        const float scale = point.radius * extrudeScale;
+        // The shader's kernel size is undefined for these, and they add nothing visible
+        if (!(peak > kernelZero) || !(scale > 0.0f)) {
+            continue;
+        }
+        const float extent = std::sqrt(-2.0f * std::log(kernelZero / peak)) / 3.0f * scale;
+        kernels.push_back({point.x, point.y, peak, scale, extent});
+        minX = std::min(minX, point.x - extent);
+        minY = std::min(minY, point.y - extent);
+        maxX = std::max(maxX, point.x + extent);
+        maxY = std::max(maxY, point.y + extent);
+    }
+
+    HeatmapDensity density;
+    if (kernels.empty()) {
+        return density;
+    }
+
+    // Align the grid to whole cells so that it doesn't shift when points are added
+    cellSize = std::max(cellSize, std::max(maxX - minX, maxY - minY) / static_cast<float>(maxCells - 1));
+    density.cellSize = cellSize;
+    density.originX = std::floor(minX / cellSize) * cellSize;
+    density.originY = std::floor(minY / cellSize) * cellSize;
+    density.size = {std::min(maxCells, static_cast<uint32_t>(std::ceil((maxX - density.originX) / cellSize))),
+                    std::min(maxCells, static_cast<uint32_t>(std::ceil((maxY - density.originY) / cellSize)))};
+    density.size.width = std::max(density.size.width, 1u);
+    density.size.height = std::max(density.size.height, 1u);
+    density.values.assign(density.size.area(), 0.0f);
+
+    const auto lastColumn = static_cast<int32_t>(density.size.width) - 1;
+    const auto lastRow = static_cast<int32_t>(density.size.height) - 1;
+    std::vector<float> columnFactors;
+    std::vector<float> rowFactors;
+    for (const auto& kernel : kernels) {
+        // The cells whose centers are within the square the kernel is drawn in
+        const auto first = [&](float center, float origin) {
+            return static_cast<int32_t>(std::ceil((center - kernel.extent - origin) / cellSize - 0.5f));
+        };
+        const auto last = [&](float center, float origin) {
+            return static_cast<int32_t>(std::floor((center + kernel.extent - origin) / cellSize - 0.5f));
+        };
+        const int32_t x0 = std::max(first(kernel.x, density.originX), 0);
+        const int32_t x1 = std::min(last(kernel.x, density.originX), lastColumn);
+        const int32_t y0 = std::max(first(kernel.y, density.originY), 0);
+        const int32_t y1 = std::min(last(kernel.y, density.originY), lastRow);
+        if (x0 > x1 || y0 > y1) {
+            continue;
+        }
+
+        // The Gaussian is separable, so each row of the kernel is a scaled copy of the same factors
+        kernelFactors(kernel.x, density.originX, cellSize, kernel.scale, x0, x1, columnFactors);
+        kernelFactors(kernel.y, density.originY, cellSize, kernel.scale, y0, y1, rowFactors);
+        for (int32_t y = y0; y <= y1; y++) {
+            float* row = density.values.data() + static_cast<std::size_t>(y) * density.size.width + x0;
+            addScaledRow(row, columnFactors.data(), kernel.peak * rowFactors[y - y0], columnFactors.size());
+        }
+    }
+
+    return density;
+}
+
+void compositeHeatmapDensity(const HeatmapDensity& density,
+                             const mat4& matrix,
+                             Size size,
+                             std::vector<float>& viewportDensity) {
+    MLN_TRACE_FUNC();
+    assert(viewportDensity.size() == size.area());
+    if (density.empty() || size.isEmpty()) {
+        return;
+    }
+
+    // Tile points on the ground plane map to clip space x, y and w through this 3x3 part of the matrix
+    const std::array<double, 9> h{
+        matrix[0], matrix[4], matrix[12], matrix[1], matrix[5], matrix[13], matrix[3], matrix[7], matrix[15]};
+    const double determinant = h[0] * (h[4] * h[8] - h[5] * h[7]) - h[1] * (h[3] * h[8] - h[5] * h[6]) +
+                               h[2] * (h[3] * h[7] - h[4] * h[6]);
+    if (std::abs(determinant) <= std::numeric_limits<double>::epsilon()) {
+        return;
+    }
+    const std::array<double, 9> inverse{(h[4] * h[8] - h[5] * h[7]) / determinant,
+                                        (h[2] * h[7] - h[1] * h[8]) / determinant,
+                                        (h[1] * h[5] - h[2] * h[4]) / determinant,
+                                        (h[5] * h[6] - h[3] * h[8]) / determinant,
+                                        (h[0] * h[8] - h[2] * h[6]) / determinant,
+                                        (h[2] * h[3] - h[0] * h[5]) / determinant,
+                                        (h[3] * h[7] - h[4] * h[6]) / determinant,
+                                        (h[1] * h[6] - h[0] * h[7]) / determinant,
+                                        (h[0] * h[4] - h[1] * h[3]) / determinant};
+
+    const auto width = static_cast<double>(size.width);
+    const auto height = static_cast<double>(size.height);
+
+    // Limit the pixels to the bounds of the grid on screen, unless part of it is behind the camera
+    int32_t left = 0;
+    int32_t top = 0;
+    int32_t right = static_cast<int32_t>(size.width) - 1;
+    int32_t bottom = static_cast<int32_t>(size.height) - 1;
+    {
+        const double x0 = density.originX;
+        const double y0 = density.originY;
+        const double x1 = x0 + density.cellSize * density.size.width;
+        const double y1 = y0 + density.cellSize * density.size.height;
+        double minX = std::numeric_limits<double>::max();
+        double minY = std::numeric_limits<double>::max();
+        double maxX = std::numeric_limits<double>::lowest();
+        double maxY = std::numeric_limits<double>::lowest();
+        bool behind = false;
+        for (const auto& [x, y] : std::array<std::array<double, 2>, 4>{{{x0, y0}, {x1, y0}, {x0, y1}, {x1, y1}}}) {
+            const double w = h[6] * x + h[7] * y + h[8];
+            if (w <= 0.0) {
+                behind = true;
+                break;
+            }
+            const double px = ((h[0] * x + h[1] * y + h[2]) / w + 1.0) * 0.5 * width;
+            const double py = (1.0 - (h[3] * x + h[4] * y + h[5]) / w) * 0.5 * height;
+            minX = std::min(minX, px);
+            minY = std::min(minY, py);
+            maxX = std::max(maxX, px);
+            maxY = std::max(maxY, py);
+        }
+        if (!behind) {
+            left = std::max(left, static_cast<int32_t>(std::clamp(std::floor(minX), -1.0, width)));
+            top = std::max(top, static_cast<int32_t>(std::clamp(std::floor(minY), -1.0, height)));
+            right = std::min(right, static_cast<int32_t>(std::clamp(std::ceil(maxX), -1.0, width)));
+            bottom = std::min(bottom, static_cast<int32_t>(std::clamp(std::ceil(maxY), -1.0, height)));
+        }
+    }
+
+    // Going right by a pixel moves by a constant step in homogeneous tile coordinates
+    const double stepX = 2.0 / width;
+    for (int32_t py = top; py <= bottom; py++) {
+        const double ny = 1.0 - (py + 0.5) * 2.0 / height;
+        const double nx = (left + 0.5) * stepX - 1.0;
+        double tx = inverse[0] * nx + inverse[1] * ny + inverse[2];
+        double ty = inverse[3] * nx + inverse[4] * ny + inverse[5];
+        double tw = inverse[6] * nx + inverse[7] * ny + inverse[8];
+        float* out = viewportDensity.data() + static_cast<std::size_t>(py) * size.width;
+        for (int32_t px = left; px <= right; px++) {
+            // tw is the reciprocal of the clip space w, so points behind the camera have a negative one
+            if (tw > 0.0) {
+                out[px] += density.sample(static_cast<float>(tx / tw), static_cast<float>(ty / tw));
+            }
+            tx += inverse[0] * stepX;
+            ty += inverse[3] * stepX;
+            tw += inverse[6] * stepX;
+        }
+    }
+}
+
+PremultipliedImage packHeatmapDensity(const std::vector<float>& viewportDensity, Size size, bool bottomUp) {
+    assert(viewportDensity.size() == size.area());
+    PremultipliedImage image(size);
+    for (uint32_t y = 0; y < size.height; y++) {
+        const float* row = viewportDensity.data() + static_cast<std::size_t>(y) * size.width;
+        uint8_t* out = image.data.get() + static_cast<std::size_t>(bottomUp ? size.height - 1 - y : y) * size.width * 4;
+        for (uint32_t x = 0; x < size.width; x++) {
+            // The color ramp is sampled with the density clamped to [0, 1]
+            out[x * 4 + 0] = static_cast<uint8_t>(std::clamp(row[x], 0.0f, 1.0f) * 255.0f + 0.5f);
+            out[x * 4 + 1] = 0;
+            out[x * 4 + 2] = 0;
+            out[x * 4 + 3] = 255;
+        }
+    }
+    return image;
+}
+
+} // namespace mbgl
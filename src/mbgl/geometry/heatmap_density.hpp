@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/mat4.hpp>
+#include <mbgl/util/size.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace mbgl {
+
+/// A point feature of a heatmap in tile units, with its weight and radius evaluated at the current zoom
+struct HeatmapPoint {
+    float x;
+    float y;
+    float weight;
+    float radius;
+};
+
+/// Kernel density of a heatmap on a regular grid in tile units. Values are taken at the centers of the cells.
+class HeatmapDensity {
+public:
+    /// Corner of the first cell, in tile units
+    float originX = 0.0f;
+    float originY = 0.0f;
+    /// Width and height of a cell, in tile units
+    float cellSize = 1.0f;
+    Size size;
+    std::vector<float> values;
+
+    bool empty() const { return size.isEmpty(); }
+
+    /// Density at a location in tile units, interpolated bilinearly between the cell centers and zero outside
+    float sample(float x, float y) const;
+};
+
+/// Compute on the CPU the density that the heatmap shader renders for the points of a tile, by adding up the same
+/// Gaussian kernels with the same cutoff.
+/// @param intensity Evaluated heatmap-intensity
+/// @param extrudeScale Tile units per pixel, which the radius of the points is given in
+/// @param cellSize Requested cell size in tile units. It grows if the grid would have more than `maxCells` cells
+/// along a side.
+HeatmapDensity accumulateHeatmapDensity(const std::vector<HeatmapPoint>& points,
+                                        float intensity,
+                                        float extrudeScale,
+                                        float cellSize,
+                                        uint32_t maxCells = 1024);
+
+/// Add a tile's density to the density of the viewport, sampled at the centers of `size` pixels whose rows run from
+/// the top of the viewport to the bottom.
+/// @param matrix Transforms tile units to clip space
+void compositeHeatmapDensity(const HeatmapDensity&, const mat4& matrix, Size size, std::vector<float>& viewportDensity);
+
+/// Pack a density into the red channel of an image, as the color ramp pass samples it from the offscreen texture
+/// @param bottomUp Whether the first row of the image is the bottom of the viewport
+PremultipliedImage packHeatmapDensity(const std::vector<float>& viewportDensity, Size size, bool bottomUp);
+
+} // namespace mbgl
@@ -0,0 +1,104 @@
+#include <mbgl/geometry/hillshade_prepare.hpp>
+
+#include <mbgl/geometry/dem_data.hpp>
+#include <mbgl/util/instrumentation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+namespace mbgl {
+
+namespace {
+
+// Same as `hillshade_prepare.fragment.glsl`, see there for the derivation
+float slopeScale(HillshadePrepareZoom zoom) {
+    const float z = zoom.zoom;
+    const float exaggeration = z < 2.0f ? 0.4f : z < 4.5f ? 0.35f : 0.3f;
+    // The shader also divides elevations by 4
+    return 1.0f / (4.0f * std::pow(2.0f, (z - zoom.maxzoom) * exaggeration + 19.2562f - z));
+}
+
+uint8_t packSlope(float slope) {
+    return static_cast<uint8_t>(std::clamp(slope / 2.0f + 0.5f, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+// Slopes of the pixels `[0, count)` of a row, given the elevations of the rows above, at and below it,
+// each starting at the pixel left of the first one.
+void prepareRow(const float* above,
+                const float* row,
+                const float* below,
+                std::size_t count,
+                float scale,
+                uint8_t* out) {
+    // Plain loops over contiguous rows, so that the compiler vectorizes them
+    for (std::size_t x = 0; x < count; x++) {
+        const float a = above[x], b = above[x + 1], c = above[x + 2];
+        const float d = row[x], f = row[x + 2];
+        const float g = below[x], h = below[x + 1], i = below[x + 2];
+
+        const float dx = ((c + f + f + i) - (a + d + d + g)) * scale;
+        const float dy = ((g + h + h + i) - (a + b + b + c)) * scale;
+
+        uint8_t* pixel = out + x * 4;
+        pixel[0] = packSlope(dx);
+        pixel[1] = packSlope(dy);
+        pixel[2] = 255;
+        pixel[3] = 255;
+    }
+}
+
+// Elevations of the pixels `[x - 1, x + 1]` of the rows `[y - 1, y + 1]`
+std::array<float, 9> neighborhood(const DEMData& dem, int32_t x, int32_t y) {
+    const auto* pixels = dem.getImage()->data.get();
+    std::array<float, 9> elevations;
+    for (int32_t row = 0; row < 3; row++) {
+        const auto offset = static_cast<std::size_t>(y + row) * dem.stride + x;
+        DEMData::decodeElevationsScalar(pixels + offset * 4, 3, dem.getUnpackVector(), elevations.data() + row * 3);
+    }
+    return elevations;
+}
+
+} // namespace
+
+PremultipliedImage prepareHillshade(const DEMData& dem, HillshadePrepareZoom zoom) {
+    MLN_TRACE_FUNC();
+
+    const auto dim = static_cast<std::size_t>(dem.dim);
+    const auto stride = static_cast<std::size_t>(dem.stride);
+    const auto scale = slopeScale(zoom);
+    const auto elevations = dem.getElevations();
+
+    PremultipliedImage prepared({static_cast<uint32_t>(dim), static_cast<uint32_t>(dim)});
+    for (std::size_t y = 0; y < dim; y++) {
+        // Row `y` of the tile is row `y + 1` of the bordered DEM data
+        const float* row = elevations.data() + (y + 1) * stride;
+        prepareRow(row - stride, row, row + stride, dim, scale, prepared.data.get() + y * dim * 4);
+    }
+    return prepared;
+}
+
+void updateHillshadeBorder(const DEMData& dem, HillshadePrepareZoom zoom, PremultipliedImage& prepared) {
+    assert(prepared.size.width == static_cast<uint32_t>(dem.dim));
+    const auto dim = dem.dim;
+    const auto scale = slopeScale(zoom);
+
+    const auto update = [&](int32_t x, int32_t y) {
+        // In bordered coordinates, the neighborhood of (x, y) starts at (x, y)
+        const auto e = neighborhood(dem, x, y);
+        prepareRow(e.data(), e.data() + 3, e.data() + 6, 1, scale, prepared.data.get() + (y * dim + x) * 4);
+    };
+
+    for (int32_t x = 0; x < dim; x++) {
+        update(x, 0);
+        update(x, dim - 1);
+    }
+    for (int32_t y = 1; y < dim - 1; y++) {
+        update(0, y);
+        update(dim - 1, y);
+    }
+}
+
+} // namespace mbgl
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <mbgl/util/image.hpp>
+
+#include <cstdint>
+
+namespace mbgl {
+
+class DEMData;
+
+/// Zoom levels the slopes of a DEM tile are exaggerated for
+struct HillshadePrepareZoom {
+    uint8_t zoom;
+    uint8_t maxzoom;
+};
+
+/// Compute on the CPU the image that the hillshade prepare render pass draws for a DEM tile: the slopes along x and y,
+/// scaled into the red and green channels.
+PremultipliedImage prepareHillshade(const DEMData&, HillshadePrepareZoom);
+
+/// Recompute the outermost pixels of an image made by `prepareHillshade`, after the border of the DEM data was
+/// backfilled from a neighboring tile
+void updateHillshadeBorder(const DEMData&, HillshadePrepareZoom, PremultipliedImage& prepared);
+
+} // namespace mbgl
@@ -47,6 +47,8 @@ void DrawableBuilder::flush(gfx::Context& context) {
         } else if (Impl::Mode::WideVectorLocal == impl->getMode() || Impl::Mode::WideVectorGlobal == impl->getMode()) {
             // setup for wide vectors
             impl->setupForWideVectors(context, *this);
+        } else if (sharedGeometry) {
+            impl->setupForSharedGeometry(context, *this);
         }
 
         const auto& draw = getCurrentDrawable(/*createIfNone=*/true);
@@ -188,7 +190,9 @@ void DrawableBuilder::setSegments(const gfx::DrawMode mode,
                                   std::vector<uint16_t> indexes,
                                   const SegmentBase* segments,
                                   const std::size_t segmentCount) {
-    setSegments(mode, std::make_shared<gfx::IndexVectorBase>(std::move(indexes)), segments, segmentCount);
+    auto owned = std::make_shared<gfx::IndexVectorBase>(std::move(indexes));
+    setSegments(mode, owned, segments, segmentCount);
+    impl->ownsIndexes = (impl->sharedIndexes == owned);
 }
 
 void DrawableBuilder::setSegments(const gfx::DrawMode mode,
@@ -200,6 +204,7 @@ void DrawableBuilder::setSegments(const gfx::DrawMode mode,
         return;
     }
     impl->sharedIndexes = std::move(indexes);
+    impl->ownsIndexes = false;
     for (std::size_t i = 0; i < segmentCount; ++i) {
         const auto& seg = segments[i];
 #if !defined(NDEBUG)
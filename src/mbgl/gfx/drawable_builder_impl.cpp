@@ -7,6 +7,7 @@
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/projection.hpp>
 
+#include <cstring>
 #include <string>
 
 namespace mbgl {
@@ -94,6 +95,50 @@ void DrawableBuilder::Impl::setupForPolylines(gfx::Context& context, gfx::Drawab
     sharedIndexes = std::make_shared<gfx::IndexVectorBase>(std::move(polylineIndexes));
 }
 
+// MARK: - Shared geometry
+
+void DrawableBuilder::Impl::setupForSharedGeometry(gfx::Context& context, gfx::DrawableBuilder& builder) {
+    using VertexVector = gfx::VertexVector<VT>;
+    std::shared_ptr<VertexVector> verts;
+    if (rawVerticesCount) {
+        // Only positions can be shared this way
+        if (rawVerticesType != gfx::AttributeDataType::Short2 || rawVertices.size() != rawVerticesCount * sizeof(VT)) {
+            // Don't leave the shared positions of the previous drawable in place
+            builder.setVertexAttributes(nullptr);
+            return;
+        }
+        verts = std::make_shared<VertexVector>();
+        std::memcpy(verts->append(rawVerticesCount), rawVertices.data(), rawVertices.size());
+    } else {
+        verts = std::make_shared<VertexVector>(std::move(vertices));
+        vertices.clear();
+    }
+
+    auto& registry = context.getSharedMeshes();
+    const auto vertexCount = verts->elements();
+
+    auto attrs = context.createVertexAttributeArray();
+    if (const auto& attr = attrs->set(builder.vertexAttrId)) {
+        attr->setSharedRawData(registry.share(std::move(verts)),
+                               /*offset=*/0,
+                               /*vertexOffset=*/0,
+                               sizeof(VT),
+                               gfx::AttributeDataType::Short2);
+    }
+    builder.setVertexAttributes(std::move(attrs));
+    builder.setRawVertices({}, vertexCount, gfx::AttributeDataType::Short2);
+
+    if (!sharedIndexes && !buildIndexes.empty()) {
+        sharedIndexes = std::make_shared<gfx::IndexVectorBase>(std::move(buildIndexes));
+        buildIndexes.clear();
+        ownsIndexes = true;
+    }
+    // Indexes that were provided shared may still be updated by their owner
+    if (ownsIndexes) {
+        sharedIndexes = registry.share(std::move(sharedIndexes));
+    }
+}
+
 // MARK: - Wide Vector Polylines
 
 namespace {
@@ -48,6 +48,8 @@ public:
 
     std::vector<uint16_t> buildIndexes;
     std::shared_ptr<gfx::IndexVectorBase> sharedIndexes;
+    /// Whether `sharedIndexes` was made for this drawable rather than provided already shared
+    bool ownsIndexes = false;
     std::vector<std::unique_ptr<Drawable::DrawSegment>> segments;
 
     AttributeDataType rawVerticesType = static_cast<AttributeDataType>(-1);
@@ -71,6 +73,8 @@ public:
 
     void setupForWideVectors(gfx::Context&, gfx::DrawableBuilder&);
 
+    void setupForSharedGeometry(gfx::Context&, gfx::DrawableBuilder&);
+
     bool checkAndSetMode(Mode);
 
     Mode getMode() const { return mode; };
@@ -89,6 +93,7 @@ public:
         polylineVertices.clear();
         polylineIndexes.clear();
         buildIndexes.clear();
+        ownsIndexes = false;
         segments.clear();
     }
 
@@ -36,6 +36,17 @@ bool DynamicTexture::isEmpty() const {
     return (numTextures == 0);
 }
 
+std::size_t DynamicTexture::getMemorySize() const {
+    assert(texture);
+    return texture->getSize().area() * texture->getPixelStride();
+}
+
+float DynamicTexture::getOccupancy() const {
+    assert(texture);
+    const auto area = texture->getSize().area();
+    return area ? static_cast<float>(usedArea) / static_cast<float>(area) : 0.0f;
+}
+
 std::optional<TextureHandle> DynamicTexture::reserveSize(const Size& size, int32_t uniqueId) {
     std::lock_guard<std::mutex> lock(mutex);
     mapbox::Bin* bin = shelfPack.packOne(uniqueId, size.width, size.height);
@@ -44,6 +55,7 @@ std::optional<TextureHandle> DynamicTexture::reserveSize(const Size& size, int32
     }
     if (bin->refcount() == 1) {
         numTextures++;
+        usedArea += static_cast<std::size_t>(bin->w) * bin->h;
     }
     return TextureHandle(*bin);
 }
@@ -93,9 +105,11 @@ void DynamicTexture::removeTexture(const TextureHandle& texHandle) {
     if (!bin) {
         return;
     }
+    const auto binArea = static_cast<std::size_t>(bin->w) * bin->h;
     auto refcount = shelfPack.unref(*bin);
     if (refcount == 0) {
         numTextures--;
+        usedArea -= binArea;
         imagesToUpload.erase(texHandle);
     }
 }
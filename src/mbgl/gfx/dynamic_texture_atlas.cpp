@@ -1,7 +1,9 @@
 #include <mbgl/gfx/dynamic_texture_atlas.hpp>
 #include <mbgl/gfx/context.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <unordered_set>
 
 namespace mbgl {
 namespace gfx {
@@ -10,6 +12,8 @@ constexpr const uint16_t extraPadding = 1;
 constexpr const uint16_t padding = ImagePosition::padding + extraPadding;
 constexpr const Size startSize = {512, 512};
 constexpr const Size dummySize = {1, 1};
+// Textures with more of their area in use than this are kept even over the budget, retiring them reclaims little
+constexpr const float maxRetiredOccupancy = 0.5f;
 
 Rect<uint16_t> rectWithoutExtraPadding(const Rect<uint16_t>& rect) {
     return Rect<uint16_t>(
@@ -34,6 +38,10 @@ GlyphAtlas DynamicTextureAtlas::uploadGlyphs(const GlyphMap& glyphs) {
         return glyphAtlas;
     }
 
+    if (memoryBudget) {
+        retireSparseTextures(memoryBudget);
+    }
+
     size_t dynTexIndex = 0;
     Size dynTexSize = startSize;
     GlyphsToUpload glyphsToUpload;
@@ -48,7 +56,8 @@ GlyphAtlas DynamicTextureAtlas::uploadGlyphs(const GlyphMap& glyphs) {
             dynTexIndex++;
         }
 
-        if (glyphAtlas.dynamicTexture->getPixelFormat() != TexturePixelType::Alpha) {
+        if (glyphAtlas.dynamicTexture->getPixelFormat() != TexturePixelType::Alpha ||
+            glyphAtlas.dynamicTexture->isRetired()) {
             glyphAtlas.dynamicTexture = nullptr;
             continue;
         }
@@ -123,6 +132,10 @@ ImageAtlas DynamicTextureAtlas::uploadIconsAndPatterns(const ImageMap& icons,
         return imageAtlas;
     }
 
+    if (memoryBudget) {
+        retireSparseTextures(memoryBudget);
+    }
+
     size_t dynTexIndex = 0;
     Size dynTexSize = startSize;
     ImagesToUpload iconsToUpload;
@@ -140,7 +153,8 @@ ImageAtlas DynamicTextureAtlas::uploadIconsAndPatterns(const ImageMap& icons,
             dynTexIndex++;
         }
 
-        if (imageAtlas.dynamicTexture->getPixelFormat() != TexturePixelType::RGBA) {
+        if (imageAtlas.dynamicTexture->getPixelFormat() != TexturePixelType::RGBA ||
+            imageAtlas.dynamicTexture->isRetired()) {
             imageAtlas.dynamicTexture = nullptr;
             continue;
         }
@@ -259,5 +273,59 @@ void DynamicTextureAtlas::removeTextures(const std::vector<TextureHandle>& textu
     }
 }
 
+DynamicTextureAtlas::Usage DynamicTextureAtlas::getUsage() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    Usage usage;
+    for (const auto& dynamicTexture : dynamicTextures) {
+        const auto bytes = dynamicTexture->getMemorySize();
+        usage.numTextures++;
+        usage.numRetiredTextures += dynamicTexture->isRetired() ? 1 : 0;
+        usage.textureBytes += bytes;
+        usage.usedBytes += static_cast<std::size_t>(dynamicTexture->getOccupancy() * static_cast<float>(bytes));
+    }
+    return usage;
+}
+
+void DynamicTextureAtlas::setMemoryBudget(std::size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex);
+    memoryBudget = bytes;
+}
+
+void DynamicTextureAtlas::reduceMemoryUse() {
+    std::lock_guard<std::mutex> lock(mutex);
+    retireSparseTextures(0);
+}
+
+void DynamicTextureAtlas::retireSparseTextures(std::size_t budget) {
+    std::size_t activeBytes = 0;
+    std::vector<DynamicTexturePtr> candidates;
+    std::unordered_set<TexturePixelType> newestSeen;
+    // Newest first, the newest texture of each format keeps taking images so that uploads don't thrash new textures
+    for (auto it = dynamicTextures.rbegin(); it != dynamicTextures.rend(); ++it) {
+        const auto& dynamicTexture = *it;
+        if (dynamicTexture->isRetired()) {
+            continue;
+        }
+        activeBytes += dynamicTexture->getMemorySize();
+        if (!newestSeen.insert(dynamicTexture->getPixelFormat()).second &&
+            dynamicTexture->getOccupancy() < maxRetiredOccupancy) {
+            candidates.emplace_back(dynamicTexture);
+        }
+    }
+    if (activeBytes <= budget) {
+        return;
+    }
+
+    std::ranges::sort(candidates,
+                      [](const auto& a, const auto& b) { return a->getOccupancy() < b->getOccupancy(); });
+    for (const auto& dynamicTexture : candidates) {
+        if (activeBytes <= budget) {
+            break;
+        }
+        dynamicTexture->retire();
+        activeBytes -= dynamicTexture->getMemorySize();
+    }
+}
+
 } // namespace gfx
 } // namespace mbgl
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <mbgl/gfx/drawable_data.hpp>
+#include <mbgl/util/geometry.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace mbgl {
+
+namespace gfx {
+
+/// Extent of the buildings in a fill-extrusion drawable, for culling it against the view frustum
+class FillExtrusionDrawableData : public DrawableData {
+public:
+    FillExtrusionDrawableData(Point<int16_t> min_, Point<int16_t> max_)
+        : min(min_),
+          max(max_) {}
+
+    /// Corners of the footprint, in tile units
+    Point<int16_t> min;
+    Point<int16_t> max;
+
+    /// Height of the tallest building in meters, if it's known
+    std::optional<float> maxHeight;
+};
+
+using UniqueFillExtrusionDrawableData = std::unique_ptr<FillExtrusionDrawableData>;
+
+} // namespace gfx
+} // namespace mbgl
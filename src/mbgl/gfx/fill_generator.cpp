@@ -1,34 +1,10 @@
 #include <mbgl/gfx/fill_generator.hpp>
 #include <mbgl/gfx/polyline_generator.hpp>
-
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4244)
-#endif
-
-#include <mapbox/earcut.hpp>
-
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+#include <mbgl/gfx/polygon_triangulation.hpp>
 
 #include <cassert>
 #include <limits>
 
-namespace mapbox {
-namespace util {
-template <>
-struct nth<0, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.x; };
-};
-
-template <>
-struct nth<1, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.y; };
-};
-} // namespace util
-} // namespace mapbox
-
 namespace mbgl {
 namespace gfx {
 
@@ -118,7 +94,7 @@ void generateFillBuffers(const GeometryCollection& geometry,
             addRingVertices(fillVertices, ring);
         }
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+        std::vector<uint32_t> indices = triangulatePolygon(polygon);
         addFillIndices(fillSegments, fillIndexes, indices, startVertices, totalVertices);
     }
 }
@@ -142,7 +118,7 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
             addOutlineIndices(base, nVertices, lineSegments, lineIndexes);
         }
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+        std::vector<uint32_t> indices = triangulatePolygon(polygon);
         addFillIndices(fillSegments, fillIndexes, indices, startVertices, totalVertices);
     }
 }
@@ -179,7 +155,7 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
             lineGenerator.generate(ring, lineOptions);
         }
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+        std::vector<uint32_t> indices = triangulatePolygon(polygon);
         addFillIndices(fillSegments, fillIndexes, indices, startVertices, totalVertices);
     }
 }
@@ -220,7 +196,7 @@ void generateFillAndOutineBuffers(const GeometryCollection& geometry,
             lineGenerator.generate(ring, lineOptions);
         }
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+        std::vector<uint32_t> indices = triangulatePolygon(polygon);
         addFillIndices(fillSegments, fillIndexes, indices, startVertices, totalVertices);
     }
 }
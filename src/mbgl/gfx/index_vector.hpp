@@ -1,9 +1,11 @@
 #pragma once
 
 #include <mbgl/gfx/draw_mode.hpp>
+#include <mbgl/gfx/vector_pool.hpp>
 #include <mbgl/util/ignore.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace mbgl {
@@ -30,7 +32,7 @@ public:
           buffer(std::move(other.buffer)),
           dirty(other.dirty),
           released(other.released) {}
-    virtual ~IndexVectorBase() = default;
+    virtual ~IndexVectorBase() { VectorPool<uint16_t>::get().release(std::move(v)); }
 
     IndexBufferBase* getBuffer() const { return buffer.get(); }
     void setBuffer(std::unique_ptr<IndexBufferBase>&& value) { buffer = std::move(value); }
@@ -40,7 +42,14 @@ public:
 
     bool isReleased() const { return released; }
 
-    void reserve(std::size_t count) { v.reserve(count); }
+    /// Reserve room for `count` indexes, taking pooled storage if nothing has been allocated yet
+    void reserve(std::size_t count) {
+        if (v.capacity() == 0 && count > 0) {
+            v = VectorPool<uint16_t>::get().acquire(count);
+        } else {
+            v.reserve(count);
+        }
+    }
 
     void extend(std::size_t n, const uint16_t val) {
         assert(!released);
@@ -48,6 +57,12 @@ public:
         dirty = true;
     }
 
+    void append(const uint16_t* indexes, std::size_t n) {
+        assert(!released);
+        v.insert(v.end(), indexes, indexes + n);
+        dirty = true;
+    }
+
     uint16_t& at(std::size_t n) {
         assert(n < v.size());
         assert(!released);
@@ -75,7 +90,7 @@ public:
     void release() {
         // If we've already created a buffer, we don't need the raw data any more.
         if (buffer) {
-            v.clear();
+            VectorPool<uint16_t>::get().release(std::exchange(v, {}));
         }
         released = true;
     }
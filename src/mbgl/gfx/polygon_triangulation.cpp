@@ -0,0 +1,573 @@
+#include <mbgl/gfx/polygon_triangulation.hpp>
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4244)
+#endif
+
+#include <mapbox/earcut.hpp>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include <algorithm>
+#include <limits>
+
+namespace mapbox {
+namespace util {
+template <>
+struct nth<0, mbgl::GeometryCoordinate> {
+    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.x; };
+};
+
+template <>
+struct nth<1, mbgl::GeometryCoordinate> {
+    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.y; };
+};
+} // namespace util
+} // namespace mapbox
+
+namespace mbgl {
+namespace gfx {
+
+namespace {
+
+// Polygons with at least this many holes, or with holes and at least this many vertices, are large enough
+// for the sweep line to beat earcut's hole elimination.
+constexpr std::size_t monotoneMinHoles = 16;
+constexpr std::size_t monotoneMinVertices = 1024;
+
+constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+int64_t cross(int64_t ax, int64_t ay, int64_t bx, int64_t by) {
+    return ax * by - ay * bx;
+}
+
+int sign(int64_t value) {
+    return (value > 0) - (value < 0);
+}
+
+// Number of vertices of a ring, without the closing point
+std::size_t ringSize(const GeometryCoordinates& ring) {
+    std::size_t size = ring.size();
+    if (size > 1 && ring.front() == ring.back()) {
+        size--;
+    }
+    return size;
+}
+
+// A simple convex ring turns the same way at every vertex, and its edges change direction along each axis
+// exactly twice. Collinear and repeated points are allowed.
+bool isConvex(const GeometryCoordinates& ring) {
+    const std::size_t size = ringSize(ring);
+    if (size < 3) {
+        return false;
+    }
+
+    int turn = 0;
+    int xChanges = 0;
+    int yChanges = 0;
+    int firstXSign = 0;
+    int firstYSign = 0;
+    int lastXSign = 0;
+    int lastYSign = 0;
+    int64_t firstX = 0;
+    int64_t firstY = 0;
+    int64_t lastX = 0;
+    int64_t lastY = 0;
+    bool haveEdge = false;
+
+    const auto addTurn = [&](int64_t ax, int64_t ay, int64_t bx, int64_t by) {
+        const int s = sign(cross(ax, ay, bx, by));
+        if (s != 0) {
+            if (turn != 0 && s != turn) {
+                return false;
+            }
+            turn = s;
+        }
+        return true;
+    };
+    const auto addSign = [](int s, int& first, int& last, int& changes) {
+        if (s == 0) {
+            return;
+        }
+        if (last != 0 && s != last) {
+            changes++;
+        }
+        if (first == 0) {
+            first = s;
+        }
+        last = s;
+    };
+
+    for (std::size_t i = 0; i < size; ++i) {
+        const auto& a = ring[i];
+        const auto& b = ring[(i + 1) % size];
+        const int64_t dx = b.x - a.x;
+        const int64_t dy = b.y - a.y;
+        if (dx == 0 && dy == 0) {
+            continue;
+        }
+        if (!haveEdge) {
+            firstX = dx;
+            firstY = dy;
+            haveEdge = true;
+        } else if (!addTurn(lastX, lastY, dx, dy)) {
+            return false;
+        }
+        lastX = dx;
+        lastY = dy;
+        addSign(sign(dx), firstXSign, lastXSign, xChanges);
+        addSign(sign(dy), firstYSign, lastYSign, yChanges);
+    }
+
+    if (!haveEdge || !addTurn(lastX, lastY, firstX, firstY)) {
+        return false;
+    }
+    // Close the cycle of direction changes
+    xChanges += (lastXSign != firstXSign);
+    yChanges += (lastYSign != firstYSign);
+    return turn != 0 && xChanges <= 2 && yChanges <= 2;
+}
+
+struct Vertex {
+    int32_t x;
+    int32_t y;
+    uint32_t index;
+    uint32_t prev;
+    uint32_t next;
+};
+
+// Append a triangle, wound the same way as earcut's, and drop it if it is degenerate.
+// @return Twice the area of the triangle
+int64_t addTriangle(std::vector<uint32_t>& indices, const Vertex& a, const Vertex& b, const Vertex& c) {
+    const int64_t area = cross(int64_t{b.x} - a.x, int64_t{b.y} - a.y, int64_t{c.x} - a.x, int64_t{c.y} - a.y);
+    if (area > 0) {
+        indices.insert(indices.end(), {a.index, b.index, c.index});
+    } else if (area < 0) {
+        indices.insert(indices.end(), {a.index, c.index, b.index});
+    }
+    return area < 0 ? -area : area;
+}
+
+void triangulateFan(const GeometryCoordinates& ring, std::vector<uint32_t>& indices) {
+    const auto size = static_cast<uint32_t>(ringSize(ring));
+    indices.reserve((size - 2) * 3);
+    const Vertex first{ring[0].x, ring[0].y, 0, 0, 0};
+    for (uint32_t i = 1; i + 1 < size; ++i) {
+        addTriangle(indices,
+                    first,
+                    {ring[i].x, ring[i].y, i, 0, 0},
+                    {ring[i + 1].x, ring[i + 1].y, i + 1, 0, 0});
+    }
+}
+
+/// Triangulation by decomposition into y-monotone polygons, following de Berg et al., "Computational
+/// Geometry", chapter 3. The outer ring is linked counter-clockwise and holes clockwise so that the interior
+/// is always to the left of `prev -> next`. Inconsistent input, like self-intersecting or touching rings,
+/// is detected by comparing the triangulated area with the polygon area, and reported by returning false.
+class MonotoneTriangulator {
+public:
+    bool triangulate(const GeometryCollection& polygon, std::vector<uint32_t>& indices) {
+        return link(polygon) && decompose() && triangulateFaces(indices);
+    }
+
+private:
+    enum class Type : uint8_t {
+        Start,
+        End,
+        Split,
+        Merge,
+        Regular
+    };
+
+    // Sweep order, from top to bottom and left to right on ties
+    bool above(uint32_t a, uint32_t b) const {
+        return vertices[a].y > vertices[b].y || (vertices[a].y == vertices[b].y && vertices[a].x < vertices[b].x);
+    }
+
+    int64_t turn(uint32_t a, uint32_t b, uint32_t c) const {
+        const auto &va = vertices[a], &vb = vertices[b], &vc = vertices[c];
+        return cross(int64_t{vb.x} - va.x, int64_t{vb.y} - va.y, int64_t{vc.x} - vb.x, int64_t{vc.y} - vb.y);
+    }
+
+    bool link(const GeometryCollection& polygon) {
+        std::size_t offset = 0;
+        for (std::size_t r = 0; r < polygon.size(); ++r) {
+            const auto& ring = polygon[r];
+            const auto begin = static_cast<uint32_t>(vertices.size());
+            for (std::size_t i = 0; i < ringSize(ring); ++i) {
+                if (vertices.size() > begin && ring[i] == ring[i - 1]) {
+                    continue;
+                }
+                vertices.push_back({ring[i].x, ring[i].y, static_cast<uint32_t>(offset + i), 0, 0});
+            }
+            offset += ring.size();
+
+            if (vertices.size() > begin + 1 && vertices.back().x == vertices[begin].x &&
+                vertices.back().y == vertices[begin].y) {
+                vertices.pop_back();
+            }
+            const auto end = static_cast<uint32_t>(vertices.size());
+
+            int64_t area = 0;
+            for (uint32_t i = begin; i < end; ++i) {
+                const auto& a = vertices[i];
+                const auto& b = vertices[i + 1 < end ? i + 1 : begin];
+                area += cross(a.x, a.y, b.x, b.y);
+            }
+            if (end - begin < 3 || area == 0) {
+                if (r == 0) {
+                    return false;
+                }
+                vertices.resize(begin);
+                continue;
+            }
+
+            const bool reverse = (r == 0) == (area < 0);
+            for (uint32_t i = begin; i < end; ++i) {
+                const uint32_t after = i + 1 < end ? i + 1 : begin;
+                const uint32_t before = i > begin ? i - 1 : end - 1;
+                vertices[i].next = reverse ? before : after;
+                vertices[i].prev = reverse ? after : before;
+            }
+            expectedArea += reverse ? -area : area;
+        }
+        return true;
+    }
+
+    // The edge from `e` to its next vertex, evaluated at the height of `v`
+    double edgeX(uint32_t e, const Vertex& v) const {
+        const auto& a = vertices[e];
+        const auto& b = vertices[a.next];
+        if (a.y == b.y) {
+            return std::max(a.x, b.x);
+        }
+        return a.x + (static_cast<double>(v.y) - a.y) * (b.x - a.x) / (b.y - a.y);
+    }
+
+    uint32_t edgeLeftOf(uint32_t v) const {
+        uint32_t result = none;
+        double resultX = -std::numeric_limits<double>::infinity();
+        for (const auto e : status) {
+            const double x = edgeX(e, vertices[v]);
+            if (x < vertices[v].x && x > resultX) {
+                result = e;
+                resultX = x;
+            }
+        }
+        return result;
+    }
+
+    bool removeEdge(uint32_t e) {
+        const auto it = std::find(status.begin(), status.end(), e);
+        if (it == status.end()) {
+            return false;
+        }
+        *it = status.back();
+        status.pop_back();
+        return true;
+    }
+
+    void addEdge(uint32_t e) {
+        status.push_back(e);
+        helper[e] = e;
+    }
+
+    bool connectMergeHelper(uint32_t v, uint32_t e) {
+        if (helper[e] == none) {
+            return false;
+        }
+        if (types[helper[e]] == Type::Merge) {
+            diagonals.emplace_back(v, helper[e]);
+        }
+        return true;
+    }
+
+    // Add the diagonals that split the polygon into y-monotone pieces
+    bool decompose() {
+        const auto count = static_cast<uint32_t>(vertices.size());
+        types.resize(count);
+        helper.assign(count, none);
+        std::vector<uint32_t> order(count);
+        for (uint32_t v = 0; v < count; ++v) {
+            const auto& vertex = vertices[v];
+            const bool prevBelow = above(v, vertex.prev);
+            const bool nextBelow = above(v, vertex.next);
+            const bool convex = turn(vertex.prev, v, vertex.next) > 0;
+            if (prevBelow && nextBelow) {
+                types[v] = convex ? Type::Start : Type::Split;
+            } else if (!prevBelow && !nextBelow) {
+                types[v] = convex ? Type::End : Type::Merge;
+            } else {
+                types[v] = Type::Regular;
+            }
+            order[v] = v;
+        }
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return above(a, b); });
+
+        for (const auto v : order) {
+            // The edge ending at `v`
+            const uint32_t prevEdge = vertices[v].prev;
+            switch (types[v]) {
+                case Type::Start:
+                    addEdge(v);
+                    break;
+                case Type::End:
+                    if (!connectMergeHelper(v, prevEdge) || !removeEdge(prevEdge)) {
+                        return false;
+                    }
+                    break;
+                case Type::Split: {
+                    const auto left = edgeLeftOf(v);
+                    if (left == none || helper[left] == none) {
+                        return false;
+                    }
+                    diagonals.emplace_back(v, helper[left]);
+                    helper[left] = v;
+                    addEdge(v);
+                    break;
+                }
+                case Type::Merge: {
+                    if (!connectMergeHelper(v, prevEdge) || !removeEdge(prevEdge)) {
+                        return false;
+                    }
+                    const auto left = edgeLeftOf(v);
+                    if (left == none || !connectMergeHelper(v, left)) {
+                        return false;
+                    }
+                    helper[left] = v;
+                    break;
+                }
+                case Type::Regular:
+                    if (above(vertices[v].prev, v)) {
+                        // The boundary goes down and the interior is to the right
+                        if (!connectMergeHelper(v, prevEdge) || !removeEdge(prevEdge)) {
+                            return false;
+                        }
+                        addEdge(v);
+                    } else {
+                        const auto left = edgeLeftOf(v);
+                        if (left == none || !connectMergeHelper(v, left)) {
+                            return false;
+                        }
+                        helper[left] = v;
+                    }
+                    break;
+            }
+        }
+        return true;
+    }
+
+    struct Neighbor {
+        uint32_t vertex;
+        bool interior;
+        bool visited;
+    };
+
+    // Counter-clockwise order of directions, starting from the positive x axis
+    bool angleLess(uint32_t origin, uint32_t a, uint32_t b) const {
+        const int64_t ax = int64_t{vertices[a].x} - vertices[origin].x;
+        const int64_t ay = int64_t{vertices[a].y} - vertices[origin].y;
+        const int64_t bx = int64_t{vertices[b].x} - vertices[origin].x;
+        const int64_t by = int64_t{vertices[b].y} - vertices[origin].y;
+        const bool aLower = ay < 0 || (ay == 0 && ax < 0);
+        const bool bLower = by < 0 || (by == 0 && bx < 0);
+        if (aLower != bLower) {
+            return bLower;
+        }
+        return cross(ax, ay, bx, by) > 0;
+    }
+
+    // Walk the faces of the polygon split by the diagonals, each of them y-monotone, and triangulate them
+    bool triangulateFaces(std::vector<uint32_t>& indices) {
+        const auto count = static_cast<uint32_t>(vertices.size());
+        std::vector<std::vector<Neighbor>> neighbors(count);
+        for (uint32_t v = 0; v < count; ++v) {
+            neighbors[v].push_back({vertices[v].next, true, false});
+            neighbors[v].push_back({vertices[v].prev, false, false});
+        }
+        for (const auto& [a, b] : diagonals) {
+            neighbors[a].push_back({b, true, false});
+            neighbors[b].push_back({a, true, false});
+        }
+        for (uint32_t v = 0; v < count; ++v) {
+            std::sort(neighbors[v].begin(), neighbors[v].end(), [&](const Neighbor& a, const Neighbor& b) {
+                return angleLess(v, a.vertex, b.vertex);
+            });
+        }
+
+        const auto find = [&](uint32_t from, uint32_t to) -> std::size_t {
+            const auto& list = neighbors[from];
+            for (std::size_t i = 0; i < list.size(); ++i) {
+                if (list[i].vertex == to) {
+                    return i;
+                }
+            }
+            return list.size();
+        };
+
+        indices.reserve((count + 2 * diagonals.size()) * 3);
+        std::vector<uint32_t> face;
+        for (uint32_t start = 0; start < count; ++start) {
+            for (auto& first : neighbors[start]) {
+                if (!first.interior || first.visited) {
+                    continue;
+                }
+                // Keep the face on the left by taking the first edge clockwise from the one we arrived by
+                face.clear();
+                uint32_t from = start;
+                Neighbor* edge = &first;
+                while (!edge->visited) {
+                    if (!edge->interior) {
+                        return false;
+                    }
+                    edge->visited = true;
+                    face.push_back(from);
+                    const uint32_t to = edge->vertex;
+                    auto& list = neighbors[to];
+                    const auto back = find(to, from);
+                    if (back == list.size()) {
+                        return false;
+                    }
+                    edge = &list[back == 0 ? list.size() - 1 : back - 1];
+                    from = to;
+                }
+                if (from != start) {
+                    return false;
+                }
+                triangulateMonotone(face, indices);
+            }
+        }
+        // Overlapping or missing triangles change the area
+        return triangulatedArea == expectedArea;
+    }
+
+    void triangulateMonotone(const std::vector<uint32_t>& face, std::vector<uint32_t>& indices) {
+        const auto size = face.size();
+        if (size < 3) {
+            return;
+        }
+        const auto add = [&](uint32_t a, uint32_t b, uint32_t c) {
+            triangulatedArea += addTriangle(indices, vertices[a], vertices[b], vertices[c]);
+        };
+        if (size == 3) {
+            add(face[0], face[1], face[2]);
+            return;
+        }
+
+        // Going forward from the top follows the left chain down to the bottom
+        std::size_t top = 0;
+        std::size_t bottom = 0;
+        for (std::size_t i = 1; i < size; ++i) {
+            if (above(face[i], face[top])) top = i;
+            if (above(face[bottom], face[i])) bottom = i;
+        }
+        sorted.clear();
+        for (std::size_t i = top;; i = (i + 1) % size) {
+            sorted.push_back({face[i], true});
+            if (i == bottom) break;
+        }
+        for (std::size_t i = (bottom + 1) % size; i != top; i = (i + 1) % size) {
+            sorted.push_back({face[i], false});
+        }
+        std::sort(sorted.begin(), sorted.end(), [&](const auto& a, const auto& b) { return above(a.first, b.first); });
+
+        stack.assign({sorted[0], sorted[1]});
+        for (std::size_t j = 2; j + 1 < size; ++j) {
+            const auto current = sorted[j];
+            if (current.second != stack.back().second) {
+                // Opposite chain, everything on the stack is visible
+                while (stack.size() > 1) {
+                    const auto a = stack.back().first;
+                    stack.pop_back();
+                    add(current.first, a, stack.back().first);
+                }
+                stack.assign({sorted[j - 1], current});
+            } else {
+                auto last = stack.back();
+                stack.pop_back();
+                // Cut off the triangles whose diagonal is inside the polygon
+                while (!stack.empty()) {
+                    const auto t = turn(stack.back().first, last.first, current.first);
+                    if (current.second ? t <= 0 : t >= 0) {
+                        break;
+                    }
+                    add(current.first, last.first, stack.back().first);
+                    last = stack.back();
+                    stack.pop_back();
+                }
+                stack.push_back(last);
+                stack.push_back(current);
+            }
+        }
+        const auto bottomVertex = sorted[size - 1].first;
+        while (stack.size() > 1) {
+            const auto a = stack.back().first;
+            stack.pop_back();
+            add(bottomVertex, a, stack.back().first);
+        }
+    }
+
+    std::vector<Vertex> vertices;
+    std::vector<Type> types;
+    std::vector<uint32_t> helper;
+    std::vector<uint32_t> status;
+    std::vector<std::pair<uint32_t, uint32_t>> diagonals;
+    std::vector<std::pair<uint32_t, bool>> sorted;
+    std::vector<std::pair<uint32_t, bool>> stack;
+    int64_t expectedArea = 0;
+    int64_t triangulatedArea = 0;
+};
+
+} // namespace
+
+TriangulationStrategy selectTriangulationStrategy(const GeometryCollection& polygon) {
+    if (polygon.size() == 1 && isConvex(polygon[0])) {
+        return TriangulationStrategy::Fan;
+    }
+
+    const std::size_t holes = polygon.empty() ? 0 : polygon.size() - 1;
+    if (holes >= monotoneMinHoles) {
+        return TriangulationStrategy::Monotone;
+    }
+    if (holes > 0) {
+        std::size_t vertexCount = 0;
+        for (const auto& ring : polygon) {
+            vertexCount += ring.size();
+        }
+        if (vertexCount >= monotoneMinVertices) {
+            return TriangulationStrategy::Monotone;
+        }
+    }
+    return TriangulationStrategy::Earcut;
+}
+
+std::vector<uint32_t> triangulatePolygon(const GeometryCollection& polygon) {
+    return triangulatePolygon(polygon, selectTriangulationStrategy(polygon));
+}
+
+std::vector<uint32_t> triangulatePolygon(const GeometryCollection& polygon, TriangulationStrategy strategy) {
+    std::vector<uint32_t> indices;
+    switch (strategy) {
+        case TriangulationStrategy::Fan:
+            if (polygon.size() == 1 && isConvex(polygon[0])) {
+                triangulateFan(polygon[0], indices);
+                return indices;
+            }
+            break;
+        case TriangulationStrategy::Monotone:
+            if (MonotoneTriangulator().triangulate(polygon, indices)) {
+                return indices;
+            }
+            indices.clear();
+            break;
+        case TriangulationStrategy::Earcut:
+            break;
+    }
+    return mapbox::earcut(polygon);
+}
+
+} // namespace gfx
+} // namespace mbgl
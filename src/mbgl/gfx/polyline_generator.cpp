@@ -7,8 +7,10 @@
 #include <mbgl/gfx/drawable_builder_impl.hpp>
 #include <mbgl/gfx/drawable_impl.hpp>
 
+#include <cmath>
 #include <memory>
 #include <numbers>
+#include <vector>
 
 using namespace std::numbers;
 
@@ -44,6 +46,48 @@ constexpr float LINE_DISTANCE_SCALE = 1.0 / 2.0;
 // The maximum line distance, in tile units, that fits in the buffer.
 constexpr auto MAX_LINE_DISTANCE = static_cast<float>((1u << LINE_DISTANCE_BUFFER_BITS) / LINE_DISTANCE_SCALE);
 
+// Length and normal of the segment from each coordinate of a line to the next one, stored as separate
+// arrays so that they're computed in a single branch-free loop the compiler can vectorize, before any
+// vertex is emitted.
+struct SegmentTable {
+    std::vector<double> deltaX;
+    std::vector<double> deltaY;
+    std::vector<double> length;
+    std::vector<double> normalX;
+    std::vector<double> normalY;
+
+    void compute(const GeometryCoordinates& coordinates, std::size_t first, std::size_t len, bool closed) {
+        const std::size_t count = len - first;
+        deltaX.resize(count);
+        deltaY.resize(count);
+        length.resize(count);
+        normalX.resize(count);
+        normalY.resize(count);
+
+        // The last coordinate of a closed line continues to the second one, that of an open line has no segment.
+        for (std::size_t k = 0; k < count; ++k) {
+            const std::size_t i = first + k;
+            const std::size_t next = i + 1 < len ? i + 1 : (closed ? first + 1 : i);
+            deltaX[k] = coordinates[next].x - coordinates[i].x;
+            deltaY[k] = coordinates[next].y - coordinates[i].y;
+        }
+
+        // Same operations as `util::dist` and `util::perp(util::unit(...))`, so the results are identical
+        for (std::size_t k = 0; k < count; ++k) {
+            const double dx = deltaX[k];
+            const double dy = deltaY[k];
+            const double segmentLength = std::sqrt(dx * dx + dy * dy);
+            const double scale = segmentLength == 0 ? 1.0 : 1 / segmentLength;
+            length[k] = segmentLength;
+            normalX[k] = -(dy * scale);
+            normalY[k] = dx * scale;
+        }
+    }
+};
+
+// Reused across the features of a tile
+thread_local SegmentTable segmentTable;
+
 } // namespace
 
 double PolylineGeneratorDistances::scaleToMaxLineDistance(double tileDistance) const {
@@ -135,6 +179,13 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
         nextNormal = util::perp(util::unit(convertPoint<double>(firstCoordinate - *currentCoordinate)));
     }
 
+    // First pass, the geometry of every segment
+    SegmentTable& table = segmentTable;
+    table.compute(coordinates, first, len, options.type == FeatureType::Polygon);
+
+    // Index in `table` of the segment ending at `prevCoordinate`, if that is still the original coordinate
+    std::optional<std::size_t> prevSegment;
+
     const std::size_t startVertex = vertices.elements();
     std::vector<TriangleElement> triangleStore;
 
@@ -148,7 +199,9 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
         vertices.reserve(1 << 10);
     }
 
+    // Second pass, emit the joins and caps
     for (std::size_t i = first; i < len; ++i) {
+        const std::size_t segment = i - first;
         if (options.type == FeatureType::Polygon && i == len - 1) {
             // if the line is closed, we treat the last vertex like the first
             nextCoordinate = coordinates[first + 1];
@@ -177,8 +230,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
         // Calculate the normal towards the next vertex in this line. In case
         // there is no next vertex, pretend that the line is continuing
         // straight, meaning that we are just using the previous normal.
-        nextNormal = nextCoordinate ? util::perp(util::unit(convertPoint<double>(*nextCoordinate - *currentCoordinate)))
-                                    : prevNormal;
+        nextNormal = nextCoordinate ? Point<double>(table.normalX[segment], table.normalY[segment]) : prevNormal;
 
         // If we still don't have a previous normal, this is the beginning of a
         // non-closed line, so we're doing a straight "join".
@@ -222,7 +274,8 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
         const bool isSharpCorner = cosHalfAngle < COS_HALF_SHARP_CORNER && prevCoordinate && nextCoordinate;
 
         if (isSharpCorner && i > first) {
-            const auto prevSegmentLength = util::dist<double>(*currentCoordinate, *prevCoordinate);
+            const auto prevSegmentLength = prevSegment ? table.length[*prevSegment]
+                                                       : util::dist<double>(*currentCoordinate, *prevCoordinate);
             if (prevSegmentLength > 2.0 * sharpCornerOffset) {
                 GeometryCoordinate newPrevVertex = *currentCoordinate -
                                                    convertPoint<int16_t>(util::round(
@@ -239,6 +292,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  triangleStore,
                                  options.clipDistances);
                 prevCoordinate = newPrevVertex;
+                prevSegment.reset();
             }
         }
 
@@ -277,7 +331,10 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
         }
 
         // Calculate how far along the line the currentVertex is
-        if (prevCoordinate) distance += util::dist<double>(*currentCoordinate, *prevCoordinate);
+        if (prevCoordinate) {
+            distance += prevSegment ? table.length[*prevSegment]
+                                    : util::dist<double>(*currentCoordinate, *prevCoordinate);
+        }
 
         if (middleVertex && currentJoin == style::LineJoinType::Miter) {
             joinNormal = joinNormal * miterLength;
@@ -506,8 +563,10 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
             }
         }
 
+        prevSegment = segment;
+
         if (isSharpCorner && i < len - 1) {
-            const auto nextSegmentLength = util::dist<double>(*currentCoordinate, *nextCoordinate);
+            const auto nextSegmentLength = table.length[segment];
             if (nextSegmentLength > 2 * sharpCornerOffset) {
                 GeometryCoordinate newCurrentVertex = *currentCoordinate +
                                                       convertPoint<int16_t>(util::round(
@@ -524,6 +583,7 @@ void PolylineGenerator<PLV, PS>::generate(const GeometryCoordinates& coordinates
                                  triangleStore,
                                  options.clipDistances);
                 currentCoordinate = newCurrentVertex;
+                prevSegment.reset();
             }
         }
 
@@ -34,6 +34,9 @@ RenderingStats& RenderingStats::operator+=(const RenderingStats& r) {
     numFrames += r.numFrames;
     numDrawCalls += r.numDrawCalls;
     totalDrawCalls += r.totalDrawCalls;
+    numDrawableBatches += r.numDrawableBatches;
+    numIndirectDrawCalls += r.numIndirectDrawCalls;
+    numCulledDrawables += r.numCulledDrawables;
     numCreatedTextures += r.numCreatedTextures;
     numActiveTextures += r.numActiveTextures;
     numTextureBindings += r.numTextureBindings;
@@ -50,6 +53,8 @@ RenderingStats& RenderingStats::operator+=(const RenderingStats& r) {
     indexUpdateBytes += r.indexUpdateBytes;
     numVertexBuffers += r.numVertexBuffers;
     vertexUpdateBytes += r.vertexUpdateBytes;
+    vertexPartialUpdates += r.vertexPartialUpdates;
+    vertexPartialUpdateBytes += r.vertexPartialUpdateBytes;
     numUniformBuffers += r.numUniformBuffers;
     numUniformUpdates += r.numUniformUpdates;
     uniformUpdateBytes += r.uniformUpdateBytes;
@@ -80,6 +85,9 @@ std::string RenderingStats::toString(std::string_view sep) const {
     optionalStatLine(ss, numFrames, "numFrames", sep);
     optionalStatLine(ss, numDrawCalls, "numDrawCalls", sep);
     optionalStatLine(ss, totalDrawCalls, "totalDrawCalls", sep);
+    optionalStatLine(ss, numDrawableBatches, "numDrawableBatches", sep);
+    optionalStatLine(ss, numIndirectDrawCalls, "numIndirectDrawCalls", sep);
+    optionalStatLine(ss, numCulledDrawables, "numCulledDrawables", sep);
     optionalStatLine(ss, numCreatedTextures, "numCreatedTextures", sep);
     optionalStatLine(ss, numActiveTextures, "numActiveTextures", sep);
     optionalStatLine(ss, numTextureBindings, "numTextureBindings", sep);
@@ -96,6 +104,8 @@ std::string RenderingStats::toString(std::string_view sep) const {
     optionalStatLine(ss, indexUpdateBytes, "indexUpdateBytes", sep);
     optionalStatLine(ss, numVertexBuffers, "numVertexBuffers", sep);
     optionalStatLine(ss, vertexUpdateBytes, "vertexUpdateBytes", sep);
+    optionalStatLine(ss, vertexPartialUpdates, "vertexPartialUpdates", sep);
+    optionalStatLine(ss, vertexPartialUpdateBytes, "vertexPartialUpdateBytes", sep);
     optionalStatLine(ss, numUniformBuffers, "numUniformBuffers", sep);
     optionalStatLine(ss, numUniformUpdates, "numUniformUpdates", sep);
     optionalStatLine(ss, uniformUpdateBytes, "uniformUpdateBytes", sep);
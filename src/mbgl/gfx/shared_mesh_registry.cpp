@@ -0,0 +1,85 @@
+#include <mbgl/gfx/shared_mesh_registry.hpp>
+
+#include <mbgl/gfx/index_vector.hpp>
+#include <mbgl/gfx/vertex_vector.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace mbgl {
+namespace gfx {
+
+namespace {
+
+std::string_view contentsOf(const VertexVectorBase& vertices) {
+    return {static_cast<const char*>(vertices.getRawData()), vertices.getRawSize() * vertices.getRawCount()};
+}
+
+std::string_view contentsOf(const IndexVectorBase& indexes) {
+    return {reinterpret_cast<const char*>(indexes.data()), indexes.bytes()};
+}
+
+bool sameLayout(const VertexVectorBase& a, const VertexVectorBase& b) {
+    return a.getRawSize() == b.getRawSize();
+}
+
+bool sameLayout(const IndexVectorBase&, const IndexVectorBase&) {
+    return true;
+}
+
+} // namespace
+
+VertexVectorBasePtr SharedMeshRegistry::share(VertexVectorBasePtr candidate) {
+    if (!candidate || !candidate->getRawCount()) {
+        return candidate;
+    }
+    const auto contents = contentsOf(*candidate);
+    return share(vertices, std::move(candidate), contents);
+}
+
+IndexVectorBasePtr SharedMeshRegistry::share(IndexVectorBasePtr candidate) {
+    if (!candidate || !candidate->elements()) {
+        return candidate;
+    }
+    const auto contents = contentsOf(*candidate);
+    return share(indexes, std::move(candidate), contents);
+}
+
+std::size_t SharedMeshRegistry::size() const {
+    const auto live = [](const auto& entry) {
+        return !entry.second.expired();
+    };
+    return static_cast<std::size_t>(std::ranges::count_if(vertices.map, live) +
+                                    std::ranges::count_if(indexes.map, live));
+}
+
+template <typename T>
+std::shared_ptr<T> SharedMeshRegistry::share(Entries<T>& entries,
+                                             std::shared_ptr<T>&& candidate,
+                                             const std::string_view contents) {
+    const auto hash = std::hash<std::string_view>()(contents);
+
+    const auto [first, last] = entries.map.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+        if (auto existing = it->second.lock()) {
+            if (sameLayout(*existing, *candidate) && contentsOf(*existing) == contents) {
+                return existing;
+            }
+        }
+    }
+
+    if (entries.map.size() >= entries.pruneSize) {
+        prune(entries);
+    }
+    entries.map.emplace(hash, candidate);
+    return std::move(candidate);
+}
+
+template <typename T>
+void SharedMeshRegistry::prune(Entries<T>& entries) {
+    std::erase_if(entries.map, [](const auto& entry) { return entry.second.expired(); });
+    entries.pruneSize = std::max<std::size_t>(64, 2 * entries.map.size());
+}
+
+} // namespace gfx
+} // namespace mbgl
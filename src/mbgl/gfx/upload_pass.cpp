@@ -0,0 +1,48 @@
+#include <mbgl/gfx/upload_pass.hpp>
+
+#include <mbgl/gfx/context.hpp>
+#include <mbgl/gfx/rendering_stats.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace mbgl {
+namespace gfx {
+
+void UploadPass::updateVertexBufferRanges(VertexBufferResource& resource, VertexVectorBase& vec, bool mergeRanges) {
+    const auto* data = static_cast<const std::uint8_t*>(vec.getRawData());
+    const auto stride = vec.getRawSize();
+    const auto& ranges = vec.getModifiedRanges();
+
+    if (vec.isFullyModified() || ranges.empty()) {
+        updateVertexBufferResource(resource, data, vec.getRawCount() * stride, /*offset=*/0);
+    } else {
+        auto& stats = getContext().renderingStats();
+        const auto update = [&](std::size_t begin, std::size_t end) {
+            const auto offset = begin * stride;
+            const auto size = (end - begin) * stride;
+            updateVertexBufferResource(resource, data + offset, size, offset);
+            stats.vertexPartialUpdates++;
+            stats.vertexPartialUpdateBytes += size;
+        };
+
+        if (mergeRanges) {
+            std::size_t begin = ranges.front().first;
+            std::size_t end = ranges.front().second;
+            for (const auto& range : ranges) {
+                begin = std::min(begin, range.first);
+                end = std::max(end, range.second);
+            }
+            update(begin, end);
+        } else {
+            for (const auto& [begin, end] : ranges) {
+                update(begin, end);
+            }
+        }
+    }
+
+    vec.resetModifiedRanges();
+}
+
+} // namespace gfx
+} // namespace mbgl
@@ -56,7 +56,7 @@ public:
     template <class Vertex>
     void updateVertexBuffer(VertexBuffer<Vertex>& buffer, const VertexVector<Vertex>& v) {
         assert(v.elements() == buffer.elements);
-        updateVertexBufferResource(buffer.getResource(), v.data(), v.bytes());
+        updateVertexBufferResource(buffer.getResource(), v.data(), v.bytes(), /*offset=*/0);
     }
 
     template <class DrawMode>
@@ -88,7 +88,16 @@ protected:
                                                                              std::size_t size,
                                                                              BufferUsageType,
                                                                              bool persistent = false) = 0;
-    virtual void updateVertexBufferResource(VertexBufferResource&, const void* data, std::size_t size) = 0;
+    virtual void updateVertexBufferResource(VertexBufferResource&,
+                                            const void* data,
+                                            std::size_t size,
+                                            std::size_t offset) = 0;
+
+    /// Update a buffer created from a vertex vector, limited to the element ranges modified since the last update
+    /// unless the vector was rebuilt.
+    /// @param mergeRanges Update a single range covering all the modified ones, for backends where each update
+    /// has a fixed cost comparable to a full update.
+    void updateVertexBufferRanges(VertexBufferResource&, VertexVectorBase&, bool mergeRanges = false);
 
 public:
     virtual std::unique_ptr<IndexBufferResource> createIndexBufferResource(const void* data,
@@ -0,0 +1,72 @@
+#include <mbgl/gfx/vector_pool.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace mbgl {
+namespace gfx {
+
+namespace {
+
+std::atomic_size_t acquiredCount{0};
+std::atomic_size_t reusedCount{0};
+std::atomic_size_t returnedCount{0};
+std::atomic_size_t retainedBytes{0};
+
+std::mutex& registryMutex() {
+    static auto* mutex = new std::mutex();
+    return *mutex;
+}
+
+// The pools are leaked, and so is the list of them
+std::vector<void (*)()>& registeredPools() {
+    static auto* pools = new std::vector<void (*)()>();
+    return *pools;
+}
+
+} // namespace
+
+VectorPoolStats getVectorPoolStats() {
+    return {acquiredCount, reusedCount, returnedCount, retainedBytes};
+}
+
+void clearVectorPools() {
+    std::vector<void (*)()> pools;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        pools = registeredPools();
+    }
+    for (const auto clear : pools) {
+        clear();
+    }
+}
+
+namespace detail {
+
+void registerVectorPool(void (*clear)()) {
+    std::lock_guard<std::mutex> lock(registryMutex());
+    registeredPools().push_back(clear);
+}
+
+void recordVectorPoolAcquire(bool reused, std::size_t bytes) {
+    acquiredCount++;
+    if (reused) {
+        reusedCount++;
+        retainedBytes -= bytes;
+    }
+}
+
+void recordVectorPoolReturn(std::size_t bytes) {
+    returnedCount++;
+    retainedBytes += bytes;
+}
+
+void recordVectorPoolFree(std::size_t bytes) {
+    retainedBytes -= bytes;
+}
+
+} // namespace detail
+
+} // namespace gfx
+} // namespace mbgl
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace mbgl {
+namespace gfx {
+
+struct VectorPoolStats {
+    /// Number of sized requests made to the pools
+    std::size_t acquired = 0;
+    /// Number of requests served from pooled storage instead of a new allocation
+    std::size_t reused = 0;
+    /// Number of vectors whose storage was returned to a pool
+    std::size_t returned = 0;
+    /// Bytes of storage currently held by the pools
+    std::size_t retainedBytes = 0;
+};
+
+/// Aggregated counters of all the vector pools
+VectorPoolStats getVectorPoolStats();
+
+/// Free the storage held by all the vector pools, such as when the renderer is asked to reduce its memory use
+void clearVectorPools();
+
+namespace detail {
+void registerVectorPool(void (*clear)());
+void recordVectorPoolAcquire(bool reused, std::size_t bytes);
+void recordVectorPoolReturn(std::size_t bytes);
+void recordVectorPoolFree(std::size_t bytes);
+} // namespace detail
+
+/// Recycles the storage of vertex and index vectors between bucket builds.
+///
+/// Buckets are built on worker threads but released on the render thread once uploaded, or when their tile
+/// leaves the cache, so a single pool per element type is shared between threads. Storage is only pooled
+/// above a minimum size and up to a cap, and is freed by `clearVectorPools()` under memory pressure.
+template <class T>
+class VectorPool {
+public:
+    static constexpr std::size_t minPooledBytes = 4 * 1024;
+    static constexpr std::size_t maxRetainedBytes = 8 * 1024 * 1024;
+    static constexpr std::size_t maxRetainedVectors = 64;
+
+    static VectorPool& get() {
+        // Leaked so that vectors destroyed during shutdown can still return their storage
+        static auto* pool = [] {
+            detail::registerVectorPool([] { get().clear(); });
+            return new VectorPool();
+        }();
+        return *pool;
+    }
+
+    /// Get an empty vector with room for at least `count` elements, reusing the smallest pooled
+    /// storage that fits.
+    std::vector<T> acquire(std::size_t count) {
+        std::vector<T> result;
+        bool reused = false;
+        if (count * sizeof(T) >= minPooledBytes) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto best = pooled.end();
+            for (auto it = pooled.begin(); it != pooled.end(); ++it) {
+                if (it->capacity() >= count && (best == pooled.end() || it->capacity() < best->capacity())) {
+                    best = it;
+                }
+            }
+            if (best != pooled.end()) {
+                result = std::move(*best);
+                *best = std::move(pooled.back());
+                pooled.pop_back();
+                retainedBytes -= result.capacity() * sizeof(T);
+                reused = true;
+            }
+        }
+        if (!reused) {
+            result.reserve(count);
+        }
+        detail::recordVectorPoolAcquire(reused, reused ? result.capacity() * sizeof(T) : 0);
+        return result;
+    }
+
+    /// Return the storage of a vector that is no longer needed.
+    /// Storage that is too small, or doesn't fit in the pool, is freed.
+    void release(std::vector<T> storage) {
+        const auto bytes = storage.capacity() * sizeof(T);
+        if (bytes < minPooledBytes || bytes > maxRetainedBytes) {
+            return;
+        }
+        storage.clear();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (pooled.size() >= maxRetainedVectors || retainedBytes + bytes > maxRetainedBytes) {
+                return;
+            }
+            pooled.push_back(std::move(storage));
+            retainedBytes += bytes;
+        }
+        detail::recordVectorPoolReturn(bytes);
+    }
+
+    /// Free all pooled storage
+    void clear() {
+        std::vector<std::vector<T>> freed;
+        std::lock_guard<std::mutex> lock(mutex);
+        freed.swap(pooled);
+        detail::recordVectorPoolFree(retainedBytes);
+        retainedBytes = 0;
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return pooled.size();
+    }
+
+private:
+    VectorPool() = default;
+
+    mutable std::mutex mutex;
+    std::vector<std::vector<T>> pooled;
+    std::size_t retainedBytes = 0;
+};
+
+} // namespace gfx
+} // namespace mbgl
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <mbgl/gfx/vector_pool.hpp>
 #include <mbgl/util/ignore.hpp>
 #include <mbgl/util/monotonic_timer.hpp>
 
+#include <algorithm>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace mbgl {
@@ -20,7 +23,9 @@ public:
     VertexVectorBase(VertexVectorBase&& other)
         : buffer(std::move(other.buffer)),
           dirty(other.dirty),
-          released(other.released) {}
+          released(other.released),
+          modifiedRanges(std::move(other.modifiedRanges)),
+          fullyModified(other.fullyModified) {}
     virtual ~VertexVectorBase() = default;
 
     virtual const void* getRawData() const = 0;
@@ -43,11 +48,57 @@ public:
     // Indicates that the owner/producer will not modify this again
     bool isReleased() const { return released; }
 
+    using ModifiedRanges = std::vector<std::pair<std::size_t, std::size_t>>;
+
+    /// Element ranges `[first, second)` modified in place since the last `resetModifiedRanges`
+    const ModifiedRanges& getModifiedRanges() const { return modifiedRanges; }
+
+    /// Whether the vector was resized or rebuilt since the last `resetModifiedRanges`, so any buffer made from it
+    /// must be updated entirely
+    bool isFullyModified() const { return fullyModified; }
+
+    /// Called once a buffer reflects the current contents
+    void resetModifiedRanges() {
+        modifiedRanges.clear();
+        fullyModified = false;
+    }
+
 protected:
+    void markModified(std::size_t begin, std::size_t end) {
+        if (fullyModified || begin >= end) {
+            return;
+        }
+        if (!modifiedRanges.empty() && begin <= modifiedRanges.back().second &&
+            modifiedRanges.back().first <= end) {
+            // Overlaps or touches the most recent range
+            auto& last = modifiedRanges.back();
+            last = {std::min(last.first, begin), std::max(last.second, end)};
+        } else if (modifiedRanges.size() < maxModifiedRanges) {
+            modifiedRanges.emplace_back(begin, end);
+        } else {
+            // Too fragmented, fall back to a single range covering all of them
+            for (const auto& range : modifiedRanges) {
+                begin = std::min(begin, range.first);
+                end = std::max(end, range.second);
+            }
+            modifiedRanges.assign(1, {begin, end});
+        }
+    }
+
+    void markFullyModified() {
+        fullyModified = true;
+        modifiedRanges.clear();
+    }
+
+    static constexpr std::size_t maxModifiedRanges = 16;
+
     std::unique_ptr<VertexBufferBase> buffer;
     bool dirty = true;
     bool released = false;
 
+    ModifiedRanges modifiedRanges;
+    bool fullyModified = true;
+
     std::chrono::duration<double> lastModified = util::MonotonicTimer::now();
 };
 using VertexVectorBasePtr = std::shared_ptr<VertexVectorBase>;
@@ -64,27 +115,50 @@ public:
     VertexVector(VertexVector<V>&& other)
         : VertexVectorBase(static_cast<VertexVectorBase&&>(other)),
           v(std::move(other.v)) {}
-    ~VertexVector() override = default;
+    ~VertexVector() override { VectorPool<Vertex>::get().release(std::move(v)); }
 
     template <class... Args>
     void emplace_back(Args&&... args) {
         assert(!released);
         util::ignore({(v.emplace_back(std::forward<Args>(args)), 0)...});
         dirty = true;
+        markFullyModified();
     }
 
     void extend(std::size_t n, const Vertex& val) {
         assert(!released);
         v.resize(v.size() + n, val);
         dirty = true;
+        markFullyModified();
+    }
+
+    /// Append `n` default vertices to be written by the caller through the returned pointer, which stays valid until
+    /// the vector grows again. Distinct ranges of it can be written from different threads.
+    Vertex* append(std::size_t n) {
+        assert(!released);
+        const auto offset = v.size();
+        v.resize(offset + n);
+        dirty = true;
+        markFullyModified();
+        return v.data() + offset;
     }
 
     Vertex& at(std::size_t n) {
         assert(n < v.size());
         assert(!released);
         dirty = true;
+        markModified(n, n + 1);
         return v.at(n);
     }
+
+    /// Overwrite the elements `[begin, end)` with the same value
+    void fill(std::size_t begin, std::size_t end, const Vertex& val) {
+        assert(begin <= end && end <= v.size());
+        assert(!released);
+        std::fill(v.begin() + begin, v.begin() + end, val);
+        dirty = true;
+        markModified(begin, end);
+    }
     const Vertex& at(std::size_t n) const {
         assert(n < v.size());
         return v.at(n);
@@ -98,16 +172,24 @@ public:
 
     void clear() {
         dirty = true;
+        markFullyModified();
         v.clear();
     }
 
-    void reserve(std::size_t count) { v.reserve(count); }
+    /// Reserve room for `count` elements, taking pooled storage if nothing has been allocated yet
+    void reserve(std::size_t count) {
+        if (v.capacity() == 0 && count > 0) {
+            v = VectorPool<Vertex>::get().acquire(count);
+        } else {
+            v.reserve(count);
+        }
+    }
 
     /// Indicate that this shared vertex vector instance will no longer be updated.
     void release() {
         // If we've already created a buffer, we don't need the raw data any more.
         if (buffer) {
-            v.clear();
+            VectorPool<Vertex>::get().release(std::exchange(v, {}));
         }
         released = true;
     }
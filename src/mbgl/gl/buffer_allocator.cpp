@@ -1,4 +1,5 @@
 #include <mbgl/gl/buffer_allocator.hpp>
+#include <mbgl/gl/buffer_storage_extension.hpp>
 #include <mbgl/gl/defines.hpp>
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/uniform_buffer_gl.hpp>
@@ -17,6 +18,9 @@ namespace gl {
 /// As UBOs fill up, they are marked 'in-flight' and placed in a waiting area for references to
 /// be released. Once all references to a UBO are gone (Or the buffer is defragmented), the
 /// buffer is recycled.
+/// Where buffer storage is available, each UBO is mapped persistently when it's created. The
+/// monotonic writes and fenced recycling above already keep the CPU from writing memory the GPU
+/// may still read, so writes become a copy into the mapping instead of a map and unmap each.
 /// @tparam OwnerClass The class type having allocations managed by this allocator.
 /// @tparam type GL_UNIFORM_BUFFER, no other type is currently valid.
 /// @tparam PageSizeKB Size of underlying UBO allocations, in KB. 8KB has been observed to work well.
@@ -89,11 +93,28 @@ public:
         // If true, the buffer's memory has been released to compact memory
         bool reclaimed = false;
 
+        // Persistent, coherent mapping of the whole buffer, if available
+        std::byte* mapped = nullptr;
+
         Buffer(BufferAllocator& allocator_)
             : allocator(allocator_) {
             refs.reserve(InitialBufferSize);
             MBGL_CHECK_ERROR(glGenBuffers(1, &id));
             MBGL_CHECK_ERROR(glBindBuffer(type, id));
+
+            if (allocator.bufferStorage) {
+                constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                MBGL_CHECK_ERROR(allocator.bufferStorage->bufferStorage(type, PageSize, nullptr, flags));
+                mapped = static_cast<std::byte*>(MBGL_CHECK_ERROR(glMapBufferRange(type, 0, PageSize, flags)));
+                if (mapped) {
+                    return;
+                }
+
+                // Storage is immutable, start over with a regular buffer
+                MBGL_CHECK_ERROR(glDeleteBuffers(1, &id));
+                MBGL_CHECK_ERROR(glGenBuffers(1, &id));
+                MBGL_CHECK_ERROR(glBindBuffer(type, id));
+            }
             MBGL_CHECK_ERROR(glBufferData(type, PageSize, nullptr, GL_DYNAMIC_DRAW));
         }
 
@@ -108,6 +129,8 @@ public:
             refs.clear();
             refs = decltype(refs)();
 
+            // Deleting the buffer also unmaps it
+            mapped = nullptr;
             if (id != 0) {
                 glDeleteBuffers(1, &id);
                 id = 0;
@@ -122,8 +145,10 @@ public:
               id(rhs.id),
               tombstones(rhs.tombstones),
               occupancyBytes(rhs.occupancyBytes),
-              bufferIndex(rhs.bufferIndex) {
+              bufferIndex(rhs.bufferIndex),
+              mapped(rhs.mapped) {
             rhs.id = 0;
+            rhs.mapped = nullptr;
         }
 
         Buffer& operator=(const Buffer&) = delete;
@@ -136,6 +161,8 @@ public:
             tombstones = rhs.tombstones;
             occupancyBytes = rhs.occupancyBytes;
             bufferIndex = rhs.bufferIndex;
+            mapped = rhs.mapped;
+            rhs.mapped = nullptr;
             return *this;
         }
 
@@ -260,30 +287,34 @@ public:
             assert(0);
             return false;
         }
-        MBGL_CHECK_ERROR(glBindBuffer(type, buffer->id));
-
-        // Map the next available slice of memory
-        auto* buf = MBGL_CHECK_ERROR(
-            glMapBufferRange(type,
-                             buffer->pointer,
-                             alignedSize,
-                             GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_WRITE_BIT));
         const auto writtenIndex = buffer->pointer;
 
-        if (buf) {
+        if (buffer->mapped) {
+            std::memcpy(buffer->mapped + writtenIndex, data, size);
+        } else {
+            MBGL_CHECK_ERROR(glBindBuffer(type, buffer->id));
+
+            // Map the next available slice of memory
+            auto* buf = MBGL_CHECK_ERROR(
+                glMapBufferRange(type,
+                                 buffer->pointer,
+                                 alignedSize,
+                                 GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_WRITE_BIT));
+            if (!buf) {
+                assert(0);
+                return false;
+            }
+
             std::memcpy(buf, data, size);
             MBGL_CHECK_ERROR(glUnmapBuffer(type));
 
-            residentBuffer = buffer->addRef(nullptr, writtenIndex, size);
-            buffer->pointer += alignedSize;
-        } else {
-            assert(0);
-            return false;
-        }
-
 #ifndef NDEBUG
-        MBGL_CHECK_ERROR(glBindBuffer(type, 0));
+            MBGL_CHECK_ERROR(glBindBuffer(type, 0));
 #endif
+        }
+
+        residentBuffer = buffer->addRef(nullptr, writtenIndex, size);
+        buffer->pointer += alignedSize;
 
         return true;
     }
@@ -436,6 +467,14 @@ private:
         auto& destBuffer = buffers[toIndex];
         const auto recycledWriteIndex = destBuffer.pointer;
 
+        if (destBuffer.mapped) {
+            std::memcpy(destBuffer.mapped + recycledWriteIndex,
+                        ref.getOwner()->getManagedBuffer().getContents().data(),
+                        ref.getOwner()->getSize());
+            destBuffer.pointer += alignedSize;
+            return relocateRef(ref, toIndex, recycledWriteIndex);
+        }
+
         auto* buf = MBGL_CHECK_ERROR(
             glMapBufferRange(type,
                              recycledWriteIndex,
@@ -451,6 +490,10 @@ private:
             return false;
         }
 
+        return relocateRef(ref, toIndex, recycledWriteIndex);
+    }
+
+    bool relocateRef(RefTy& ref, size_t toIndex, ptrdiff_t recycledWriteIndex) {
         // 2.c: Now the ref must be made aware of the relocation of its contents.
         // Note that this means defragmentation can never run on refs that are
         // expected to remain bound after defragmentation. They must be re-bound
@@ -459,12 +502,16 @@ private:
         const auto refSize = ref.getSize();
         const auto oldIndex = ref.getBufferIndex();
 
-        const auto newRef = destBuffer.addRef(owner, recycledWriteIndex, refSize);
+        const auto newRef = buffers[toIndex].addRef(owner, recycledWriteIndex, refSize);
         buffers[oldIndex].decRef(&ref);
         owner->getManagedBuffer().relocRef(newRef);
         return true;
     }
 
+public:
+    // Set to create persistently mapped buffers
+    const extension::BufferStorage* bufferStorage = nullptr;
+
 private:
     // GL requires us to satisfy this alignment for sub-allocations in our buffers
     size_t sharedBufferAlignment = 0;
@@ -517,5 +564,9 @@ int32_t UniformBufferAllocator::getBufferID(size_t bufferIndex) const noexcept {
     return impl->getBufferID(bufferIndex);
 }
 
+void UniformBufferAllocator::enablePersistentMapping(const extension::BufferStorage& bufferStorage) noexcept {
+    impl->bufferStorage = &bufferStorage;
+}
+
 } // namespace gl
 } // namespace mbgl
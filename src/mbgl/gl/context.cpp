@@ -8,6 +8,7 @@
 #include <mbgl/gl/renderer_backend.hpp>
 #include <mbgl/gl/renderbuffer_resource.hpp>
 #include <mbgl/gl/offscreen_texture.hpp>
+#include <mbgl/gl/buffer_storage_extension.hpp>
 #include <mbgl/gl/debugging_extension.hpp>
 #include <mbgl/gl/timestamp_query_extension.hpp>
 #include <mbgl/renderer/paint_parameters.hpp>
@@ -25,6 +26,8 @@
 #include <mbgl/renderer/render_target.hpp>
 #include <mbgl/shaders/gl/shader_program_gl.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <iterator>
 
@@ -173,6 +176,11 @@ void Context::initializeExtensions(const std::function<gl::ProcAddress(const cha
             debugging = std::make_unique<extension::Debugging>(fn);
         }
 
+        bufferStorage = std::make_unique<extension::BufferStorage>(fn);
+        if (bufferStorage->bufferStorage) {
+            uboAllocator->enablePersistentMapping(*bufferStorage);
+        }
+
 // Currently GL timestamp queries are only used when Tracy profiling is enabled
 #ifdef MLN_TRACY_ENABLE
         extension::loadTimeStampQueryExtension(fn);
@@ -578,6 +586,37 @@ gfx::Texture2DPtr Context::createTexture2D() {
     return std::make_shared<gl::Texture2D>(*this);
 }
 
+TextureCompressionSupport Context::getTextureCompressionSupport() const {
+    if (!textureCompressionSupport) {
+        GLint count = 0;
+        MBGL_CHECK_ERROR(glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &count));
+        std::vector<GLint> formats(static_cast<std::size_t>(std::max(count, 0)));
+        if (!formats.empty()) {
+            MBGL_CHECK_ERROR(glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data()));
+        }
+
+        TextureCompressionSupport support;
+        for (const auto format : formats) {
+            support.etc2 |= format == GL_COMPRESSED_RGB8_ETC2;
+            support.bc1 |= format == GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+            support.astc |= format == GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+        }
+        textureCompressionSupport = support;
+    }
+    return *textureCompressionSupport;
+}
+
+bool Context::isSoftwareRenderer() const {
+    if (!softwareRenderer) {
+        const auto* name = reinterpret_cast<const char*>(MBGL_CHECK_ERROR(glGetString(GL_RENDERER)));
+        const std::string renderer = name ? name : "";
+        softwareRenderer = std::ranges::any_of(
+            std::array<const char*, 5>{"llvmpipe", "softpipe", "SwiftShader", "Software Rasterizer", "Basic Render"},
+            [&](const char* software) { return renderer.find(software) != std::string::npos; });
+    }
+    return *softwareRenderer;
+}
+
 RenderTargetPtr Context::createRenderTarget(const Size size, const gfx::TextureChannelDataType type) {
     MLN_TRACE_FUNC();
 
@@ -629,6 +668,8 @@ void Context::clear(std::optional<mbgl::Color> color, std::optional<float> depth
     MBGL_CHECK_ERROR(glClear(mask));
 
     stats.numDrawCalls = 0;
+    stats.numDrawableBatches = 0;
+    stats.numIndirectDrawCalls = 0;
     stats.numFrames++;
 }
 
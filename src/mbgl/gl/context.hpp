@@ -22,6 +22,7 @@
 
 #include <array>
 #include <functional>
+#include <optional>
 #include <vector>
 
 namespace mbgl {
@@ -33,6 +34,7 @@ class RendererBackend;
 namespace extension {
 class VertexArray;
 class Debugging;
+class BufferStorage;
 } // namespace extension
 
 class Context final : public gfx::Context {
@@ -126,6 +128,10 @@ public:
 
     gfx::Texture2DPtr createTexture2D() override;
 
+    TextureCompressionSupport getTextureCompressionSupport() const override;
+
+    bool isSoftwareRenderer() const override;
+
     RenderTargetPtr createRenderTarget(const Size size, const gfx::TextureChannelDataType type) override;
 
     Framebuffer createFramebuffer(const gfx::Texture2D& color);
@@ -160,10 +166,13 @@ private:
     bool cleanupOnDestruction = true;
 
     std::unique_ptr<extension::Debugging> debugging;
+    std::unique_ptr<extension::BufferStorage> bufferStorage;
     std::shared_ptr<gl::Fence> frameInFlightFence;
     std::unique_ptr<gl::UniformBufferAllocator> uboAllocator;
     size_t frameNum = 0;
     UniformBufferArrayGL globalUniformBuffers;
+    mutable std::optional<TextureCompressionSupport> textureCompressionSupport;
+    mutable std::optional<bool> softwareRenderer;
 
 public:
     State<value::ActiveTextureUnit> activeTextureUnit;
@@ -729,3 +729,5 @@
 /* OpenGL ES Extensions */
 
 #define GL_TEXTURE_MAX_ANISOTROPY_EXT 0x84FE
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_ASTC_4x4_KHR 0x93B0
@@ -22,6 +22,10 @@ DrawableGL::~DrawableGL() {
 }
 
 void DrawableGL::draw(PaintParameters& parameters) const {
+    draw(parameters, /*firstInBatch=*/true, /*lastInBatch=*/true);
+}
+
+void DrawableGL::draw(PaintParameters& parameters, bool firstInBatch, bool lastInBatch) const {
     MLN_TRACE_FUNC();
 
     if (isCustom) {
@@ -42,26 +46,30 @@ void DrawableGL::draw(PaintParameters& parameters) const {
         return;
     }
 
-    if (enableDepth) {
-        context.setDepthMode(getIs3D() ? parameters.depthModeFor3D()
-                                       : parameters.depthModeForSublayer(getSubLayerIndex(), getDepthType()));
-    } else {
-        context.setDepthMode(gfx::DepthMode::disabled());
-    }
+    if (firstInBatch) {
+        if (enableDepth) {
+            context.setDepthMode(getIs3D() ? parameters.depthModeFor3D()
+                                           : parameters.depthModeForSublayer(getSubLayerIndex(), getDepthType()));
+        } else {
+            context.setDepthMode(gfx::DepthMode::disabled());
+        }
 
-    // force disable depth test for debugging
-    // context.setDepthMode({gfx::DepthFunctionType::Always, gfx::DepthMaskType::ReadOnly, {0,1}});
+        // force disable depth test for debugging
+        // context.setDepthMode({gfx::DepthFunctionType::Always, gfx::DepthMaskType::ReadOnly, {0,1}});
+
+        context.setColorMode(getColorMode());
+        context.setCullFaceMode(getCullFaceMode());
+    }
 
     // For 3D mode, stenciling is handled by the layer group
     if (!is3D) {
         context.setStencilMode(makeStencilMode(parameters));
     }
 
-    context.setColorMode(getColorMode());
-    context.setCullFaceMode(getCullFaceMode());
-
     impl->uniformBuffers.bind();
-    bindTextures();
+    if (firstInBatch) {
+        bindTextures();
+    }
 
     for (const auto& seg : impl->segments) {
         const auto& glSeg = static_cast<DrawSegmentGL&>(*seg);
@@ -71,10 +79,12 @@ void DrawableGL::draw(PaintParameters& parameters) const {
             context.draw(glSeg.getMode(), mlSeg.indexOffset, mlSeg.indexLength);
         }
     }
-    // Unbind the VAO so that future buffer commands outside Drawable do not change the current VAO state
-    context.bindVertexArray = value::BindVertexArray::Default;
+    if (lastInBatch) {
+        // Unbind the VAO so that future buffer commands outside Drawable do not change the current VAO state
+        context.bindVertexArray = value::BindVertexArray::Default;
 
-    unbindTextures();
+        unbindTextures();
+    }
     impl->uniformBuffers.unbind();
 }
 
@@ -369,6 +369,12 @@ gfx::TexturePixelType Enum<gfx::TexturePixelType>::from(const platform::GLint va
             return gfx::TexturePixelType::Depth;
         case GL_LUMINANCE:
             return gfx::TexturePixelType::Luminance;
+        case GL_COMPRESSED_RGB8_ETC2:
+            return gfx::TexturePixelType::ETC2;
+        case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+            return gfx::TexturePixelType::BC1;
+        case GL_COMPRESSED_RGBA_ASTC_4x4_KHR:
+            return gfx::TexturePixelType::ASTC;
         default:
             return {};
     }
@@ -387,6 +393,12 @@ platform::GLenum Enum<gfx::TexturePixelType>::to(const gfx::TexturePixelType val
             return GL_DEPTH_COMPONENT;
         case gfx::TexturePixelType::Luminance:
             return GL_LUMINANCE;
+        case gfx::TexturePixelType::ETC2:
+            return GL_COMPRESSED_RGB8_ETC2;
+        case gfx::TexturePixelType::BC1:
+            return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case gfx::TexturePixelType::ASTC:
+            return GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
     }
     return GL_INVALID_ENUM;
 }
@@ -99,40 +99,48 @@ void TileLayerGroupGL::render(RenderOrchestrator&, PaintParameters& parameters)
     const auto debugGroupRender = parameters.encoder->createDebugGroup(label_render.c_str());
 #endif
 
-    bool bindUBOs = false;
+    // Tweakers may change the textures or state that the drawables are batched by
     visitDrawables([&](gfx::Drawable& drawable) {
-        if (!drawable.getEnabled() || !drawable.hasRenderPass(parameters.pass)) {
-            return;
+        if (drawable.getEnabled() && drawable.hasRenderPass(parameters.pass)) {
+            for (const auto& tweaker : drawable.getTweakers()) {
+                tweaker->execute(drawable, parameters);
+            }
         }
+    });
+
+    bool bindUBOs = false;
+    const auto& batches = batchDrawables(parameters.pass);
+    const auto& drawables = getBatchedDrawables();
+    for (const auto& batch : batches) {
+        for (auto i = batch.begin; i < batch.end; ++i) {
+            const auto& drawable = static_cast<const DrawableGL&>(*drawables[i]);
 
 #if !defined(NDEBUG)
-        std::string label_tile;
-        if (const auto& tileID = drawable.getTileID()) {
-            label_tile = util::toString(drawable.getID().id()) + "/" + drawable.getName() + "/" +
-                         util::toString(*tileID);
-        }
-        const auto labelPtr = (label_tile.empty() ? drawable.getName() : label_tile).c_str();
-        const auto debugGroupTile = parameters.encoder->createDebugGroup(labelPtr);
+            std::string label_tile;
+            if (const auto& tileID = drawable.getTileID()) {
+                label_tile = util::toString(drawable.getID().id()) + "/" + drawable.getName() + "/" +
+                             util::toString(*tileID);
+            }
+            const auto labelPtr = (label_tile.empty() ? drawable.getName() : label_tile).c_str();
+            const auto debugGroupTile = parameters.encoder->createDebugGroup(labelPtr);
 #endif
 
-        if (!bindUBOs) {
-            uniformBuffers.bind();
-            bindUBOs = true;
-        }
+            if (!bindUBOs) {
+                uniformBuffers.bind();
+                bindUBOs = true;
+            }
 
-        for (const auto& tweaker : drawable.getTweakers()) {
-            tweaker->execute(drawable, parameters);
-        }
+            // For layer groups with 3D features, enable either the single-value
+            // stencil mode for features with stencil enabled or disable stenciling.
+            // 2D drawables will set their own stencil mode within `draw`.
+            if (features3d) {
+                context.setStencilMode(drawable.getEnableStencil() ? stencilMode3d : gfx::StencilMode::disabled());
+            }
 
-        // For layer groups with 3D features, enable either the single-value
-        // stencil mode for features with stencil enabled or disable stenciling.
-        // 2D drawables will set their own stencil mode within `draw`.
-        if (features3d) {
-            context.setStencilMode(drawable.getEnableStencil() ? stencilMode3d : gfx::StencilMode::disabled());
+            drawable.draw(parameters, i == batch.begin, i + 1 == batch.end);
         }
-
-        drawable.draw(parameters);
-    });
+        context.renderingStats().numDrawableBatches++;
+    }
 
     if (bindUBOs) {
         uniformBuffers.unbind();
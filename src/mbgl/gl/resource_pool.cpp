@@ -6,6 +6,7 @@
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/defines.hpp>
 #include <mbgl/gl/enum.hpp>
+#include <mbgl/util/compressed_image.hpp>
 #include <mbgl/util/hash.hpp>
 #include <mbgl/util/instrumentation.hpp>
 #include <mbgl/util/logging.hpp>
@@ -55,6 +56,9 @@ size_t Texture2DDesc::channelStorageSize() const {
 }
 
 size_t Texture2DDesc::getStorageSize() const {
+    if (isCompressed(pixelFormat)) {
+        return compressedDataSize(pixelFormat, size);
+    }
     return size.width * size.height * channelCount() * channelStorageSize();
 }
 
@@ -143,15 +147,26 @@ TextureID Texture2DPool::allocateGLMemory(const Texture2DDesc& desc) {
     // Bind to TU 0 and upload
     context->activeTextureUnit = 0;
     context->texture[0] = id;
-    MBGL_CHECK_ERROR(glTexImage2D(GL_TEXTURE_2D,
-                                  0,
-                                  Enum<gfx::TexturePixelType>::sizedFor(desc.pixelFormat, desc.channelType),
-                                  desc.size.width,
-                                  desc.size.height,
-                                  0,
-                                  Enum<gfx::TexturePixelType>::to(desc.pixelFormat),
-                                  Enum<gfx::TextureChannelDataType>::to(desc.channelType),
-                                  nullptr));
+    if (isCompressed(desc.pixelFormat)) {
+        MBGL_CHECK_ERROR(glCompressedTexImage2D(GL_TEXTURE_2D,
+                                                0,
+                                                Enum<gfx::TexturePixelType>::to(desc.pixelFormat),
+                                                desc.size.width,
+                                                desc.size.height,
+                                                0,
+                                                static_cast<GLsizei>(desc.getStorageSize()),
+                                                nullptr));
+    } else {
+        MBGL_CHECK_ERROR(glTexImage2D(GL_TEXTURE_2D,
+                                      0,
+                                      Enum<gfx::TexturePixelType>::sizedFor(desc.pixelFormat, desc.channelType),
+                                      desc.size.width,
+                                      desc.size.height,
+                                      0,
+                                      Enum<gfx::TexturePixelType>::to(desc.pixelFormat),
+                                      Enum<gfx::TextureChannelDataType>::to(desc.channelType),
+                                      nullptr));
+    }
 
     // Update stats
     context->renderingStats().numCreatedTextures++;
@@ -42,7 +42,15 @@ Texture2D& Texture2D::setImage(std::shared_ptr<PremultipliedImage> image_) noexc
     return *this;
 }
 
+Texture2D& Texture2D::setCompressedImage(std::shared_ptr<CompressedImage> image_) noexcept {
+    compressedImage = std::move(image_);
+    return *this;
+}
+
 size_t Texture2D::getDataSize() const noexcept {
+    if (isCompressed(pixelFormat)) {
+        return compressedDataSize(pixelFormat, size);
+    }
     return size.width * size.height * getPixelStride();
 }
 
@@ -177,6 +185,24 @@ void Texture2D::uploadSubRegion(const void* pixelData, const Size& size_, uint16
     // Bind to TU 0 and upload
     context.activeTextureUnit = 0;
     context.texture[0] = getTextureID();
+
+    if (isCompressed(pixelFormat)) {
+        const auto bytes = compressedDataSize(pixelFormat, size_);
+        MBGL_CHECK_ERROR(glCompressedTexSubImage2D(GL_TEXTURE_2D,
+                                                   0,
+                                                   xOffset,
+                                                   yOffset,
+                                                   size_.width,
+                                                   size_.height,
+                                                   Enum<gfx::TexturePixelType>::to(pixelFormat),
+                                                   static_cast<GLsizei>(bytes),
+                                                   pixelData));
+
+        context.renderingStats().numTextureUpdates++;
+        context.renderingStats().textureUpdateBytes += bytes;
+        return;
+    }
+
     context.pixelStoreUnpack = {1};
     MBGL_CHECK_ERROR(glTexSubImage2D(GL_TEXTURE_2D,
                                      0,
@@ -193,6 +219,11 @@ void Texture2D::uploadSubRegion(const void* pixelData, const Size& size_, uint16
 }
 
 void Texture2D::upload() noexcept {
+    if (compressedImage && compressedImage->valid()) {
+        setFormat(compressedImage->format, gfx::TextureChannelDataType::UnsignedByte);
+        upload(compressedImage->data.get(), compressedImage->size);
+        compressedImage.reset();
+    }
     if (image && image->valid()) {
         setFormat(gfx::TexturePixelType::RGBA, gfx::TextureChannelDataType::UnsignedByte);
         upload(image->data.get(), image->size);
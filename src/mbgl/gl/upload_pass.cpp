@@ -39,9 +39,12 @@ std::unique_ptr<gfx::VertexBufferResource> UploadPass::createVertexBufferResourc
     return std::make_unique<gl::VertexBufferResource>(std::move(result), static_cast<int>(size));
 }
 
-void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource, const void* data, std::size_t size) {
+void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource,
+                                            const void* data,
+                                            std::size_t size,
+                                            std::size_t offset) {
     commandEncoder.context.vertexBuffer = static_cast<gl::VertexBufferResource&>(resource).getBuffer();
-    MBGL_CHECK_ERROR(glBufferSubData(GL_ARRAY_BUFFER, 0, size, data));
+    MBGL_CHECK_ERROR(glBufferSubData(GL_ARRAY_BUFFER, offset, size, data));
 
     commandEncoder.context.renderingStats().vertexUpdateBytes += size;
     commandEncoder.context.renderingStats().bufferUpdateBytes += size;
@@ -100,7 +103,7 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             if (rawBufSize <= resource.getByteSize()) {
                 // If the source changed, update the buffer contents
                 if (vec->isModifiedAfter(resource.getLastUpdated())) {
-                    updateVertexBufferResource(resource, rawBufPtr, rawBufSize);
+                    updateVertexBufferRanges(resource, *vec);
                     resource.setLastUpdated(vec->getLastModified());
                 }
                 return rawData->resource;
@@ -111,6 +114,7 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             auto buffer = std::make_unique<VertexBufferGL>();
             buffer->resource = createVertexBufferResource(rawBufPtr, rawBufSize, usage, /*persistent=*/false);
             vec->setBuffer(std::move(buffer));
+            vec->resetModifiedRanges();
             return static_cast<VertexBufferGL*>(vec->getBuffer())->resource;
         }
     }
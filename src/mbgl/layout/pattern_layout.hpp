@@ -98,6 +98,9 @@ public:
         : sourceLayer(std::move(sourceLayer_)),
           zoom(parameters.tileID.overscaledZ),
           overscaling(parameters.tileID.overscaleFactor()),
+          simplificationTolerance(parameters.simplificationTolerance),
+          threadPool(parameters.threadPool),
+          sizeHint(parameters.sizeHint),
           hasPattern(false) {
         assert(!group.empty());
         auto leaderLayerProperties = staticImmutableCast<LayerPropertiesType>(group.front());
@@ -188,14 +191,45 @@ public:
                       const bool /*showCollisionBoxes*/,
                       const CanonicalTileID& canonical) override {
         auto bucket = std::make_shared<BucketType>(layout, layerPropertiesMap, zoom, overscaling);
-        for (auto& patternFeature : features) {
-            const auto i = patternFeature.i;
-            std::unique_ptr<GeometryTileFeature> feature = std::move(patternFeature.feature);
-            const PatternLayerMap& patterns = patternFeature.getPatterns();
-            const GeometryCollection& geometries = feature->getGeometries();
-
-            bucket->addFeature(*feature, geometries, patternPositions, patterns, i, canonical);
-            featureIndex->insert(geometries, i, sourceLayerID, bucketLeaderID);
+        bucket->reserve(sizeHint);
+        if constexpr (requires { typename BucketType::LayoutFeature; }) {
+            // The bucket lays out all the features at once
+            std::vector<GeometryCollection> simplified;
+            simplified.reserve(simplificationTolerance > 0 ? features.size() : 0);
+            std::vector<typename BucketType::LayoutFeature> layoutFeatures;
+            layoutFeatures.reserve(features.size());
+            for (const auto& patternFeature : features) {
+                const auto i = patternFeature.i;
+                const GeometryTileFeature& feature = *patternFeature.feature;
+                const GeometryCollection& geometries = feature.getGeometries();
+
+                if (simplificationTolerance > 0) {
+                    // Queries keep using the original geometry
+                    simplified.push_back(simplifyGeometry(geometries, feature.getType(), simplificationTolerance));
+                }
+                layoutFeatures.push_back({feature,
+                                          simplificationTolerance > 0 ? simplified.back() : geometries,
+                                          patternFeature.getPatterns(),
+                                          i});
+                featureIndex->insert(geometries, i, sourceLayerID, bucketLeaderID);
+            }
+            bucket->addFeatures(layoutFeatures, patternPositions, canonical, threadPool);
+        } else {
+            for (auto& patternFeature : features) {
+                const auto i = patternFeature.i;
+                std::unique_ptr<GeometryTileFeature> feature = std::move(patternFeature.feature);
+                const PatternLayerMap& patterns = patternFeature.getPatterns();
+                const GeometryCollection& geometries = feature->getGeometries();
+
+                if (simplificationTolerance > 0) {
+                    // Queries keep using the original geometry
+                    const auto simplified = simplifyGeometry(geometries, feature->getType(), simplificationTolerance);
+                    bucket->addFeature(*feature, simplified, patternPositions, patterns, i, canonical);
+                } else {
+                    bucket->addFeature(*feature, geometries, patternPositions, patterns, i, canonical);
+                }
+                featureIndex->insert(geometries, i, sourceLayerID, bucketLeaderID);
+            }
         }
         if (bucket->hasData()) {
             for (const auto& pair : layerPropertiesMap) {
@@ -214,6 +248,9 @@ protected:
 
     const float zoom;
     const uint32_t overscaling;
+    const double simplificationTolerance;
+    const std::optional<TaggedScheduler> threadPool;
+    const BucketSizeHint sizeHint;
     std::string sourceLayerID;
     bool hasPattern;
 };
@@ -191,6 +191,8 @@ MTLSamplerStatePtr Context::createMetalSamplerState(MTLSamplerDescriptorPtr samp
 
 void Context::performCleanup() {
     stats.numDrawCalls = 0;
+    stats.numDrawableBatches = 0;
+    stats.numIndirectDrawCalls = 0;
     stats.numFrames++;
     clipMaskUniformsBufferUsed = false;
 }
@@ -226,6 +228,18 @@ gfx::Texture2DPtr Context::createTexture2D() {
     return std::make_shared<Texture2D>(*this);
 }
 
+TextureCompressionSupport Context::getTextureCompressionSupport() const {
+    const auto& device = backend.getDevice();
+    // ETC2 and ASTC are sampled by Apple GPUs, BC formats by Mac GPUs, and Apple silicon does both
+    const bool apple = device->supportsFamily(MTL::GPUFamilyApple2);
+    return {.etc2 = apple, .bc1 = device->supportsFamily(MTL::GPUFamilyMac2), .astc = apple};
+}
+
+bool Context::isSoftwareRenderer() const {
+    // Metal always runs on a GPU
+    return false;
+}
+
 RenderTargetPtr Context::createRenderTarget(const Size size, const gfx::TextureChannelDataType type) {
     return std::make_shared<RenderTarget>(*this, size, type);
 }
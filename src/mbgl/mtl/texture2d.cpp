@@ -56,7 +56,15 @@ gfx::Texture2D& Texture2D::setImage(std::shared_ptr<PremultipliedImage> image_)
     return *this;
 }
 
+gfx::Texture2D& Texture2D::setCompressedImage(std::shared_ptr<CompressedImage> image_) noexcept {
+    compressedImage = std::move(image_);
+    return *this;
+}
+
 size_t Texture2D::getDataSize() const noexcept {
+    if (isCompressed(pixelFormat)) {
+        return compressedDataSize(pixelFormat, size);
+    }
     return size.width * size.height * getPixelStride();
 }
 
@@ -110,6 +118,12 @@ MTL::PixelFormat Texture2D::getMetalPixelFormat() const noexcept {
                     return MTL::PixelFormat::PixelFormatA8Unorm;
                 case gfx::TexturePixelType::Stencil:
                     return MTL::PixelFormat::PixelFormatStencil8;
+                case gfx::TexturePixelType::ETC2:
+                    return MTL::PixelFormat::PixelFormatETC2_RGB8;
+                case gfx::TexturePixelType::BC1:
+                    return MTL::PixelFormat::PixelFormatBC1_RGBA;
+                case gfx::TexturePixelType::ASTC:
+                    return MTL::PixelFormat::PixelFormatASTC_4x4_LDR;
                 default:
                     assert(false);
                     return MTL::PixelFormat::PixelFormatInvalid;
@@ -261,6 +275,14 @@ void Texture2D::uploadSubRegion(const void* pixelData, const Size& size_, uint16
     assert(!textureDirty);
 
     const MTL::Region region = MTL::Region::Make2D(xOffset, yOffset, size_.width, size_.height);
+    if (isCompressed(pixelFormat)) {
+        // Rows of compressed data are rows of blocks
+        const NS::UInteger bytesPerRow = compressedDataSize(pixelFormat, {size_.width, 1});
+        metalTexture->replaceRegion(region, 0, pixelData, bytesPerRow);
+        context.renderingStats().numTextureUpdates++;
+        context.renderingStats().textureUpdateBytes += compressedDataSize(pixelFormat, size_);
+        return;
+    }
     const NS::UInteger bytesPerRow = size_.width * getPixelStride();
     metalTexture->replaceRegion(region, 0, pixelData, bytesPerRow);
     context.renderingStats().numTextureUpdates++;
@@ -268,6 +290,11 @@ void Texture2D::uploadSubRegion(const void* pixelData, const Size& size_, uint16
 }
 
 void Texture2D::upload() noexcept {
+    if (compressedImage && compressedImage->valid()) {
+        setFormat(compressedImage->format, gfx::TextureChannelDataType::UnsignedByte);
+        upload(compressedImage->data.get(), compressedImage->size);
+        compressedImage.reset();
+    }
     if (image && image->valid()) {
         setFormat(gfx::TexturePixelType::RGBA, gfx::TextureChannelDataType::UnsignedByte);
         upload(image->data.get(), image->size);
@@ -65,8 +65,11 @@ std::unique_ptr<gfx::VertexBufferResource> UploadPass::createVertexBufferResourc
         commandEncoder.context.createBuffer(data, size, usage, /*isIndexBuffer=*/false, persistent));
 }
 
-void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource, const void* data, std::size_t size) {
-    static_cast<VertexBufferResource&>(resource).get().update(data, size, /*offset=*/0);
+void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource,
+                                            const void* data,
+                                            std::size_t size,
+                                            std::size_t offset) {
+    static_cast<VertexBufferResource&>(resource).get().update(data, size, offset);
 }
 
 std::unique_ptr<gfx::IndexBufferResource> UploadPass::createIndexBufferResource(const void* data,
@@ -104,8 +107,13 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             // If the already-allocated buffer is large enough, we can re-use it
             if (rawBufSize <= resource.getSizeInBytes()) {
                 // If the source changed, update the buffer contents
-                if (forceUpdate || vec->isModifiedAfter(resource.getLastUpdated())) {
-                    updateVertexBufferResource(resource, rawBufPtr, rawBufSize);
+                if (forceUpdate) {
+                    updateVertexBufferResource(resource, rawBufPtr, rawBufSize, /*offset=*/0);
+                    vec->resetModifiedRanges();
+                    resource.setLastUpdated(vec->getLastModified());
+                } else if (vec->isModifiedAfter(resource.getLastUpdated())) {
+                    // Partial updates replace the whole `MTLBuffer`, so do a single one
+                    updateVertexBufferRanges(resource, *vec, /*mergeRanges=*/true);
                     resource.setLastUpdated(vec->getLastModified());
                 }
                 return rawData->resource;
@@ -116,6 +124,7 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             auto buffer_ = std::make_unique<VertexBuffer>();
             buffer_->resource = createVertexBufferResource(rawBufPtr, rawBufSize, usage, /*persistent=*/false);
             vec->setBuffer(std::move(buffer_));
+            vec->resetModifiedRanges();
             return static_cast<VertexBuffer*>(vec->getBuffer())->resource;
         }
     }
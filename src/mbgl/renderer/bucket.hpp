@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/layout/symbol_instance.hpp>
+#include <mbgl/renderer/bucket_parameters.hpp>
 #include <mbgl/style/image_impl.hpp>
 #include <mbgl/style/layer_impl.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
@@ -51,6 +52,10 @@ public:
 
     virtual bool hasData() const = 0;
 
+    using SizeHint = BucketSizeHint;
+    virtual SizeHint getSizeHint() const { return {}; }
+    virtual void reserve(const SizeHint&) {}
+
     virtual float getQueryRadius(const RenderLayer&) const { return 0; };
 
     bool needsUpload() const { return hasData() && !uploaded; }
@@ -1,19 +1,35 @@
 #pragma once
 
+#include <mbgl/actor/scheduler.hpp>
 #include <mbgl/map/mode.hpp>
 #include <mbgl/tile/tile_id.hpp>
 
+#include <cstddef>
+#include <optional>
+
 namespace mbgl {
 namespace style {
 struct LayerTypeInfo;
 } // namespace style
 
+// Geometry element counts, used to pre-size the bucket built by the next layout of the same tile and layer.
+struct BucketSizeHint {
+    std::size_t vertices = 0;
+    std::size_t indexes = 0;
+};
+
 class BucketParameters {
 public:
     const OverscaledTileID tileID;
     const MapMode mode;
     const float pixelRatio;
     const style::LayerTypeInfo* layerType;
+    // Distance in tile units within which line and polygon geometry may be simplified, 0 to keep it as is
+    const double simplificationTolerance = 0;
+    // Worker pool that buckets can spread their geometry generation over
+    const std::optional<TaggedScheduler> threadPool = std::nullopt;
+    // Size of the bucket built for the same layer by the previous layout of the tile
+    const BucketSizeHint sizeHint = {};
 };
 
 } // namespace mbgl
@@ -32,6 +32,15 @@ bool CircleBucket::hasData() const {
     return !segments.empty();
 }
 
+Bucket::SizeHint CircleBucket::getSizeHint() const {
+    return {vertices.elements(), triangles.elements()};
+}
+
+void CircleBucket::reserve(const SizeHint& hint) {
+    vertices.reserve(hint.vertices);
+    triangles.reserve(hint.indexes);
+}
+
 namespace {
 template <class Property>
 float get(const CirclePaintProperties::PossiblyEvaluated& evaluated,
@@ -26,6 +26,8 @@ public:
     ~CircleBucket() override;
 
     bool hasData() const override;
+    SizeHint getSizeHint() const override;
+    void reserve(const SizeHint&) override;
 
     void upload(gfx::UploadPass&) override;
 
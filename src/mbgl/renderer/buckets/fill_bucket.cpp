@@ -82,6 +82,15 @@ bool FillBucket::hasData() const {
     return !triangleSegments.empty() || !basicLineSegments.empty();
 }
 
+Bucket::SizeHint FillBucket::getSizeHint() const {
+    return {vertices.elements(), triangles.elements()};
+}
+
+void FillBucket::reserve(const SizeHint& hint) {
+    vertices.reserve(hint.vertices);
+    triangles.reserve(hint.indexes);
+}
+
 float FillBucket::getQueryRadius(const RenderLayer& layer) const {
     using namespace style;
     const auto& evaluated = getEvaluated<FillLayerProperties>(layer.evaluatedProperties);
@@ -1,164 +1,275 @@
 #include <mbgl/renderer/buckets/fill_extrusion_bucket.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
+#include <mbgl/gfx/polygon_triangulation.hpp>
 #include <mbgl/style/layers/fill_extrusion_layer_impl.hpp>
 #include <mbgl/renderer/layers/render_fill_extrusion_layer.hpp>
 #include <mbgl/map/transform_state.hpp>
+#include <mbgl/util/containers.hpp>
+#include <mbgl/util/instrumentation.hpp>
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/constants.hpp>
-
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4244)
-#endif
-
-#include <mapbox/earcut.hpp>
-
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+#include <mbgl/util/parallel_for.hpp>
 
 #include <cassert>
 
-namespace mapbox {
-namespace util {
-template <>
-struct nth<0, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.x; };
-};
-
-template <>
-struct nth<1, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.y; };
-};
-} // namespace util
-} // namespace mapbox
-
 namespace mbgl {
 
 using namespace style;
 
 struct GeometryTooLongException : std::exception {};
 
-FillExtrusionBucket::FillExtrusionBucket(
-    const FillExtrusionBucket::PossiblyEvaluatedLayoutProperties&,
-    const std::map<std::string, Immutable<style::LayerProperties>>& layerPaintProperties,
-    const float zoom,
-    const uint32_t) {
-    for (const auto& pair : layerPaintProperties) {
-        paintPropertyBinders.emplace(
-            std::piecewise_construct,
-            std::forward_as_tuple(pair.first),
-            std::forward_as_tuple(getEvaluated<FillExtrusionLayerProperties>(pair.second), zoom));
-    }
-}
+namespace {
+
+// A polygon of a feature, with the ranges it takes in the bucket's buffers
+struct ExtrusionPolygon {
+    GeometryCollection polygon;
+    // One flag per ring edge, in ring order, cleared for walls that are left out
+    std::vector<bool> walls;
+    std::size_t roofVertices = 0;
+    std::size_t vertexCount = 0;
+    // Relative to the first vertex added by the same call
+    std::size_t vertexOffset = 0;
+    std::size_t segment = 0;
+    // Index of the first vertex within its segment
+    uint16_t segmentVertex = 0;
+    std::vector<uint16_t> indexes;
+};
 
-FillExtrusionBucket::~FillExtrusionBucket() {
-    sharedVertices->release();
-}
+// Polygons per task when building in parallel
+constexpr std::size_t parallelGrain = 64;
 
-void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
-                                     const GeometryCollection& geometry,
-                                     const ImagePositions& patternPositions,
-                                     const PatternLayerMap& patternDependencies,
-                                     std::size_t index,
-                                     const CanonicalTileID& canonical) {
+void addPolygons(const GeometryCollection& geometry, std::vector<ExtrusionPolygon>& polygons) {
     for (auto& polygon : classifyRings(geometry)) {
         // Optimize polygons with many interior rings for earcut tesselation.
         limitHoles(polygon, 500);
 
         std::size_t totalVertices = 0;
+        std::size_t edges = 0;
 
         for (const auto& ring : polygon) {
             totalVertices += ring.size();
             if (totalVertices > std::numeric_limits<uint16_t>::max()) throw GeometryTooLongException();
+            edges += ring.empty() ? 0 : ring.size() - 1;
         }
 
         if (totalVertices == 0) continue;
 
-        std::vector<uint32_t> flatIndices;
-        flatIndices.reserve(totalVertices);
+        auto& result = polygons.emplace_back();
+        result.walls.assign(edges, true);
+        result.roofVertices = totalVertices;
+        result.vertexCount = totalVertices + (4 * edges);
+        result.polygon = std::move(polygon);
+    }
+}
 
-        std::size_t startVertices = vertices.elements();
+// Walls along an edge that another building has in the opposite direction are inside the union of both buildings
+void cullSharedWalls(std::vector<ExtrusionPolygon>& polygons) {
+    const auto key = [](const GeometryCoordinate& a, const GeometryCoordinate& b) {
+        return (uint64_t(uint16_t(a.x)) << 48) | (uint64_t(uint16_t(a.y)) << 32) | (uint64_t(uint16_t(b.x)) << 16) |
+               uint64_t(uint16_t(b.y));
+    };
+
+    mbgl::unordered_map<uint64_t, std::size_t> edges;
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+        edges.reserve(edges.size() + polygons[i].walls.size());
+        for (const auto& ring : polygons[i].polygon) {
+            for (std::size_t j = 1; j < ring.size(); ++j) {
+                edges.emplace(key(ring[j - 1], ring[j]), i);
+            }
+        }
+    }
 
-        if (triangleSegments.empty() || triangleSegments.back().vertexLength + (5 * (totalVertices - 1) + 1) >
-                                            std::numeric_limits<uint16_t>::max()) {
-            triangleSegments.emplace_back(startVertices, triangles.elements());
+    for (std::size_t i = 0; i < polygons.size(); ++i) {
+        auto& polygon = polygons[i];
+        std::size_t edge = 0;
+        for (const auto& ring : polygon.polygon) {
+            for (std::size_t j = 1; j < ring.size(); ++j, ++edge) {
+                const auto it = edges.find(key(ring[j], ring[j - 1]));
+                if (it != edges.end() && it->second != i) {
+                    polygon.walls[edge] = false;
+                    polygon.vertexCount -= 4;
+                }
+            }
         }
+    }
+}
 
-        auto& triangleSegment = triangleSegments.back();
-        assert(triangleSegment.vertexLength <= std::numeric_limits<uint16_t>::max());
-        auto triangleIndex = static_cast<uint16_t>(triangleSegment.vertexLength);
+// Write the roof and wall vertices of a polygon and collect its triangles
+void buildPolygon(ExtrusionPolygon& polygon, FillExtrusionLayoutVertex* vertex) {
+    std::vector<uint32_t> flatIndices;
+    flatIndices.reserve(polygon.roofVertices);
 
-        assert(triangleIndex + (5 * (totalVertices - 1) + 1) <= std::numeric_limits<uint16_t>::max());
+    auto& indexes = polygon.indexes;
+    auto triangleIndex = polygon.segmentVertex;
+    std::size_t edge = 0;
 
-        for (const auto& ring : polygon) {
-            std::size_t nVertices = ring.size();
+    for (const auto& ring : polygon.polygon) {
+        std::size_t nVertices = ring.size();
 
-            if (nVertices == 0) continue;
+        if (nVertices == 0) continue;
 
-            std::size_t edgeDistance = 0;
+        std::size_t edgeDistance = 0;
 
-            for (std::size_t i = 0; i < nVertices; i++) {
-                const auto& p1 = ring[i];
+        for (std::size_t i = 0; i < nVertices; i++) {
+            const auto& p1 = ring[i];
 
-                vertices.emplace_back(
-                    FillExtrusionBucket::layoutVertex(p1, 0, 0, 1, 1, static_cast<uint16_t>(edgeDistance)));
-                flatIndices.emplace_back(triangleIndex);
-                triangleIndex++;
+            *vertex++ = FillExtrusionBucket::layoutVertex(p1, 0, 0, 1, 1, static_cast<uint16_t>(edgeDistance));
+            flatIndices.emplace_back(triangleIndex);
+            triangleIndex++;
 
-                if (i != 0) {
-                    const auto& p2 = ring[i - 1];
+            if (i != 0) {
+                const auto& p2 = ring[i - 1];
 
-                    const auto d1 = convertPoint<double>(p1);
-                    const auto d2 = convertPoint<double>(p2);
+                const auto d1 = convertPoint<double>(p1);
+                const auto d2 = convertPoint<double>(p2);
 
-                    const Point<double> perp = util::unit(util::perp(d1 - d2));
-                    const size_t dist = util::dist<int16_t>(d1, d2);
-                    if (edgeDistance + dist > static_cast<size_t>(std::numeric_limits<int16_t>::max())) {
-                        edgeDistance = 0;
-                    }
-
-                    vertices.emplace_back(FillExtrusionBucket::layoutVertex(
-                        p1, perp.x, perp.y, 0, 0, static_cast<uint16_t>(edgeDistance)));
-                    vertices.emplace_back(FillExtrusionBucket::layoutVertex(
-                        p1, perp.x, perp.y, 0, 1, static_cast<uint16_t>(edgeDistance)));
+                const Point<double> perp = util::unit(util::perp(d1 - d2));
+                const size_t dist = util::dist<int16_t>(d1, d2);
+                if (edgeDistance + dist > static_cast<size_t>(std::numeric_limits<int16_t>::max())) {
+                    edgeDistance = 0;
+                }
 
+                if (!polygon.walls[edge++]) {
                     edgeDistance += dist;
-
-                    vertices.emplace_back(FillExtrusionBucket::layoutVertex(
-                        p2, perp.x, perp.y, 0, 0, static_cast<uint16_t>(edgeDistance)));
-                    vertices.emplace_back(FillExtrusionBucket::layoutVertex(
-                        p2, perp.x, perp.y, 0, 1, static_cast<uint16_t>(edgeDistance)));
-
-                    // ┌──────┐
-                    // │ 0  1 │ Counter-Clockwise winding order.
-                    // │      │ Triangle 1: 0 => 2 => 1
-                    // │ 2  3 │ Triangle 2: 1 => 2 => 3
-                    // └──────┘
-                    triangles.emplace_back(triangleIndex, triangleIndex + 2, triangleIndex + 1);
-                    triangles.emplace_back(triangleIndex + 1, triangleIndex + 2, triangleIndex + 3);
-                    triangleIndex += 4;
-                    triangleSegment.vertexLength += 4;
-                    triangleSegment.indexLength += 6;
+                    continue;
                 }
+
+                *vertex++ = FillExtrusionBucket::layoutVertex(
+                    p1, perp.x, perp.y, 0, 0, static_cast<uint16_t>(edgeDistance));
+                *vertex++ = FillExtrusionBucket::layoutVertex(
+                    p1, perp.x, perp.y, 0, 1, static_cast<uint16_t>(edgeDistance));
+
+                edgeDistance += dist;
+
+                *vertex++ = FillExtrusionBucket::layoutVertex(
+                    p2, perp.x, perp.y, 0, 0, static_cast<uint16_t>(edgeDistance));
+                *vertex++ = FillExtrusionBucket::layoutVertex(
+                    p2, perp.x, perp.y, 0, 1, static_cast<uint16_t>(edgeDistance));
+
+                // ┌──────┐
+                // │ 0  1 │ Counter-Clockwise winding order.
+                // │      │ Triangle 1: 0 => 2 => 1
+                // │ 2  3 │ Triangle 2: 1 => 2 => 3
+                // └──────┘
+                indexes.insert(indexes.end(),
+                               {triangleIndex,
+                                static_cast<uint16_t>(triangleIndex + 2),
+                                static_cast<uint16_t>(triangleIndex + 1),
+                                static_cast<uint16_t>(triangleIndex + 1),
+                                static_cast<uint16_t>(triangleIndex + 2),
+                                static_cast<uint16_t>(triangleIndex + 3)});
+                triangleIndex += 4;
             }
         }
+    }
+
+    std::vector<uint32_t> roof = gfx::triangulatePolygon(polygon.polygon);
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+    std::size_t nIndices = roof.size();
+    assert(nIndices % 3 == 0);
 
-        std::size_t nIndices = indices.size();
-        assert(nIndices % 3 == 0);
+    for (std::size_t i = 0; i < nIndices; i += 3) {
+        // Counter-Clockwise winding order.
+        indexes.insert(indexes.end(),
+                       {static_cast<uint16_t>(flatIndices[roof[i]]),
+                        static_cast<uint16_t>(flatIndices[roof[i + 2]]),
+                        static_cast<uint16_t>(flatIndices[roof[i + 1]])});
+    }
+}
+
+// Assign segments and vertex ranges to the polygons `[begin, end)`, following the vertices counted so far
+void placePolygons(std::vector<ExtrusionPolygon>& polygons,
+                   std::size_t begin,
+                   std::size_t end,
+                   SegmentVector& triangleSegments,
+                   std::size_t startVertices,
+                   std::size_t startIndexes,
+                   std::size_t& vertexCount) {
+    for (std::size_t i = begin; i < end; ++i) {
+        auto& polygon = polygons[i];
+        const std::size_t totalVertices = polygon.roofVertices;
 
-        for (std::size_t i = 0; i < nIndices; i += 3) {
-            // Counter-Clockwise winding order.
-            triangles.emplace_back(static_cast<uint16_t>(flatIndices[indices[i]]),
-                                   static_cast<uint16_t>(flatIndices[indices[i + 2]]),
-                                   static_cast<uint16_t>(flatIndices[indices[i + 1]]));
+        if (triangleSegments.empty() || triangleSegments.back().vertexLength + (5 * (totalVertices - 1) + 1) >
+                                            std::numeric_limits<uint16_t>::max()) {
+            // The index offset is set once the indexes are added
+            triangleSegments.emplace_back(startVertices + vertexCount, startIndexes);
         }
 
-        triangleSegment.vertexLength += totalVertices;
-        triangleSegment.indexLength += nIndices;
+        auto& triangleSegment = triangleSegments.back();
+        assert(triangleSegment.vertexLength + polygon.vertexCount <= std::numeric_limits<uint16_t>::max());
+
+        polygon.vertexOffset = vertexCount;
+        polygon.segment = triangleSegments.size() - 1;
+        polygon.segmentVertex = static_cast<uint16_t>(triangleSegment.vertexLength);
+
+        triangleSegment.vertexLength += polygon.vertexCount;
+        vertexCount += polygon.vertexCount;
+    }
+}
+
+void addIndexes(const std::vector<ExtrusionPolygon>& polygons,
+                SegmentVector& triangleSegments,
+                std::size_t firstNewSegment,
+                FillExtrusionBucket::TriangleIndexVector& triangles) {
+    std::size_t indexCount = 0;
+    for (const auto& polygon : polygons) {
+        indexCount += polygon.indexes.size();
+    }
+    triangles.reserve(triangles.elements() + indexCount);
+
+    std::size_t segment = firstNewSegment;
+    for (const auto& polygon : polygons) {
+        auto& triangleSegment = triangleSegments[polygon.segment];
+        if (polygon.segment >= segment) {
+            // First polygon of a segment created by this layout
+            triangleSegment.indexOffset = triangles.elements();
+            segment = polygon.segment + 1;
+        }
+        triangles.append(polygon.indexes.data(), polygon.indexes.size());
+        triangleSegment.indexLength += polygon.indexes.size();
+    }
+}
+
+} // namespace
+
+FillExtrusionBucket::FillExtrusionBucket(
+    const FillExtrusionBucket::PossiblyEvaluatedLayoutProperties&,
+    const std::map<std::string, Immutable<style::LayerProperties>>& layerPaintProperties,
+    const float zoom,
+    const uint32_t) {
+    uniformExtrusion = !layerPaintProperties.empty();
+    for (const auto& pair : layerPaintProperties) {
+        const auto& evaluated = getEvaluated<FillExtrusionLayerProperties>(pair.second);
+        uniformExtrusion = uniformExtrusion && evaluated.get<FillExtrusionHeight>().isConstant() &&
+                           evaluated.get<FillExtrusionBase>().isConstant();
+        paintPropertyBinders.emplace(
+            std::piecewise_construct, std::forward_as_tuple(pair.first), std::forward_as_tuple(evaluated, zoom));
+    }
+}
+
+FillExtrusionBucket::~FillExtrusionBucket() {
+    sharedVertices->release();
+}
+
+void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
+                                     const GeometryCollection& geometry,
+                                     const ImagePositions& patternPositions,
+                                     const PatternLayerMap& patternDependencies,
+                                     std::size_t index,
+                                     const CanonicalTileID& canonical) {
+    std::vector<ExtrusionPolygon> polygons;
+    addPolygons(geometry, polygons);
+
+    const auto firstNewSegment = triangleSegments.size();
+    std::size_t vertexCount = 0;
+    placePolygons(
+        polygons, 0, polygons.size(), triangleSegments, vertices.elements(), triangles.elements(), vertexCount);
+
+    auto* vertex = vertices.append(vertexCount);
+    for (auto& polygon : polygons) {
+        buildPolygon(polygon, vertex + polygon.vertexOffset);
     }
+    addIndexes(polygons, triangleSegments, firstNewSegment, triangles);
 
     for (auto& pair : paintPropertyBinders) {
         const auto it = patternDependencies.find(pair.first);
@@ -171,6 +282,61 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
     }
 }
 
+void FillExtrusionBucket::addFeatures(const std::vector<LayoutFeature>& features,
+                                      const ImagePositions& patternPositions,
+                                      const CanonicalTileID& canonical,
+                                      const std::optional<TaggedScheduler>& threadPool) {
+    MLN_TRACE_FUNC();
+
+    std::vector<ExtrusionPolygon> polygons;
+    std::vector<std::size_t> featureEnds;
+    featureEnds.reserve(features.size());
+    for (const auto& feature : features) {
+        addPolygons(feature.geometry, polygons);
+        featureEnds.push_back(polygons.size());
+    }
+
+    if (uniformExtrusion) {
+        cullSharedWalls(polygons);
+    }
+
+    // Vertex ranges are assigned up front so that the paint property binders can be populated,
+    // and the geometry can be written into them in any order.
+    const auto firstNewSegment = triangleSegments.size();
+    const auto startVertices = vertices.elements();
+    std::size_t vertexCount = 0;
+    for (std::size_t i = 0, begin = 0; i < features.size(); begin = featureEnds[i++]) {
+        placePolygons(
+            polygons, begin, featureEnds[i], triangleSegments, startVertices, triangles.elements(), vertexCount);
+
+        const auto& feature = features[i];
+        for (auto& pair : paintPropertyBinders) {
+            const auto it = feature.patterns.find(pair.first);
+            if (it != feature.patterns.end()) {
+                pair.second.populateVertexVectors(
+                    feature.feature, startVertices + vertexCount, feature.index, patternPositions, it->second, canonical);
+            } else {
+                pair.second.populateVertexVectors(
+                    feature.feature, startVertices + vertexCount, feature.index, patternPositions, {}, canonical);
+            }
+        }
+    }
+
+    auto* vertex = vertices.append(vertexCount);
+    const auto build = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            buildPolygon(polygons[i], vertex + polygons[i].vertexOffset);
+        }
+    };
+    if (threadPool) {
+        util::parallelFor(*threadPool, polygons.size(), parallelGrain, build);
+    } else {
+        build(0, polygons.size());
+    }
+
+    addIndexes(polygons, triangleSegments, firstNewSegment, triangles);
+}
+
 void FillExtrusionBucket::upload([[maybe_unused]] gfx::UploadPass& uploadPass) {
     uploaded = true;
 }
@@ -179,6 +345,15 @@ bool FillExtrusionBucket::hasData() const {
     return !triangleSegments.empty();
 }
 
+Bucket::SizeHint FillExtrusionBucket::getSizeHint() const {
+    return {vertices.elements(), triangles.elements()};
+}
+
+void FillExtrusionBucket::reserve(const SizeHint& hint) {
+    vertices.reserve(hint.vertices);
+    triangles.reserve(hint.indexes);
+}
+
 float FillExtrusionBucket::getQueryRadius(const RenderLayer& layer) const {
     const auto& evaluated = getEvaluated<FillExtrusionLayerProperties>(layer.evaluatedProperties);
     const std::array<float, 2>& translate = evaluated.get<FillExtrusionTranslate>();
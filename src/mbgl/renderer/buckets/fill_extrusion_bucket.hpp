@@ -1,5 +1,6 @@
 #pragma once
 
+#include <mbgl/actor/scheduler.hpp>
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/renderer/paint_property_binder.hpp>
 #include <mbgl/renderer/render_light.hpp>
@@ -9,6 +10,9 @@
 #include <mbgl/shaders/segment.hpp>
 #include <mbgl/style/layers/fill_extrusion_layer_properties.hpp>
 
+#include <optional>
+#include <vector>
+
 namespace mbgl {
 
 class BucketParameters;
@@ -35,7 +39,24 @@ public:
                     std::size_t,
                     const CanonicalTileID&) override;
 
+    struct LayoutFeature {
+        const GeometryTileFeature& feature;
+        const GeometryCollection& geometry;
+        const PatternLayerMap& patterns;
+        std::size_t index;
+    };
+
+    /// Add all the features of a layout at once.
+    /// The geometry of the features is built on `threadPool` when one is given. Walls shared by adjacent buildings
+    /// are left out when all the features of every layer have the same base and height, since they can't be seen.
+    void addFeatures(const std::vector<LayoutFeature>&,
+                     const ImagePositions&,
+                     const CanonicalTileID&,
+                     const std::optional<TaggedScheduler>& threadPool);
+
     bool hasData() const override;
+    SizeHint getSizeHint() const override;
+    void reserve(const SizeHint&) override;
 
     void upload(gfx::UploadPass&) override;
 
@@ -73,6 +94,10 @@ public:
     SegmentVector triangleSegments;
 
     std::unordered_map<std::string, FillExtrusionBinders> paintPropertyBinders;
+
+private:
+    // Whether every layer extrudes all the features between the same base and height
+    bool uniformExtrusion = false;
 };
 
 } // namespace mbgl
@@ -32,6 +32,15 @@ bool HeatmapBucket::hasData() const {
     return !segments.empty();
 }
 
+Bucket::SizeHint HeatmapBucket::getSizeHint() const {
+    return {vertices.elements(), triangles.elements()};
+}
+
+void HeatmapBucket::reserve(const SizeHint& hint) {
+    vertices.reserve(hint.vertices);
+    triangles.reserve(hint.indexes);
+}
+
 void HeatmapBucket::addFeature(const GeometryTileFeature& feature,
                                const GeometryCollection& geometry,
                                const ImagePositions&,
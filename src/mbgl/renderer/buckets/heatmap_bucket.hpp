@@ -29,6 +29,8 @@ public:
                     std::size_t,
                     const CanonicalTileID&) override;
     bool hasData() const override;
+    SizeHint getSizeHint() const override;
+    void reserve(const SizeHint&) override;
 
     void upload(gfx::UploadPass&) override;
 
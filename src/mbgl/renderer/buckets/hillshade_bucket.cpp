@@ -24,6 +24,20 @@ DEMData& HillshadeBucket::getDEMData() {
     return demdata;
 }
 
+void HillshadeBucket::prepareOnCPU(HillshadePrepareZoom zoom) {
+    preparedZoom = zoom;
+    preparedImage = std::make_shared<PremultipliedImage>(prepareHillshade(demdata, zoom));
+}
+
+void HillshadeBucket::updatePreparedBorder() {
+    if (!preparedImage) {
+        return;
+    }
+    updateHillshadeBorder(demdata, *preparedZoom, *preparedImage);
+    // Upload the new image
+    preparedTexture.reset();
+}
+
 void HillshadeBucket::upload([[maybe_unused]] gfx::UploadPass& uploadPass) {
     if (!hasData()) {
         return;
@@ -4,6 +4,7 @@
 #include <mbgl/renderer/paint_property_binder.hpp>
 #include <mbgl/gfx/vertex_buffer.hpp>
 #include <mbgl/geometry/dem_data.hpp>
+#include <mbgl/geometry/hillshade_prepare.hpp>
 #include <mbgl/shaders/segment.hpp>
 #include <mbgl/renderer/bucket.hpp>
 #include <mbgl/renderer/tile_mask.hpp>
@@ -12,8 +13,14 @@
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/mat4.hpp>
 
+#include <optional>
+
 namespace mbgl {
 
+namespace gfx {
+class Texture2D;
+} // namespace gfx
+
 using HillshadeBinders = PaintPropertyBinders<style::HillshadePaintProperties::DataDrivenProperties>;
 using HillshadeLayoutVertex = gfx::Vertex<TypeList<attributes::pos, attributes::texture_pos>>;
 
@@ -42,6 +49,17 @@ public:
 
     void setPrepared(bool preparedState) { prepared = preparedState; }
 
+    /// Compute the slopes in place of the prepare render pass. Kept with the tile, so that it
+    /// doesn't need to be prepared again when it comes back from the tile cache.
+    void prepareOnCPU(HillshadePrepareZoom);
+    /// Slopes computed by `prepareOnCPU`, if any
+    const std::shared_ptr<PremultipliedImage>& getPreparedImage() const { return preparedImage; }
+    /// Update the slopes computed by `prepareOnCPU` along the edges, after the DEM data was backfilled
+    void updatePreparedBorder();
+
+    // Texture of the slopes computed on the CPU, used instead of the render target
+    std::shared_ptr<gfx::Texture2D> preparedTexture;
+
     static HillshadeLayoutVertex layoutVertex(Point<int16_t> p, Point<uint16_t> t) {
         return HillshadeLayoutVertex{{{p.x, p.y}}, {{t.x, t.y}}};
     }
@@ -60,6 +78,8 @@ public:
 private:
     DEMData demdata;
     bool prepared = false;
+    std::optional<HillshadePrepareZoom> preparedZoom;
+    std::shared_ptr<PremultipliedImage> preparedImage;
 };
 
 } // namespace mbgl
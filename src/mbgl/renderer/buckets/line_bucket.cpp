@@ -134,6 +134,15 @@ bool LineBucket::hasData() const {
     return !segments.empty();
 }
 
+Bucket::SizeHint LineBucket::getSizeHint() const {
+    return {vertices.elements(), triangles.elements()};
+}
+
+void LineBucket::reserve(const SizeHint& hint) {
+    vertices.reserve(hint.vertices);
+    triangles.reserve(hint.indexes);
+}
+
 namespace {
 template <class Property>
 float get(const LinePaintProperties::PossiblyEvaluated& evaluated,
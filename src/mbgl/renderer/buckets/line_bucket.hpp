@@ -34,6 +34,8 @@ public:
                     const CanonicalTileID&) override;
 
     bool hasData() const override;
+    SizeHint getSizeHint() const override;
+    void reserve(const SizeHint&) override;
 
     void upload(gfx::UploadPass&) override;
 
@@ -12,6 +12,9 @@ RasterBucket::RasterBucket(PremultipliedImage&& image_)
 RasterBucket::RasterBucket(std::shared_ptr<PremultipliedImage> image_)
     : image(std::move(image_)) {}
 
+RasterBucket::RasterBucket(std::shared_ptr<CompressedImage> compressedImage_)
+    : compressedImage(std::move(compressedImage_)) {}
+
 RasterBucket::~RasterBucket() {
     clear();
     setImage({});
@@ -36,6 +39,7 @@ void RasterBucket::clear() {
 
 void RasterBucket::setImage(std::shared_ptr<PremultipliedImage> image_) {
     image = std::move(image_);
+    compressedImage.reset();
     texture2d.reset();
     uploaded = false;
 }
@@ -102,7 +106,7 @@ void RasterBucket::setMask(TileMask&& mask_) {
 }
 
 bool RasterBucket::hasData() const {
-    return !!image;
+    return image || compressedImage;
 }
 
 } // namespace mbgl
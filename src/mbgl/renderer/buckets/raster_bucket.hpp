@@ -7,6 +7,7 @@
 #include <mbgl/renderer/paint_property_binder.hpp>
 #include <mbgl/renderer/tile_mask.hpp>
 #include <mbgl/style/layers/raster_layer_properties.hpp>
+#include <mbgl/util/compressed_image.hpp>
 #include <mbgl/util/image.hpp>
 #include <mbgl/util/mat4.hpp>
 
@@ -27,6 +28,7 @@ class RasterBucket final : public Bucket {
 public:
     RasterBucket(PremultipliedImage&&);
     RasterBucket(std::shared_ptr<PremultipliedImage>);
+    RasterBucket(std::shared_ptr<CompressedImage>);
     ~RasterBucket() override;
 
     void upload(gfx::UploadPass&) override;
@@ -41,6 +43,8 @@ public:
     }
 
     std::shared_ptr<PremultipliedImage> image;
+    // Set instead of the image for tiles kept in a block compressed format
+    std::shared_ptr<CompressedImage> compressedImage;
     gfx::Texture2DPtr texture2d;
     TileMask mask{{0, 0, 0}};
 
@@ -2,11 +2,14 @@
 
 #include <mbgl/map/transform_state.hpp>
 #include <mbgl/style/layer_properties.hpp>
+#include <mbgl/renderer/layer_group.hpp>
+#include <mbgl/renderer/paint_parameters.hpp>
 #include <mbgl/renderer/render_tree.hpp>
 #include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/shaders/layer_ubo.hpp>
 #include <mbgl/util/mat4.hpp>
 #include <mbgl/util/containers.hpp>
+#include <mbgl/util/hash.hpp>
 
 #if MLN_RENDER_BACKEND_METAL
 #include <mbgl/util/monotonic_timer.hpp>
@@ -47,6 +50,37 @@ mat4 LayerTweaker::getTileMatrix(const UnwrappedTileID& tileID,
 void LayerTweaker::updateProperties(Immutable<style::LayerProperties> newProps) {
     evaluatedProperties = std::move(newProps);
     propertiesUpdated = true;
+    propertiesVersion++;
+}
+
+bool LayerTweaker::drawablesNeedUpdate(LayerGroupBase& layerGroup, const PaintParameters& parameters) {
+    std::size_t drawablesHash = layerGroup.getDrawableCount();
+    visitLayerGroupDrawables(layerGroup, [&](const gfx::Drawable& drawable) {
+        util::hash_combine(drawablesHash, drawable.getID().id());
+        util::hash_combine(drawablesHash, drawable.getEnabled());
+        if (const auto& tileID = drawable.getTileID()) {
+            util::hash_combine(drawablesHash, *tileID);
+        }
+        util::hash_combine(drawablesHash, static_cast<const void*>(drawable.getBucket().get()));
+        for (const auto& texture : drawable.getTextures()) {
+            util::hash_combine(drawablesHash, static_cast<const void*>(texture.get()));
+        }
+    });
+
+    DrawablesState state = {
+        .propertiesVersion = propertiesVersion,
+        .projMatrix = parameters.transformParams.projMatrix,
+        .zoom = parameters.state.getZoom(),
+        .size = parameters.state.getSize(),
+        .pixelRatio = parameters.pixelRatio,
+        .currentLayer = parameters.currentLayer,
+        .drawablesHash = drawablesHash,
+    };
+    if (drawablesState == state) {
+        return false;
+    }
+    drawablesState = std::move(state);
+    return true;
 }
 
 void LayerTweaker::multiplyWithProjectionMatrix(/*in-out*/ mat4& matrix,
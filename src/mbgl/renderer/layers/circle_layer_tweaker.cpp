@@ -58,6 +58,11 @@ void CircleLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParamete
     auto& layerUniforms = layerGroup.mutableUniformBuffers();
     layerUniforms.set(idCircleEvaluatedPropsUBO, evaluatedPropsUniformBuffer);
 
+    // Nothing the drawable uniforms depend on has changed, keep those from the last update
+    if (!drawablesNeedUpdate(layerGroup, parameters)) {
+        return;
+    }
+
 #if MLN_UBO_CONSOLIDATION
     int i = 0;
     std::vector<CircleDrawableUBO> drawableUBOVector(layerGroup.getDrawableCount());
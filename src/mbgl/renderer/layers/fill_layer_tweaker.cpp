@@ -57,6 +57,11 @@ void FillLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParameters
     const auto zoom = static_cast<float>(parameters.state.getZoom());
     const auto intZoom = parameters.state.getIntegerZoom();
 
+    // Nothing the drawable uniforms depend on has changed, keep those from the last update
+    if (!drawablesNeedUpdate(layerGroup, parameters)) {
+        return;
+    }
+
 #if MLN_UBO_CONSOLIDATION
     int i = 0;
     std::vector<FillDrawableUnionUBO> drawableUBOVector(layerGroup.getDrawableCount());
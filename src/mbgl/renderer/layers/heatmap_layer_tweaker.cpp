@@ -45,6 +45,11 @@ void HeatmapLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParamet
     auto& layerUniforms = layerGroup.mutableUniformBuffers();
     layerUniforms.set(idHeatmapEvaluatedPropsUBO, evaluatedPropsUniformBuffer);
 
+    // Nothing the drawable uniforms depend on has changed, keep those from the last update
+    if (!drawablesNeedUpdate(layerGroup, parameters)) {
+        return;
+    }
+
 #if MLN_UBO_CONSOLIDATION
     int i = 0;
     std::vector<HeatmapDrawableUBO> drawableUBOVector(layerGroup.getDrawableCount());
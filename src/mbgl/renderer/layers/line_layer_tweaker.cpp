@@ -161,6 +161,11 @@ void LineLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParameters
     layerUniforms.set(idLineExpressionUBO, getExpressionBuffer());
 #endif // MLN_RENDER_BACKEND_METAL
 
+    // Nothing the drawable uniforms depend on has changed, keep those from the last update
+    if (!drawablesNeedUpdate(layerGroup, parameters)) {
+        return;
+    }
+
 #if MLN_UBO_CONSOLIDATION
     int i = 0;
     std::vector<LineDrawableUnionUBO> drawableUBOVector(layerGroup.getDrawableCount());
@@ -304,6 +309,9 @@ void LineLayerTweaker::execute(LayerGroupBase& layerGroup, const PaintParameters
                         drawable.setEnabled(!!texture);
                         if (texture) {
                             drawable.setTexture(texture, idLineImageTexture);
+                        } else {
+                            // Try again once the dash pattern is uploaded
+                            invalidateDrawables();
                         }
                     }
 
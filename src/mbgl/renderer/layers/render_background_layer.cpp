@@ -209,6 +209,8 @@ void RenderBackgroundLayer::update(gfx::ShaderRegistry& shaders,
             builder->setRenderPass(drawPasses);
             builder->setShader(curShader);
             builder->setDepthType(gfx::DepthMaskType::ReadWrite);
+            // Every tile draws the same quad
+            builder->setSharedGeometry(true);
             builder->setColorMode(drawPasses == RenderPass::Translucent ? gfx::ColorMode::alphaBlended()
                                                                         : gfx::ColorMode::unblended());
         }
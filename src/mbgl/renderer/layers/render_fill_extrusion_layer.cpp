@@ -2,9 +2,11 @@
 
 #include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/gfx/cull_face_mode.hpp>
+#include <mbgl/gfx/fill_extrusion_drawable_data.hpp>
 #include <mbgl/gfx/render_pass.hpp>
 #include <mbgl/gfx/renderer_backend.hpp>
 #include <mbgl/gfx/shader_registry.hpp>
+#include <mbgl/map/transform_state.hpp>
 #include <mbgl/renderer/buckets/fill_extrusion_bucket.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/renderer/paint_parameters.hpp>
@@ -15,8 +17,11 @@
 #include <mbgl/style/layers/fill_extrusion_layer_impl.hpp>
 #include <mbgl/tile/geometry_tile.hpp>
 #include <mbgl/tile/tile.hpp>
+#include <mbgl/util/bounding_volumes.hpp>
+#include <mbgl/util/constants.hpp>
 #include <mbgl/util/intersection_tests.hpp>
 #include <mbgl/util/math.hpp>
+#include <mbgl/util/projection.hpp>
 
 #include <mbgl/gfx/drawable_atlases_tweaker.hpp>
 #include <mbgl/gfx/drawable_builder.hpp>
@@ -38,6 +43,39 @@ inline const FillExtrusionLayer::Impl& impl_cast(const Immutable<style::Layer::I
     return static_cast<const FillExtrusionLayer::Impl&>(*impl);
 }
 
+template <typename Property>
+std::optional<float> maxValue(const FillExtrusionPaintProperties::PossiblyEvaluated& evaluated,
+                              const FillExtrusionBinders& binders) {
+    if (const auto constant = evaluated.get<Property>().constant()) {
+        return constant;
+    }
+    return binders.statistics<Property>().max();
+}
+
+/// Height of the tallest building in meters, if it's known without evaluating the features
+std::optional<float> maxExtrusionHeight(const FillExtrusionPaintProperties::PossiblyEvaluated& evaluated,
+                                        const FillExtrusionBinders& binders) {
+    const auto height = maxValue<FillExtrusionHeight>(evaluated, binders);
+    const auto base = maxValue<FillExtrusionBase>(evaluated, binders);
+    if (!height || !base) {
+        return std::nullopt;
+    }
+    return std::max(*height, *base);
+}
+
+/// Footprint of the buildings of a bucket, which can extend past the tile or cover only part of it
+gfx::UniqueFillExtrusionDrawableData footprint(const FillExtrusionBucket& bucket) {
+    Point<int16_t> min{std::numeric_limits<int16_t>::max(), std::numeric_limits<int16_t>::max()};
+    Point<int16_t> max{std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::min()};
+    for (const auto& vertex : bucket.vertices.vector()) {
+        min.x = std::min(min.x, vertex.a1[0]);
+        min.y = std::min(min.y, vertex.a1[1]);
+        max.x = std::max(max.x, vertex.a1[0]);
+        max.y = std::max(max.y, vertex.a1[1]);
+    }
+    return std::make_unique<gfx::FillExtrusionDrawableData>(min, max);
+}
+
 } // namespace
 
 RenderFillExtrusionLayer::RenderFillExtrusionLayer(Immutable<style::FillExtrusionLayer::Impl> _impl)
@@ -103,7 +141,7 @@ bool RenderFillExtrusionLayer::queryIntersectsFeature(const GeometryCoordinates&
 
 void RenderFillExtrusionLayer::update(gfx::ShaderRegistry& shaders,
                                       gfx::Context& context,
-                                      const TransformState&,
+                                      const TransformState& state,
                                       const std::shared_ptr<UpdateParameters>&,
                                       const RenderTree&,
                                       UniqueChangeRequestVec& changes) {
@@ -193,6 +231,7 @@ void RenderFillExtrusionLayer::update(gfx::ShaderRegistry& shaders,
 
         const auto vertexCount = bucket.vertices.elements();
         auto& binders = bucket.paintPropertyBinders.at(getID());
+        const auto maxHeight = maxExtrusionHeight(evaluated, binders);
 
         // If we already have drawables for this tile, update them.
         auto updateExisting = [&](gfx::Drawable& drawable) {
@@ -200,6 +239,10 @@ void RenderFillExtrusionLayer::update(gfx::ShaderRegistry& shaders,
                 // This drawable was produced on a previous style/bucket, and should not be updated.
                 return false;
             }
+            // The height can change with the zoom level
+            if (const auto& data = drawable.getData()) {
+                static_cast<gfx::FillExtrusionDrawableData&>(*data).maxHeight = maxHeight;
+            }
             return true;
         };
         if (updateTile(drawPass, tileID, std::move(updateExisting))) {
@@ -317,6 +360,10 @@ void RenderFillExtrusionLayer::update(gfx::ShaderRegistry& shaders,
                 drawable->setBinders(renderData.bucket, &binders);
                 drawable->setRenderTile(renderTilesOwner, &tile);
 
+                auto data = footprint(bucket);
+                data->maxHeight = maxHeight;
+                drawable->setData(std::move(data));
+
                 tileLayerGroup->addDrawable(drawPass, tileID, std::move(drawable));
                 ++stats.drawablesAdded;
             }
@@ -327,6 +374,46 @@ void RenderFillExtrusionLayer::update(gfx::ShaderRegistry& shaders,
         }
         finish(*colorBuilder);
     }
+
+    // The tile cover is flat, so it keeps tiles whose buildings can't be seen at high pitch and can't tell which
+    // ones rise out of view. Test each drawable against the frustum with the height of its buildings instead.
+    const double worldSize = Projection::worldSize(state.getScale());
+    const auto frustum = util::Frustum::fromInvProjMatrix(
+        state.getInvProjectionMatrix(), worldSize, 0.0, state.getViewportMode() == ViewportMode::FlippedY);
+    const auto& translate = evaluated.get<FillExtrusionTranslate>();
+    const double translatePadding = std::hypot(translate[0], translate[1]) / worldSize;
+
+    int culled = 0;
+    tileLayerGroup->visitDrawables([&](gfx::Drawable& drawable) {
+        const auto& tileID = drawable.getTileID();
+        const auto* data = static_cast<const gfx::FillExtrusionDrawableData*>(drawable.getData().get());
+        if (!tileID || !data || !data->maxHeight) {
+            drawable.setEnabled(true);
+            return;
+        }
+
+        // World coordinates, one unit per world copy
+        const auto& canonical = tileID->canonical;
+        const double tileScale = 1.0 / std::pow(2.0, canonical.z);
+        const double unit = tileScale / util::EXTENT;
+        const double left = tileID->wrap + canonical.x * tileScale;
+        const double top = canonical.y * tileScale;
+        const double height = *data->maxHeight / worldSize;
+
+        const util::AABB bounds{{{left + data->min.x * unit - translatePadding,
+                                  top + data->min.y * unit - translatePadding,
+                                  std::min(0.0, height)}},
+                                {{left + data->max.x * unit + translatePadding,
+                                  top + data->max.y * unit + translatePadding,
+                                  std::max(0.0, height)}}};
+
+        const bool visible = frustum.intersects(bounds) != util::IntersectionResult::Separate;
+        drawable.setEnabled(visible);
+        if (!visible) {
+            ++culled;
+        }
+    });
+    context.renderingStats().numCulledDrawables += culled;
 }
 
 } // namespace mbgl
@@ -6,9 +6,11 @@
 #include <mbgl/tile/tile.hpp>
 #include <mbgl/style/layers/heatmap_layer_impl.hpp>
 #include <mbgl/geometry/feature_index.hpp>
+#include <mbgl/geometry/heatmap_density.hpp>
 #include <mbgl/gfx/context.hpp>
 #include <mbgl/gfx/cull_face_mode.hpp>
 #include <mbgl/gfx/render_pass.hpp>
+#include <mbgl/util/interpolate.hpp>
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/intersection_tests.hpp>
 
@@ -130,6 +132,10 @@ void RenderHeatmapLayer::markLayerRenderable(bool willRender, UniqueChangeReques
 }
 
 std::size_t RenderHeatmapLayer::removeTile(RenderPass renderPass, const OverscaledTileID& tileID) {
+    tileDensities.erase(tileID);
+    if (!renderTarget) {
+        return 0;
+    }
     if (auto* tileLayerGroup = static_cast<TileLayerGroup*>(renderTarget->getLayerGroup(0).get())) {
         const auto count = tileLayerGroup->removeDrawables(renderPass, tileID).size();
         stats.drawablesRemoved += count;
@@ -146,6 +152,9 @@ std::size_t RenderHeatmapLayer::removeAllDrawables() {
         stats.drawablesRemoved += count;
         renderTarget->getLayerGroup(0)->clearDrawables();
     }
+    tileDensities.clear();
+    compositedTiles.clear();
+    densityTexture.reset();
     return removed;
 }
 
@@ -169,6 +178,96 @@ void RenderHeatmapLayer::update(gfx::ShaderRegistry& shaders,
         return;
     }
 
+    // Software rasterizers are slow at blending the many overlapping kernels, so add them up on the CPU instead and
+    // leave only the color ramp pass to the renderer
+    const bool densityOnCPU = context.isSoftwareRenderer();
+    if (densityOnCPU) {
+        if (!updateDensityTexture(context, state)) {
+            return;
+        }
+    } else if (!updateKernelDrawables(shaders, context, state, changes)) {
+        return;
+    }
+
+    // Set up texture layer group
+    if (!layerGroup) {
+        if (auto layerGroup_ = context.createLayerGroup(layerIndex, /*initialCapacity=*/1, getID())) {
+            if (textureTweaker) {
+                layerGroup_->addLayerTweaker(textureTweaker);
+            }
+            setLayerGroup(std::move(layerGroup_), changes);
+        } else {
+            return;
+        }
+    }
+    if (!textureTweaker) {
+        textureTweaker = std::make_shared<HeatmapTextureLayerTweaker>(getID(), evaluatedProperties);
+        layerGroup->addLayerTweaker(textureTweaker);
+    }
+
+    if (!heatmapTextureShader) {
+        heatmapTextureShader = context.getGenericShader(shaders, HeatmapTextureShaderGroupName);
+    }
+    if (!heatmapTextureShader) {
+        removeAllDrawables();
+        return;
+    }
+
+    auto* textureLayerGroup = static_cast<LayerGroup*>(layerGroup.get());
+    // TODO: Don't rebuild drawables every time
+    textureLayerGroup->clearDrawables();
+
+    if (!sharedTextureVertices) {
+        sharedTextureVertices = std::make_shared<TextureVertexVector>(RenderStaticData::heatmapTextureVertices());
+    }
+    const auto textureVertexCount = sharedTextureVertices->elements();
+
+    auto textureVertexAttrs = context.createVertexAttributeArray();
+    if (const auto& attr = textureVertexAttrs->set(idHeatmapPosVertexAttribute)) {
+        attr->setSharedRawData(sharedTextureVertices,
+                               offsetof(HeatmapLayoutVertex, a1),
+                               /*vertexOffset=*/0,
+                               sizeof(HeatmapLayoutVertex),
+                               gfx::AttributeDataType::Short2);
+    }
+
+    auto heatmapTextureBuilder = context.createDrawableBuilder("heatmapTexture");
+    heatmapTextureBuilder->setShader(heatmapTextureShader);
+    heatmapTextureBuilder->setEnableDepth(false);
+    heatmapTextureBuilder->setColorMode(gfx::ColorMode::alphaBlended());
+    heatmapTextureBuilder->setCullFaceMode(gfx::CullFaceMode::disabled());
+    heatmapTextureBuilder->setRenderPass(RenderPass::Translucent);
+    heatmapTextureBuilder->setVertexAttributes(std::move(textureVertexAttrs));
+    heatmapTextureBuilder->setRawVertices({}, textureVertexCount, gfx::AttributeDataType::Short2);
+    if (segments.empty()) {
+        segments = RenderStaticData::heatmapTextureSegments();
+    }
+    heatmapTextureBuilder->setSegments(
+        gfx::Triangles(), RenderStaticData::quadTriangleIndices().vector(), segments.data(), segments.size());
+
+    heatmapTextureBuilder->setTexture(densityOnCPU ? densityTexture : renderTarget->getTexture(),
+                                      idHeatmapImageTexture);
+
+    std::shared_ptr<gfx::Texture2D> texture = context.createTexture2D();
+    texture->setImage(colorRamp);
+    texture->setSamplerConfiguration({.filter = gfx::TextureFilterType::Linear,
+                                      .wrapU = gfx::TextureWrapType::Clamp,
+                                      .wrapV = gfx::TextureWrapType::Clamp});
+    heatmapTextureBuilder->setTexture(std::move(texture), idHeatmapColorRampTexture);
+
+    heatmapTextureBuilder->flush(context);
+
+    for (auto& drawable : heatmapTextureBuilder->clearDrawables()) {
+        drawable->setLayerTweaker(textureTweaker);
+        textureLayerGroup->addDrawable(std::move(drawable));
+        ++stats.drawablesAdded;
+    }
+}
+
+bool RenderHeatmapLayer::updateKernelDrawables(gfx::ShaderRegistry& shaders,
+                                               gfx::Context& context,
+                                               const TransformState& state,
+                                               UniqueChangeRequestVec& changes) {
     const auto& viewportSize = state.getSize();
     const auto size = Size{viewportSize.width / 2, viewportSize.height / 2};
 
@@ -176,14 +275,14 @@ void RenderHeatmapLayer::update(gfx::ShaderRegistry& shaders,
     if (!renderTarget) {
         renderTarget = context.createRenderTarget(size, gfx::TextureChannelDataType::HalfFloat);
         if (!renderTarget) {
-            return;
+            return false;
         }
         activateRenderTarget(renderTarget, isRenderable, changes);
 
         // Set up tile layer group
         auto tileLayerGroup = context.createTileLayerGroup(0, /*initialCapacity=*/64, getID());
         if (!tileLayerGroup) {
-            return;
+            return false;
         }
         renderTarget->addLayerGroup(tileLayerGroup, /*replace=*/true);
         textureTweaker.reset();
@@ -200,7 +299,7 @@ void RenderHeatmapLayer::update(gfx::ShaderRegistry& shaders,
     }
     if (!heatmapShaderGroup) {
         removeAllDrawables();
-        return;
+        return false;
     }
 
     if (!layerTweaker) {
@@ -212,7 +311,7 @@ void RenderHeatmapLayer::update(gfx::ShaderRegistry& shaders,
     constexpr auto renderPass = RenderPass::Translucent;
 
     if (!(mbgl::underlying_type(renderPass) & evaluatedProperties->renderPasses)) {
-        return;
+        return false;
     }
 
     stats.drawablesRemoved += tileLayerGroup->removeDrawablesIf(
@@ -318,78 +417,113 @@ void RenderHeatmapLayer::update(gfx::ShaderRegistry& shaders,
         }
     }
 
-    // Set up texture layer group
-    if (!layerGroup) {
-        if (auto layerGroup_ = context.createLayerGroup(layerIndex, /*initialCapacity=*/1, getID())) {
-            if (textureTweaker) {
-                layerGroup_->addLayerTweaker(textureTweaker);
-            }
-            setLayerGroup(std::move(layerGroup_), changes);
-        } else {
-            return;
+    return true;
+}
+
+namespace {
+
+// The points of a bucket with their data driven properties evaluated like the heatmap shader does
+std::vector<HeatmapPoint> heatmapPoints(const HeatmapBucket& bucket,
+                                        const HeatmapBinders& binders,
+                                        const HeatmapPaintProperties::PossiblyEvaluated& evaluated,
+                                        float zoom) {
+    const auto valueAt = [zoom](const auto& binder, const auto& currentValue, std::size_t vertex) {
+        if (binder->getVertexCount() == 0) {
+            return std::get<0>(binder->uniformValue(currentValue));
         }
+        const auto range = std::get<0>(binder->getVertexValue(vertex)).a1;
+        return util::interpolate(range[0], range[1], std::get<0>(binder->interpolationFactor(zoom)));
+    };
+
+    // Each point is a quad, whose first vertex holds the position
+    std::vector<HeatmapPoint> points;
+    points.reserve(bucket.vertices.elements() / 4);
+    for (std::size_t vertex = 0; vertex + 3 < bucket.vertices.elements(); vertex += 4) {
+        const auto& pos = bucket.vertices.at(vertex).a1;
+        points.push_back({std::floor(pos[0] * 0.5f),
+                          std::floor(pos[1] * 0.5f),
+                          valueAt(binders.get<HeatmapWeight>(), evaluated.get<HeatmapWeight>(), vertex),
+                          valueAt(binders.get<HeatmapRadius>(), evaluated.get<HeatmapRadius>(), vertex)});
     }
-    if (!textureTweaker) {
-        textureTweaker = std::make_shared<HeatmapTextureLayerTweaker>(getID(), evaluatedProperties);
-        layerGroup->addLayerTweaker(textureTweaker);
-    }
+    return points;
+}
 
-    if (!heatmapTextureShader) {
-        heatmapTextureShader = context.getGenericShader(shaders, HeatmapTextureShaderGroupName);
-    }
-    if (!heatmapTextureShader) {
-        removeAllDrawables();
-        return;
+} // namespace
+
+bool RenderHeatmapLayer::updateDensityTexture(gfx::Context& context, const TransformState& state) {
+    constexpr auto renderPass = RenderPass::Translucent;
+    if (!(mbgl::underlying_type(renderPass) & evaluatedProperties->renderPasses)) {
+        return false;
     }
 
-    auto* textureLayerGroup = static_cast<LayerGroup*>(layerGroup.get());
-    // TODO: Don't rebuild drawables every time
-    textureLayerGroup->clearDrawables();
+    const auto& evaluated = static_cast<const HeatmapLayerProperties&>(*evaluatedProperties).evaluated;
+    const auto zoom = static_cast<float>(state.getZoom());
+    const auto& viewportSize = state.getSize();
+    const auto size = Size{viewportSize.width / 2, viewportSize.height / 2};
 
-    if (!sharedTextureVertices) {
-        sharedTextureVertices = std::make_shared<TextureVertexVector>(RenderStaticData::heatmapTextureVertices());
+    std::erase_if(tileDensities, [&](const auto& entry) { return !hasRenderTile(entry.first); });
+
+    // The matrix of every tile that is composited, to tell whether the viewport's density changed
+    std::vector<std::pair<OverscaledTileID, mat4>> composited;
+    bool changed = densityTexture == nullptr || densitySize != size;
+
+    for (const RenderTile& tile : *renderTiles) {
+        const auto& tileID = tile.getOverscaledTileID();
+        const LayerRenderData* renderData = getRenderDataForPass(tile, renderPass);
+        if (!renderData) {
+            tileDensities.erase(tileID);
+            continue;
+        }
+
+        const auto& bucket = static_cast<const HeatmapBucket&>(*renderData->bucket);
+        const auto& binders = bucket.paintPropertyBinders.at(getID());
+        const float extrudeScale = tileID.toUnwrapped().pixelsToTileUnits(1.0f, zoom);
+        const std::array<float, 6> parameters{
+            extrudeScale,
+            evaluated.get<HeatmapIntensity>(),
+            evaluated.get<HeatmapWeight>().constantOr(HeatmapWeight::defaultValue()),
+            evaluated.get<HeatmapRadius>().constantOr(HeatmapRadius::defaultValue()),
+            std::get<0>(binders.get<HeatmapWeight>()->interpolationFactor(zoom)),
+            std::get<0>(binders.get<HeatmapRadius>()->interpolationFactor(zoom))};
+
+        // Tiles keep their density until their data or the kernels change
+        auto& tileDensity = tileDensities[tileID];
+        if (tileDensity.bucketID != bucket.getID() || tileDensity.parameters != parameters) {
+            // One cell per pixel of the offscreen texture the GPU path renders into, at half resolution
+            tileDensity.density = accumulateHeatmapDensity(
+                heatmapPoints(bucket, binders, evaluated, zoom), parameters[1], extrudeScale, 2.0f * extrudeScale);
+            tileDensity.bucketID = bucket.getID();
+            tileDensity.parameters = parameters;
+            changed = true;
+        }
+        composited.emplace_back(tileID, tile.matrix);
     }
-    const auto textureVertexCount = sharedTextureVertices->elements();
 
-    auto textureVertexAttrs = context.createVertexAttributeArray();
-    if (const auto& attr = textureVertexAttrs->set(idHeatmapPosVertexAttribute)) {
-        attr->setSharedRawData(sharedTextureVertices,
-                               offsetof(HeatmapLayoutVertex, a1),
-                               /*vertexOffset=*/0,
-                               sizeof(HeatmapLayoutVertex),
-                               gfx::AttributeDataType::Short2);
+    if (!changed && composited == compositedTiles) {
+        return true;
     }
 
-    auto heatmapTextureBuilder = context.createDrawableBuilder("heatmapTexture");
-    heatmapTextureBuilder->setShader(heatmapTextureShader);
-    heatmapTextureBuilder->setEnableDepth(false);
-    heatmapTextureBuilder->setColorMode(gfx::ColorMode::alphaBlended());
-    heatmapTextureBuilder->setCullFaceMode(gfx::CullFaceMode::disabled());
-    heatmapTextureBuilder->setRenderPass(renderPass);
-    heatmapTextureBuilder->setVertexAttributes(std::move(textureVertexAttrs));
-    heatmapTextureBuilder->setRawVertices({}, textureVertexCount, gfx::AttributeDataType::Short2);
-    if (segments.empty()) {
-        segments = RenderStaticData::heatmapTextureSegments();
+    std::vector<float> viewportDensity(size.area(), 0.0f);
+    for (const auto& [tileID, matrix] : composited) {
+        compositeHeatmapDensity(tileDensities[tileID].density, matrix, size, viewportDensity);
     }
-    heatmapTextureBuilder->setSegments(
-        gfx::Triangles(), RenderStaticData::quadTriangleIndices().vector(), segments.data(), segments.size());
 
-    heatmapTextureBuilder->setTexture(renderTarget->getTexture(), idHeatmapImageTexture);
+    // Rows of the offscreen texture run bottom to top with OpenGL, and top to bottom with the other backends
+#if MLN_RENDER_BACKEND_OPENGL
+    constexpr bool bottomUp = true;
+#else
+    constexpr bool bottomUp = false;
+#endif
 
-    std::shared_ptr<gfx::Texture2D> texture = context.createTexture2D();
-    texture->setImage(colorRamp);
+    auto texture = context.createTexture2D();
+    texture->setImage(std::make_shared<PremultipliedImage>(packHeatmapDensity(viewportDensity, size, bottomUp)));
     texture->setSamplerConfiguration({.filter = gfx::TextureFilterType::Linear,
                                       .wrapU = gfx::TextureWrapType::Clamp,
                                       .wrapV = gfx::TextureWrapType::Clamp});
-    heatmapTextureBuilder->setTexture(std::move(texture), idHeatmapColorRampTexture);
-
-    heatmapTextureBuilder->flush(context);
-
-    for (auto& drawable : heatmapTextureBuilder->clearDrawables()) {
-        drawable->setLayerTweaker(textureTweaker);
-        textureLayerGroup->addDrawable(std::move(drawable));
-        ++stats.drawablesAdded;
-    }
+    densityTexture = std::move(texture);
+    densitySize = size;
+    compositedTiles = std::move(composited);
+    return true;
 }
 
 } // namespace mbgl
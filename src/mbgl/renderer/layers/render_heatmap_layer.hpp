@@ -1,12 +1,17 @@
 #pragma once
 
+#include <mbgl/geometry/heatmap_density.hpp>
 #include <mbgl/gfx/offscreen_texture.hpp>
 #include <mbgl/renderer/buckets/heatmap_bucket.hpp>
 #include <mbgl/renderer/render_layer.hpp>
 #include <mbgl/style/layers/heatmap_layer_impl.hpp>
 #include <mbgl/style/layers/heatmap_layer_properties.hpp>
 
+#include <array>
+#include <map>
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace mbgl {
 
@@ -44,6 +49,14 @@ private:
                                 const FeatureState&) const override;
     void updateColorRamp();
 
+    /// Set up the drawables that render the kernels of every tile into the offscreen texture
+    /// @return Whether the offscreen texture can be drawn
+    bool updateKernelDrawables(gfx::ShaderRegistry&, gfx::Context&, const TransformState&, UniqueChangeRequestVec&);
+
+    /// Accumulate the kernels of every tile on the CPU instead, into a texture of the viewport's density
+    /// @return Whether the density texture can be drawn
+    bool updateDensityTexture(gfx::Context&, const TransformState&);
+
     void layerChanged(const TransitionParameters& parameters,
                       const Immutable<style::Layer::Impl>& impl,
                       UniqueChangeRequestVec& changes) override;
@@ -69,6 +82,18 @@ private:
     using TextureVertexVector = gfx::VertexVector<HeatmapTextureLayoutVertex>;
     std::shared_ptr<TextureVertexVector> sharedTextureVertices;
 
+    // Density of each tile when it is accumulated on the CPU, kept while the tile's bucket and the
+    // zoom dependent parameters of its kernels stay the same
+    struct TileDensity {
+        util::SimpleIdentity bucketID = util::SimpleIdentity::Empty;
+        std::array<float, 6> parameters{};
+        HeatmapDensity density;
+    };
+    std::map<OverscaledTileID, TileDensity> tileDensities;
+    std::vector<std::pair<OverscaledTileID, mat4>> compositedTiles;
+    gfx::Texture2DPtr densityTexture;
+    Size densitySize;
+
     // This is the layer tweaker for applying the off-screen texture to the framebuffer.
     // The inherited layer tweaker is for applying tiles to the off-screen texture.
     LayerTweakerPtr textureTweaker;
@@ -192,9 +192,13 @@ void RenderHillshadeLayer::update(gfx::ShaderRegistry& shaders,
         [&](gfx::Drawable& drawable) { return drawable.getTileID() && !hasRenderTile(*drawable.getTileID()); });
 
     if (!staticDataSharedVertices) {
-        staticDataSharedVertices = std::make_shared<HillshadeVertexVector>(RenderStaticData::rasterVertices());
+        staticDataSharedVertices = context.getSharedMeshes().share(
+            std::make_shared<gfx::VertexVector<HillshadeLayoutVertex>>(RenderStaticData::rasterVertices()));
+    }
+    if (!staticDataSharedIndices) {
+        staticDataSharedIndices = context.getSharedMeshes().share(
+            std::make_shared<gfx::IndexVector<gfx::Triangles>>(RenderStaticData::quadTriangleIndices()));
     }
-    const auto staticDataIndices = RenderStaticData::quadTriangleIndices();
     const auto staticDataSegments = RenderStaticData::rasterSegments();
 
     std::unique_ptr<gfx::DrawableBuilder> hillshadeBuilder;
@@ -241,7 +245,16 @@ void RenderHillshadeLayer::update(gfx::ShaderRegistry& shaders,
         }
         setRenderTileBucketID(tileID, bucket.getID());
 
-        if (!bucket.renderTargetPrepared) {
+        if (bucket.getPreparedImage()) {
+            if (!bucket.preparedTexture) {
+                // Slopes were computed on the worker, upload them instead of running the prepare pass
+                bucket.preparedTexture = context.createTexture2D();
+                bucket.preparedTexture->setImage(bucket.getPreparedImage());
+                bucket.preparedTexture->setSamplerConfiguration({.filter = gfx::TextureFilterType::Linear,
+                                                                 .wrapU = gfx::TextureWrapType::Clamp,
+                                                                 .wrapV = gfx::TextureWrapType::Clamp});
+            }
+        } else if (!bucket.renderTargetPrepared) {
             // Set up tile render target
             const uint16_t tilesize = bucket.getDEMData().dim;
             auto renderTarget = context.createRenderTarget({tilesize, tilesize},
@@ -272,9 +285,9 @@ void RenderHillshadeLayer::update(gfx::ShaderRegistry& shaders,
             hillshadePrepareBuilder->setRenderPass(renderPass);
             hillshadePrepareBuilder->setVertexAttributes(getPrepareVertexAttributes());
             hillshadePrepareBuilder->setRawVertices(
-                {}, staticDataSharedVertices->elements(), gfx::AttributeDataType::Short2);
+                {}, staticDataSharedVertices->getRawCount(), gfx::AttributeDataType::Short2);
             hillshadePrepareBuilder->setSegments(
-                gfx::Triangles(), staticDataIndices.vector(), staticDataSegments.data(), staticDataSegments.size());
+                gfx::Triangles(), staticDataSharedIndices, staticDataSegments.data(), staticDataSegments.size());
 
             std::shared_ptr<gfx::Texture2D> texture = context.createTexture2D();
             texture->setImage(bucket.getDEMData().getImagePtr());
@@ -295,9 +308,11 @@ void RenderHillshadeLayer::update(gfx::ShaderRegistry& shaders,
             }
         }
 
+        const auto& slopeTexture = bucket.preparedTexture ? bucket.preparedTexture : bucket.renderTarget->getTexture();
+
         // Set up tile drawable
-        std::shared_ptr<HillshadeVertexVector> vertices;
-        std::shared_ptr<gfx::IndexVector<gfx::Triangles>> indices;
+        gfx::VertexVectorBasePtr vertices;
+        gfx::IndexVectorBasePtr indices;
         auto* segments = &staticDataSegments;
 
         if (!bucket.vertices.empty() && !bucket.indices.empty() && !bucket.segments.empty()) {
@@ -306,7 +321,7 @@ void RenderHillshadeLayer::update(gfx::ShaderRegistry& shaders,
             segments = &bucket.segments;
         } else {
             vertices = staticDataSharedVertices;
-            indices = std::make_shared<gfx::IndexVector<gfx::Triangles>>(staticDataIndices);
+            indices = staticDataSharedIndices;
         }
 
         if (!hillshadeBuilder) {
@@ -344,12 +359,12 @@ void RenderHillshadeLayer::update(gfx::ShaderRegistry& shaders,
             }
 
             drawable.updateVertexAttributes(buildVertexAttributes(),
-                                            vertices->elements(),
+                                            vertices->getRawCount(),
                                             gfx::Triangles(),
                                             std::move(indices),
                                             segments->data(),
                                             segments->size());
-            drawable.setTexture(bucket.renderTarget->getTexture(), idHillshadeImageTexture);
+            drawable.setTexture(slopeTexture, idHillshadeImageTexture);
 
             return true;
         };
@@ -363,9 +378,9 @@ void RenderHillshadeLayer::update(gfx::ShaderRegistry& shaders,
         hillshadeBuilder->setCullFaceMode(gfx::CullFaceMode::disabled());
         hillshadeBuilder->setRenderPass(renderPass);
         hillshadeBuilder->setVertexAttributes(buildVertexAttributes());
-        hillshadeBuilder->setRawVertices({}, vertices->elements(), gfx::AttributeDataType::Short2);
-        hillshadeBuilder->setSegments(gfx::Triangles(), indices->vector(), segments->data(), segments->size());
-        hillshadeBuilder->setTexture(bucket.renderTarget->getTexture(), idHillshadeImageTexture);
+        hillshadeBuilder->setRawVertices({}, vertices->getRawCount(), gfx::AttributeDataType::Short2);
+        hillshadeBuilder->setSegments(gfx::Triangles(), indices, segments->data(), segments->size());
+        hillshadeBuilder->setTexture(slopeTexture, idHillshadeImageTexture);
 
         hillshadeBuilder->flush(context);
 
@@ -56,8 +56,9 @@ private:
     gfx::ShaderProgramBasePtr hillshadeShader;
     std::vector<RenderTargetPtr> activatedRenderTargets;
 
-    using HillshadeVertexVector = gfx::VertexVector<HillshadeLayoutVertex>;
-    std::shared_ptr<HillshadeVertexVector> staticDataSharedVertices;
+    // The quad drawn for tiles without their own geometry, shared with other layers through the context
+    gfx::VertexVectorBasePtr staticDataSharedVertices;
+    gfx::IndexVectorBasePtr staticDataSharedIndices;
 
     LayerTweakerPtr prepareLayerTweaker;
 };
@@ -135,10 +135,12 @@ void RenderRasterLayer::update(gfx::ShaderRegistry& shaders,
     }
 
     if (!staticDataVertices) {
-        staticDataVertices = std::make_shared<RasterVertexVector>(RenderStaticData::rasterVertices());
+        staticDataVertices = context.getSharedMeshes().share(
+            std::make_shared<gfx::VertexVector<RasterLayoutVertex>>(RenderStaticData::rasterVertices()));
     }
     if (!staticDataIndices) {
-        staticDataIndices = std::make_shared<TriangleIndexVector>(RenderStaticData::quadTriangleIndices());
+        staticDataIndices = context.getSharedMeshes().share(
+            std::make_shared<gfx::IndexVector<gfx::Triangles>>(RenderStaticData::quadTriangleIndices()));
     }
     if (!staticDataSegments) {
         staticDataSegments = std::make_shared<RasterSegmentVector>(RenderStaticData::rasterSegments());
@@ -156,10 +158,14 @@ void RenderRasterLayer::update(gfx::ShaderRegistry& shaders,
     };
 
     const auto setTextures = [&](gfx::UniqueDrawableBuilder& builder, RasterBucket& bucket) {
-        if (bucket.image) {
+        if (bucket.image || bucket.compressedImage) {
             if (!bucket.texture2d) {
                 if (auto tex = context.createTexture2D()) {
-                    tex->setImage(bucket.image);
+                    if (bucket.compressedImage) {
+                        tex->setCompressedImage(bucket.compressedImage);
+                    } else {
+                        tex->setImage(bucket.image);
+                    }
                     bucket.texture2d = std::move(tex);
                 }
             }
@@ -196,8 +202,8 @@ void RenderRasterLayer::update(gfx::ShaderRegistry& shaders,
             // otherwise the standard tile extent geometry should be used.
             const bool shared = (!bucket.sharedVertices->empty() && !bucket.sharedTriangles->empty() &&
                                  !bucket.segments.empty());
-            const auto& vertices = shared ? bucket.sharedVertices : staticDataVertices;
-            const auto& indices = shared ? bucket.sharedTriangles : staticDataIndices;
+            const gfx::VertexVectorBasePtr vertices = shared ? bucket.sharedVertices : staticDataVertices;
+            const gfx::IndexVectorBasePtr indices = shared ? bucket.sharedTriangles : staticDataIndices;
             const auto* segments = shared ? &bucket.segments : staticDataSegments.get();
 
             gfx::VertexAttributeArrayPtr bucketAttrs;
@@ -224,11 +230,15 @@ void RenderRasterLayer::update(gfx::ShaderRegistry& shaders,
 
             assert(!!drawable ^ !!builder);
             if (drawable) {
-                drawable->updateVertexAttributes(
-                    vertexAttrs, vertices->elements(), gfx::Triangles(), indices, segments->data(), segments->size());
+                drawable->updateVertexAttributes(vertexAttrs,
+                                                 vertices->getRawCount(),
+                                                 gfx::Triangles(),
+                                                 indices,
+                                                 segments->data(),
+                                                 segments->size());
             } else if (builder) {
                 builder->setVertexAttributes(vertexAttrs);
-                builder->setRawVertices({}, vertices->elements(), gfx::AttributeDataType::Short2);
+                builder->setRawVertices({}, vertices->getRawCount(), gfx::AttributeDataType::Short2);
                 builder->setSegments(gfx::Triangles(), indices, segments->data(), segments->size());
             }
             return true;
@@ -348,7 +358,7 @@ void RenderRasterLayer::update(gfx::ShaderRegistry& shaders,
                 builder = createBuilder();
             }
 
-            if (bucket.image && !builder->getTexture(idRasterImage0Texture) &&
+            if (bucket.hasData() && !builder->getTexture(idRasterImage0Texture) &&
                 !builder->getTexture(idRasterImage1Texture)) {
                 setTextures(builder, bucket);
             };
@@ -53,13 +53,9 @@ private:
     gfx::ShaderProgramBasePtr rasterShader;
     LayerGroupPtr imageLayerGroup;
 
-    using RasterVertexVector = gfx::VertexVector<RasterLayoutVertex>;
-    using RasterVertexVectorPtr = std::shared_ptr<RasterVertexVector>;
-    RasterVertexVectorPtr staticDataVertices;
-
-    using TriangleIndexVector = gfx::IndexVector<gfx::Triangles>;
-    using TriangleIndexVectorPtr = std::shared_ptr<TriangleIndexVector>;
-    TriangleIndexVectorPtr staticDataIndices;
+    // The quad drawn for tiles without their own geometry, shared with other layers through the context
+    gfx::VertexVectorBasePtr staticDataVertices;
+    gfx::IndexVectorBasePtr staticDataIndices;
 
     using RasterSegmentVector = SegmentVector;
     using RasterSegmentVectorPtr = std::shared_ptr<RasterSegmentVector>;
@@ -297,10 +297,7 @@ public:
         const auto evaluated = expression.evaluate(EvaluationContext(&feature).withFeatureState(&state), defaultValue);
         this->statistics.add(evaluated);
 
-        const auto value = BaseVertex{attributeValue(evaluated)};
-        for (std::size_t i = start; i < end; ++i) {
-            vertexVector.at(i) = value;
-        }
+        vertexVector.fill(start, end, BaseVertex{attributeValue(evaluated)});
 
         vertexVector.updateModified();
     }
@@ -416,12 +413,8 @@ public:
         this->statistics.add(range.min);
         this->statistics.add(range.max);
 
-        const Vertex value = Vertex{
-            zoomInterpolatedAttributeValue(attributeValue(range.min), attributeValue(range.max))};
-
-        for (std::size_t i = start; i < end; ++i) {
-            vertexVector.at(i) = value;
-        }
+        vertexVector.fill(
+            start, end, Vertex{zoomInterpolatedAttributeValue(attributeValue(range.min), attributeValue(range.max))});
 
         vertexVector.updateModified();
     }
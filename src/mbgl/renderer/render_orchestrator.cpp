@@ -60,6 +60,14 @@ RendererObserver& nullObserver() {
     return observer;
 }
 
+// Render layers for newly added layers are created once the camera comes within this many zoom levels of their
+// zoom range, so they are ready by the time they become visible. Once created they are kept.
+constexpr float lazyLayerZoomMargin = 1.0f;
+
+bool isNearZoomRange(const style::Layer::Impl& layer, float zoom) {
+    return layer.minZoom - lazyLayerZoomMargin <= zoom && zoom <= layer.maxZoom + lazyLayerZoomMargin;
+}
+
 class RenderTreeImpl final : public RenderTree {
 public:
     RenderTreeImpl(std::unique_ptr<RenderTreeParameters> parameters_,
@@ -153,7 +161,9 @@ void RenderOrchestrator::setObserver(RendererObserver* observer_) {
 }
 
 std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
-    const std::shared_ptr<UpdateParameters>& updateParameters, gfx::DynamicTextureAtlasPtr dynamicTextureAtlas) {
+    const std::shared_ptr<UpdateParameters>& updateParameters,
+    gfx::DynamicTextureAtlasPtr dynamicTextureAtlas,
+    TextureCompressionSupport textureCompressionSupport) {
     MLN_TRACE_FUNC();
 
     const auto startTime = util::MonotonicTimer::now().count();
@@ -198,7 +208,8 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
                                         .tileLodScale = updateParameters->tileLodScale,
                                         .tileLodPitchThreshold = updateParameters->tileLodPitchThreshold,
                                         .tileLodZoomShift = updateParameters->tileLodZoomShift,
-                                        .dynamicTextureAtlas = dynamicTextureAtlas};
+                                        .dynamicTextureAtlas = dynamicTextureAtlas,
+                                        .textureCompressionSupport = textureCompressionSupport};
 
     glyphManager->setURL(updateParameters->glyphURL);
     glyphManager->setFontFaces(updateParameters->fontFaces);
@@ -247,6 +258,7 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
     const LayerDifference layerDiff = diffLayers(layerImpls, updateParameters->layers);
     layerImpls = updateParameters->layers;
     const bool layersAddedOrRemoved = !layerDiff.added.empty() || !layerDiff.removed.empty();
+    bool renderLayersAddedOrRemoved = layersAddedOrRemoved;
 
     std::vector<std::unique_ptr<ChangeRequest>> changes;
 
@@ -258,19 +270,40 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
             hit->second->layerRemoved(changes);
             renderLayers.erase(hit);
         }
+        deferredLayers.erase(entry.first);
     }
 
-    // Create render layers for newly added layers.
+    // Newly added layers far outside of their zoom range get a render layer later, see below.
     for (const auto& entry : layerDiff.added) {
-        MLN_TRACE_ZONE(add layer);
-        auto renderLayer = LayerManager::get()->createRenderLayer(entry.second);
-        renderLayer->transition(transitionParameters);
-        renderLayers.emplace(entry.first, std::move(renderLayer));
+        deferredLayers.insert(entry.first);
+    }
+
+    // Create render layers for the added layers that the camera is near. They are created from the current
+    // style layer, so changes to a layer that was deferred need no further handling.
+    std::unordered_set<std::string> lateCreatedLayers;
+    if (!deferredLayers.empty()) {
+        for (const auto& layerImpl : *layerImpls) {
+            if (!deferredLayers.contains(layerImpl->id) || !isNearZoomRange(*layerImpl, zoomHistory.lastZoom)) {
+                continue;
+            }
+            MLN_TRACE_ZONE(add layer);
+            deferredLayers.erase(layerImpl->id);
+            auto renderLayer = LayerManager::get()->createRenderLayer(layerImpl);
+            renderLayer->transition(transitionParameters);
+            renderLayers.emplace(layerImpl->id, std::move(renderLayer));
+            if (!layerDiff.added.contains(layerImpl->id)) {
+                lateCreatedLayers.insert(layerImpl->id);
+            }
+            renderLayersAddedOrRemoved = true;
+        }
     }
 
     // Update render layers for changed layers.
     for (const auto& entry : layerDiff.changed) {
         MLN_TRACE_ZONE(change layer);
+        if (deferredLayers.contains(entry.first) || lateCreatedLayers.contains(entry.first)) {
+            continue;
+        }
         if (const auto& renderLayer = renderLayers.at(entry.first)) {
             const auto& newLayer = entry.second.after;
 
@@ -279,11 +312,14 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
         }
     }
 
-    if (layersAddedOrRemoved) {
+    if (renderLayersAddedOrRemoved) {
         orderedLayers.clear();
-        orderedLayers.reserve(layerImpls->size());
+        orderedLayers.reserve(renderLayers.size());
         [[maybe_unused]] int32_t layerIndex = 0;
         for (const auto& layerImpl : *layerImpls) {
+            if (deferredLayers.contains(layerImpl->id)) {
+                continue;
+            }
             RenderLayer* layer = renderLayers.at(layerImpl->id).get();
             assert(layer);
             orderedLayers.emplace_back(*layer);
@@ -303,7 +339,9 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
     for (RenderLayer& layer : orderedLayers) {
         MLN_TRACE_ZONE(update layer);
         const std::string& id = layer.getID();
-        const bool layerAddedOrChanged = layerDiff.added.contains(id) || layerDiff.changed.contains(id);
+        const bool layerAddedOrChanged = layerDiff.added.contains(id) || layerDiff.changed.contains(id) ||
+                                         lateCreatedLayers.contains(id);
+
         evaluationParameters.layerChanged = layerAddedOrChanged;
         evaluationParameters.hasCrossfade = layer.hasCrossfade();
 
@@ -381,6 +419,7 @@ std::unique_ptr<RenderTree> RenderOrchestrator::createRenderTree(
                     const std::string& layerId = layer.getID();
                     sourceNeedsRelayout = (sourceNeedsRelayout || hasImageDiff ||
                                            constantsMaskChanged.contains(layerId) ||
+                                           lateCreatedLayers.contains(layerId) ||
                                            hasLayoutDifference(layerDiff, layerId));
                     if (layerIsVisible) {
                         filteredLayersForSource.push_back(layer.evaluatedProperties);
@@ -15,11 +15,13 @@
 #include <mbgl/renderer/image_manager_observer.hpp>
 #include <mbgl/text/placement.hpp>
 #include <mbgl/renderer/render_tree.hpp>
+#include <mbgl/util/compressed_image.hpp>
 
 #include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace mbgl {
@@ -66,7 +68,9 @@ public:
     // TODO: Introduce RenderOrchestratorObserver.
     void setObserver(RendererObserver*);
 
-    std::unique_ptr<RenderTree> createRenderTree(const std::shared_ptr<UpdateParameters>&, gfx::DynamicTextureAtlasPtr);
+    std::unique_ptr<RenderTree> createRenderTree(const std::shared_ptr<UpdateParameters>&,
+                                                 gfx::DynamicTextureAtlasPtr,
+                                                 TextureCompressionSupport);
 
     std::vector<Feature> queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&) const;
     std::vector<Feature> querySourceFeatures(const std::string& sourceID, const SourceQueryOptions&) const;
@@ -157,6 +161,8 @@ public:
 
     const ZoomHistory& getZoomHistory() const { return zoomHistory; }
 
+    const RenderLayer* getRenderLayer(const std::string& id) const;
+
 private:
     bool isLoaded() const;
     bool hasTransitions(TimePoint) const;
@@ -164,7 +170,6 @@ private:
     RenderSource* getRenderSource(const std::string& id) const;
 
     RenderLayer* getRenderLayer(const std::string& id);
-    const RenderLayer* getRenderLayer(const std::string& id) const;
 
     void queryRenderedSymbols(std::unordered_map<std::string, std::vector<Feature>>& resultsByLayer,
                               const ScreenLineString& geometry,
@@ -207,6 +212,8 @@ private:
 
     std::unordered_map<std::string, std::unique_ptr<RenderSource>> renderSources;
     std::unordered_map<std::string, std::unique_ptr<RenderLayer>> renderLayers;
+    // Style layers without a render layer yet, because the camera never came near their zoom range.
+    std::unordered_set<std::string> deferredLayers;
     RenderLight renderLight;
 
     CrossTileSymbolIndex crossTileSymbolIndex;
@@ -23,6 +23,7 @@ Renderer::~Renderer() {
 
 void Renderer::markContextLost() {
     impl->orchestrator.markContextLost();
+    impl->invalidateFrame();
 }
 
 void Renderer::setObserver(RendererObserver* observer) {
@@ -30,19 +31,40 @@ void Renderer::setObserver(RendererObserver* observer) {
     impl->orchestrator.setObserver(observer);
 }
 
-void Renderer::render(const std::shared_ptr<UpdateParameters>& updateParameters) {
+bool Renderer::render(const std::shared_ptr<UpdateParameters>& updateParameters) {
     MLN_TRACE_FUNC();
     assert(updateParameters);
+    if (impl->isUnchangedFrame(updateParameters)) {
+        return false;
+    }
     const bool styleChanged = impl->styleLoaded && !updateParameters->styleLoaded;
     impl->styleLoaded = updateParameters->styleLoaded;
+    auto& context = impl->backend.getContext();
     if (!impl->dynamicTextureAtlas || styleChanged) {
-        auto& context = impl->backend.getContext();
         impl->dynamicTextureAtlas = std::make_unique<gfx::DynamicTextureAtlas>(context);
+        impl->dynamicTextureAtlas->setMemoryBudget(impl->atlasMemoryBudget);
     }
-    if (auto renderTree = impl->orchestrator.createRenderTree(updateParameters, impl->dynamicTextureAtlas)) {
+    if (auto renderTree = impl->orchestrator.createRenderTree(
+            updateParameters, impl->dynamicTextureAtlas, context.getTextureCompressionSupport())) {
         renderTree->prepare();
         impl->render(*renderTree, updateParameters);
+        return true;
     }
+    return false;
+}
+
+void Renderer::setSkipUnchangedFrames(bool skip) {
+    impl->skipUnchangedFrames = skip;
+}
+
+bool Renderer::getSkipUnchangedFrames() const {
+    return impl->skipUnchangedFrames;
+}
+
+void Renderer::warmUpShaders(const std::shared_ptr<UpdateParameters>& updateParameters) {
+    MLN_TRACE_FUNC();
+    assert(updateParameters);
+    impl->warmUpShaders(updateParameters);
 }
 
 std::vector<Feature> Renderer::queryRenderedFeatures(const ScreenLineString& geometry,
@@ -113,6 +135,7 @@ void Renderer::setFeatureState(const std::string& sourceID,
                                const std::string& featureID,
                                const FeatureState& state) {
     impl->orchestrator.setFeatureState(sourceID, sourceLayerID, featureID, state);
+    impl->invalidateFrame();
 }
 
 void Renderer::getFeatureState(FeatureState& state,
@@ -127,6 +150,7 @@ void Renderer::removeFeatureState(const std::string& sourceID,
                                   const std::optional<std::string>& featureID,
                                   const std::optional<std::string>& stateKey) {
     impl->orchestrator.removeFeatureState(sourceID, sourceLayerID, featureID, stateKey);
+    impl->invalidateFrame();
 }
 
 void Renderer::dumpDebugLogs() {
@@ -153,10 +177,26 @@ void Renderer::reduceMemoryUse() {
     gfx::BackendScope guard{impl->backend};
     impl->reduceMemoryUse();
     impl->orchestrator.reduceMemoryUse();
+    impl->invalidateFrame();
+    if (impl->dynamicTextureAtlas) {
+        impl->dynamicTextureAtlas->reduceMemoryUse();
+    }
+}
+
+void Renderer::setAtlasMemoryBudget(std::size_t bytes) {
+    impl->atlasMemoryBudget = bytes;
+    if (impl->dynamicTextureAtlas) {
+        impl->dynamicTextureAtlas->setMemoryBudget(bytes);
+    }
+}
+
+std::size_t Renderer::getAtlasMemoryBudget() const {
+    return impl->atlasMemoryBudget;
 }
 
 void Renderer::clearData() {
     impl->orchestrator.clearData();
+    impl->invalidateFrame();
 }
 
 #if MLN_RENDER_BACKEND_OPENGL
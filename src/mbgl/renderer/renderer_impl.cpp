@@ -8,14 +8,17 @@
 #include <mbgl/gfx/renderer_backend.hpp>
 #include <mbgl/gfx/renderable.hpp>
 #include <mbgl/gfx/upload_pass.hpp>
+#include <mbgl/gfx/vector_pool.hpp>
 #include <mbgl/renderer/paint_parameters.hpp>
 #include <mbgl/renderer/pattern_atlas.hpp>
 #include <mbgl/renderer/renderer_observer.hpp>
 #include <mbgl/renderer/render_static_data.hpp>
 #include <mbgl/renderer/render_tree.hpp>
+#include <mbgl/renderer/shader_warm_up.hpp>
 #include <mbgl/renderer/update_parameters.hpp>
 #include <mbgl/shaders/program_parameters.hpp>
 #include <mbgl/util/convert.hpp>
+#include <mbgl/util/image_pool.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/util/instrumentation.hpp>
@@ -61,23 +64,46 @@ Renderer::Impl::Impl(gfx::RendererBackend& backend_,
 
 Renderer::Impl::~Impl() {
     assert(gfx::BackendScope::exists());
+
+    // A background warm-up reports back through this object
+    if (shaderWarmUp) {
+        shaderWarmUp->wait();
+    }
 };
 
 void Renderer::Impl::onPreCompileShader(shaders::BuiltIn shaderID,
                                         gfx::Backend::Type type,
                                         const std::string& additionalDefines) {
+    if (ShaderWarmUp::onWarmUpThread()) {
+        shaderWarmUp->defer([this, shaderID, type, additionalDefines] {
+            observer->onPreCompileShader(shaderID, type, additionalDefines);
+        });
+        return;
+    }
     observer->onPreCompileShader(shaderID, type, additionalDefines);
 }
 
 void Renderer::Impl::onPostCompileShader(shaders::BuiltIn shaderID,
                                          gfx::Backend::Type type,
                                          const std::string& additionalDefines) {
+    if (ShaderWarmUp::onWarmUpThread()) {
+        shaderWarmUp->defer([this, shaderID, type, additionalDefines] {
+            observer->onPostCompileShader(shaderID, type, additionalDefines);
+        });
+        return;
+    }
     observer->onPostCompileShader(shaderID, type, additionalDefines);
 }
 
 void Renderer::Impl::onShaderCompileFailed(shaders::BuiltIn shaderID,
                                            gfx::Backend::Type type,
                                            const std::string& additionalDefines) {
+    if (ShaderWarmUp::onWarmUpThread()) {
+        shaderWarmUp->defer([this, shaderID, type, additionalDefines] {
+            observer->onShaderCompileFailed(shaderID, type, additionalDefines);
+        });
+        return;
+    }
     observer->onShaderCompileFailed(shaderID, type, additionalDefines);
 }
 
@@ -163,15 +189,11 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
     backend.getDefaultRenderable().wait();
     context.beginFrame();
 
-    if (!staticData) {
-        staticData = std::make_unique<RenderStaticData>(std::make_unique<gfx::ShaderRegistry>());
-
-        // Initialize shaders for drawables
-        const auto programParameters = ProgramParameters{pixelRatio, false};
-        backend.initShaders(*staticData->shaders, programParameters);
+    initShaders();
 
-        // Notify post-shader registration
-        observer->onRegisterShaders(*staticData->shaders);
+    // Report the shaders that a warm-up compiled in the background since the last frame
+    if (shaderWarmUp) {
+        shaderWarmUp->flush();
     }
 
     const auto& renderTreeParameters = renderTree.getParameters();
@@ -230,6 +252,8 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
     // - LAYER GROUP UPDATE ------------------------------------------------------------------------
     // Updates all layer groups and process changes
     if (staticData && staticData->shaders) {
+        // Layers add to this as they update, which is before the backend resets the per-frame counters
+        context.renderingStats().numCulledDrawables = 0;
         orchestrator.updateLayers(
             *staticData->shaders, context, renderTreeParameters.transformParams.state, updateParameters, renderTree);
     }
@@ -459,13 +483,54 @@ void Renderer::Impl::render(const RenderTree& renderTree, const std::shared_ptr<
         observer->onDidFinishRenderingMap();
     }
 
+    lastFrameParameters = updateParameters;
+    lastFrameSize = staticData->backendSize;
+    lastFrameSettled = renderTreeParameters.mapMode == MapMode::Continuous && renderTreeParameters.loaded &&
+                       !renderTreeParameters.needsRepaint && !renderTreeParameters.placementChanged;
+
     frameCount += 1;
     MLN_END_FRAME();
 }
 
+bool Renderer::Impl::isUnchangedFrame(const std::shared_ptr<UpdateParameters>& updateParameters) const {
+    // Every change to the map comes with a new update, so the same one means the same frame
+    return skipUnchangedFrames && lastFrameSettled && lastFrameParameters.lock() == updateParameters &&
+           backend.getDefaultRenderable().getSize() == lastFrameSize;
+}
+
+void Renderer::Impl::initShaders() {
+    if (staticData) {
+        return;
+    }
+
+    staticData = std::make_unique<RenderStaticData>(std::make_unique<gfx::ShaderRegistry>());
+
+    // Initialize shaders for drawables
+    const auto programParameters = ProgramParameters{pixelRatio, false};
+    backend.initShaders(*staticData->shaders, programParameters);
+
+    // Notify post-shader registration
+    observer->onRegisterShaders(*staticData->shaders);
+}
+
+void Renderer::Impl::warmUpShaders(const std::shared_ptr<UpdateParameters>& updateParameters) {
+    MLN_TRACE_FUNC();
+    auto& context = backend.getContext();
+    context.setObserver(this);
+
+    initShaders();
+
+    if (!shaderWarmUp) {
+        shaderWarmUp = std::make_unique<ShaderWarmUp>(backend.getThreadPool());
+    }
+    shaderWarmUp->start(context, *staticData->shaders, collectShaderPermutations(*updateParameters->layers));
+}
+
 void Renderer::Impl::reduceMemoryUse() {
     assert(gfx::BackendScope::exists());
     backend.getContext().reduceMemoryUsage();
+    gfx::clearVectorPools();
+    ImagePool::get().clear();
 }
 
 } // namespace mbgl
@@ -2,6 +2,7 @@
 
 #include <mbgl/renderer/render_orchestrator.hpp>
 #include <mbgl/gfx/context_observer.hpp>
+#include <mbgl/util/size.hpp>
 
 #if MLN_RENDER_BACKEND_METAL
 #include <mbgl/mtl/mtl_fwd.hpp>
@@ -16,6 +17,7 @@ namespace mbgl {
 class RendererObserver;
 class RenderStaticData;
 class RenderTree;
+class ShaderWarmUp;
 
 namespace gfx {
 class RendererBackend;
@@ -41,8 +43,19 @@ private:
 
     void render(const RenderTree&, const std::shared_ptr<UpdateParameters>&);
 
+    /// Create the shader registry, the first time it's needed
+    void initShaders();
+
+    void warmUpShaders(const std::shared_ptr<UpdateParameters>&);
+
     void reduceMemoryUse();
 
+    /// Whether rendering the update again would draw the same frame as the last one
+    bool isUnchangedFrame(const std::shared_ptr<UpdateParameters>&) const;
+
+    /// Make sure the next frame is drawn, after a change that doesn't come with a new update
+    void invalidateFrame() { lastFrameSettled = false; }
+
     // TODO: Move orchestrator to Map::Impl.
     RenderOrchestrator orchestrator;
 
@@ -52,9 +65,18 @@ private:
 
     const float pixelRatio;
     std::unique_ptr<RenderStaticData> staticData;
+    // Declared after the shader registry it compiles into, so that a warm-up finishes before the registry goes away
+    std::unique_ptr<ShaderWarmUp> shaderWarmUp;
     gfx::DynamicTextureAtlasPtr dynamicTextureAtlas;
+    std::size_t atlasMemoryBudget = 0;
     bool styleLoaded = false;
 
+    bool skipUnchangedFrames = false;
+    /// The update of the last frame that was drawn, and whether that frame had nothing left to load, fade or transition
+    std::weak_ptr<UpdateParameters> lastFrameParameters;
+    Size lastFrameSize;
+    bool lastFrameSettled = false;
+
     enum class RenderState {
         Never,
         Partial,
@@ -0,0 +1,281 @@
+#include <mbgl/renderer/shader_warm_up.hpp>
+
+#include <mbgl/gfx/context.hpp>
+#include <mbgl/gfx/shader_registry.hpp>
+#include <mbgl/shaders/shader_defines.hpp>
+#include <mbgl/style/layers/background_layer_impl.hpp>
+#include <mbgl/style/layers/circle_layer_impl.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer_impl.hpp>
+#include <mbgl/style/layers/fill_layer_impl.hpp>
+#include <mbgl/style/layers/heatmap_layer_impl.hpp>
+#include <mbgl/style/layers/hillshade_layer_impl.hpp>
+#include <mbgl/style/layers/line_layer_impl.hpp>
+#include <mbgl/style/layers/raster_layer_impl.hpp>
+#include <mbgl/style/layers/symbol_layer_impl.hpp>
+#include <mbgl/util/instrumentation.hpp>
+#include <mbgl/util/logging.hpp>
+
+#include <algorithm>
+#include <exception>
+
+namespace mbgl {
+
+using namespace style;
+using namespace shaders;
+
+namespace {
+
+thread_local bool warmUpThread = false;
+
+constexpr auto posNormalAttribName = "a_pos_normal";
+constexpr auto posOffsetAttribName = "a_pos_offset";
+
+template <typename Property>
+void addPredictedUniform(const bool dataDriven, StringIDSetsPair& propertiesAsUniforms, std::size_t& attrId) {
+    for (const auto& attributeName : Property::AttributeNames) {
+        if (!dataDriven) {
+            propertiesAsUniforms.first.emplace(attributeName);
+            propertiesAsUniforms.second.emplace(attrId);
+        }
+        attrId++;
+    }
+}
+
+/// Mirrors `readDataDrivenPaintProperties` with the unevaluated paint properties, where a property that isn't
+/// data-driven evaluates to a constant.
+template <typename... Properties, typename Paint>
+StringIDSetsPair predictUniforms(const Paint& paint, const std::size_t firstDataDrivenAttrId) {
+    StringIDSetsPair propertiesAsUniforms;
+    std::size_t attrId = firstDataDrivenAttrId;
+    (addPredictedUniform<Properties>(
+         paint.template get<Properties>().value.isDataDriven(), propertiesAsUniforms, attrId),
+     ...);
+    return propertiesAsUniforms;
+}
+
+template <typename Property, typename Paint>
+bool isDefined(const Paint& paint) {
+    return !paint.template get<Property>().value.isUndefined();
+}
+
+void add(std::vector<ShaderPermutation>& permutations,
+         std::string groupName,
+         StringIDSetsPair propertiesAsUniforms = {},
+         std::string_view firstAttribName = "a_pos") {
+    const auto duplicate = std::ranges::any_of(permutations, [&](const ShaderPermutation& permutation) {
+        return permutation.groupName == groupName &&
+               permutation.propertiesAsUniforms.second == propertiesAsUniforms.second &&
+               permutation.firstAttribName == firstAttribName;
+    });
+    if (!duplicate) {
+        permutations.push_back({std::move(groupName), std::move(propertiesAsUniforms), firstAttribName});
+    }
+}
+
+void collectFill(const FillLayer::Impl& impl, std::vector<ShaderPermutation>& permutations) {
+    const auto& paint = impl.paint;
+    const auto uniforms = predictUniforms<FillColor, FillOpacity, FillOutlineColor, FillPattern>(
+        paint, idFillColorVertexAttribute);
+
+    const auto& antialias = paint.get<FillAntialias>().value;
+    const bool outline = !antialias.isConstant() || antialias.asConstant();
+
+    if (isDefined<FillPattern>(paint)) {
+        add(permutations, "FillPatternShader", uniforms);
+        if (outline && !isDefined<FillOutlineColor>(paint)) {
+            add(permutations, "FillOutlinePatternShader", uniforms);
+        }
+        return;
+    }
+
+    add(permutations, "FillShader", uniforms);
+    if (outline) {
+#if MLN_TRIANGULATE_FILL_OUTLINES
+        if (!paint.get<FillOutlineColor>().value.isDataDriven() && !paint.get<FillOpacity>().value.isDataDriven()) {
+            add(permutations,
+                "FillOutlineTriangulatedShader",
+                {{"a_color", "a_opacity", "a_width"},
+                 {idLineColorVertexAttribute, idLineOpacityVertexAttribute, idLineWidthVertexAttribute}});
+        }
+#endif
+        add(permutations, "FillOutlineShader", uniforms);
+    }
+}
+
+void collectLine(const LineLayer::Impl& impl, std::vector<ShaderPermutation>& permutations) {
+    const auto& paint = impl.paint;
+    auto uniforms = predictUniforms<LineColor,
+                                    LineBlur,
+                                    LineOpacity,
+                                    LineGapWidth,
+                                    LineOffset,
+                                    LineWidth,
+                                    LineFloorWidth,
+                                    LinePattern>(paint, idLineColorVertexAttribute);
+
+    if (isDefined<LineDasharray>(paint)) {
+        add(permutations, "LineSDFShader", std::move(uniforms), posNormalAttribName);
+    } else if (isDefined<LinePattern>(paint)) {
+        add(permutations, "LinePatternShader", std::move(uniforms), posNormalAttribName);
+    } else if (!paint.get<LineGradient>().value.isUndefined()) {
+        add(permutations, "LineGradientShader", std::move(uniforms), posNormalAttribName);
+    } else {
+        add(permutations, "LineShader", std::move(uniforms), posNormalAttribName);
+    }
+}
+
+void collectCircle(const CircleLayer::Impl& impl, std::vector<ShaderPermutation>& permutations) {
+    add(permutations,
+        "CircleShader",
+        predictUniforms<CircleColor,
+                        CircleRadius,
+                        CircleBlur,
+                        CircleOpacity,
+                        CircleStrokeColor,
+                        CircleStrokeWidth,
+                        CircleStrokeOpacity>(impl.paint, idCircleColorVertexAttribute));
+}
+
+void collectFillExtrusion(const FillExtrusionLayer::Impl& impl, std::vector<ShaderPermutation>& permutations) {
+    const auto& paint = impl.paint;
+    add(permutations,
+        isDefined<FillExtrusionPattern>(paint) ? "FillExtrusionPatternShader" : "FillExtrusionShader",
+        predictUniforms<FillExtrusionBase, FillExtrusionColor, FillExtrusionHeight, FillExtrusionPattern>(
+            paint, idFillExtrusionBaseVertexAttribute));
+}
+
+void collectHeatmap(const HeatmapLayer::Impl& impl, std::vector<ShaderPermutation>& permutations) {
+    add(permutations,
+        "HeatmapShader",
+        predictUniforms<HeatmapWeight, HeatmapRadius>(impl.paint, idHeatmapWeightVertexAttribute));
+    add(permutations, "HeatmapTextureShader");
+}
+
+void collectSymbol(const SymbolLayer::Impl& impl, std::vector<ShaderPermutation>& permutations) {
+    const auto& paint = impl.paint;
+
+    if (!impl.layout.get<TextField>().isUndefined()) {
+        const auto uniforms = predictUniforms<TextOpacity, TextColor, TextHaloColor, TextHaloWidth, TextHaloBlur>(
+            paint, idSymbolOpacityVertexAttribute);
+        add(permutations, "SymbolSDFShader", uniforms, posOffsetAttribName);
+        // Only formatted text can place images inline
+        if (impl.layout.get<TextField>().isExpression()) {
+            add(permutations, "SymbolTextAndIconShader", uniforms, posOffsetAttribName);
+        }
+    }
+
+    if (!impl.layout.get<IconImage>().isUndefined()) {
+        const auto uniforms = predictUniforms<IconOpacity, IconColor, IconHaloColor, IconHaloWidth, IconHaloBlur>(
+            paint, idSymbolOpacityVertexAttribute);
+        add(permutations, "SymbolIconShader", uniforms, posOffsetAttribName);
+        // Whether icons are SDF depends on the images, coloring them is a good hint
+        if (isDefined<IconColor>(paint) || isDefined<IconHaloColor>(paint)) {
+            add(permutations, "SymbolSDFShader", uniforms, posOffsetAttribName);
+        }
+    }
+}
+
+} // namespace
+
+std::vector<ShaderPermutation> collectShaderPermutations(const std::vector<Immutable<Layer::Impl>>& layers) {
+    std::vector<ShaderPermutation> permutations;
+    for (const auto& layer : layers) {
+        const auto* typeInfo = layer->getTypeInfo();
+        if (typeInfo == FillLayer::Impl::staticTypeInfo()) {
+            collectFill(static_cast<const FillLayer::Impl&>(*layer), permutations);
+        } else if (typeInfo == LineLayer::Impl::staticTypeInfo()) {
+            collectLine(static_cast<const LineLayer::Impl&>(*layer), permutations);
+        } else if (typeInfo == CircleLayer::Impl::staticTypeInfo()) {
+            collectCircle(static_cast<const CircleLayer::Impl&>(*layer), permutations);
+        } else if (typeInfo == FillExtrusionLayer::Impl::staticTypeInfo()) {
+            collectFillExtrusion(static_cast<const FillExtrusionLayer::Impl&>(*layer), permutations);
+        } else if (typeInfo == HeatmapLayer::Impl::staticTypeInfo()) {
+            collectHeatmap(static_cast<const HeatmapLayer::Impl&>(*layer), permutations);
+        } else if (typeInfo == SymbolLayer::Impl::staticTypeInfo()) {
+            collectSymbol(static_cast<const SymbolLayer::Impl&>(*layer), permutations);
+        } else if (typeInfo == BackgroundLayer::Impl::staticTypeInfo()) {
+            const auto& paint = static_cast<const BackgroundLayer::Impl&>(*layer).paint;
+            add(permutations, isDefined<BackgroundPattern>(paint) ? "BackgroundPatternShader" : "BackgroundShader");
+        } else if (typeInfo == RasterLayer::Impl::staticTypeInfo()) {
+            add(permutations, "RasterShader");
+        } else if (typeInfo == HillshadeLayer::Impl::staticTypeInfo()) {
+            add(permutations, "HillshadePrepareShader");
+            add(permutations, "HillshadeShader");
+        }
+    }
+    return permutations;
+}
+
+ShaderWarmUp::ShaderWarmUp(TaggedScheduler threadPool_)
+    : threadPool(std::move(threadPool_)) {}
+
+ShaderWarmUp::~ShaderWarmUp() {
+    wait();
+}
+
+void ShaderWarmUp::start(gfx::Context& context,
+                         gfx::ShaderRegistry& shaders,
+                         std::vector<ShaderPermutation> permutations) {
+    MLN_TRACE_FUNC();
+    wait();
+
+    if (!context.supportsBackgroundShaderCompilation()) {
+        compile(context, shaders, permutations);
+        return;
+    }
+
+    auto promise = std::make_shared<std::promise<void>>();
+    pending = promise->get_future();
+    threadPool.schedule([&context, &shaders, permutations_ = std::move(permutations), promise]() {
+        warmUpThread = true;
+        compile(context, shaders, permutations_);
+        warmUpThread = false;
+        promise->set_value();
+    });
+}
+
+void ShaderWarmUp::wait() {
+    if (pending.valid()) {
+        pending.get();
+    }
+}
+
+bool ShaderWarmUp::onWarmUpThread() noexcept {
+    return warmUpThread;
+}
+
+void ShaderWarmUp::defer(std::function<void()>&& fn) {
+    std::lock_guard<std::mutex> lock(deferredMutex);
+    deferred.emplace_back(std::move(fn));
+}
+
+void ShaderWarmUp::flush() {
+    std::vector<std::function<void()>> ready;
+    {
+        std::lock_guard<std::mutex> lock(deferredMutex);
+        ready.swap(deferred);
+    }
+    for (auto& fn : ready) {
+        fn();
+    }
+}
+
+void ShaderWarmUp::compile(gfx::Context& context,
+                           gfx::ShaderRegistry& shaders,
+                           const std::vector<ShaderPermutation>& permutations) {
+    MLN_TRACE_FUNC();
+    for (const auto& permutation : permutations) {
+        const auto group = shaders.getShaderGroup(permutation.groupName);
+        if (!group) {
+            continue;
+        }
+        try {
+            group->getOrCreateShader(context, permutation.propertiesAsUniforms, permutation.firstAttribName);
+        } catch (const std::exception& e) {
+            // The layer will try again, and report the failure, when it draws
+            Log::Warning(Event::Shader, "Failed to warm up " + permutation.groupName + ": " + e.what());
+        }
+    }
+}
+
+} // namespace mbgl
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <mbgl/actor/scheduler.hpp>
+#include <mbgl/gfx/shader_group.hpp>
+#include <mbgl/style/layer_impl.hpp>
+#include <mbgl/util/immutable.hpp>
+
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace mbgl {
+
+namespace gfx {
+class Context;
+class ShaderRegistry;
+} // namespace gfx
+
+/// A shader variant that a layer is expected to request when it builds its drawables
+struct ShaderPermutation {
+    std::string groupName;
+    StringIDSetsPair propertiesAsUniforms;
+    std::string_view firstAttribName = "a_pos";
+};
+
+/// Predict the shader variants that the layers will draw with. Paint properties that aren't data-driven are expected
+/// to become uniforms, the same way `VertexAttributeArray::readDataDrivenPaintProperties` decides per tile.
+std::vector<ShaderPermutation> collectShaderPermutations(const std::vector<Immutable<style::Layer::Impl>>&);
+
+/// Compiles shader variants ahead of the first frame that needs them
+class ShaderWarmUp {
+public:
+    ShaderWarmUp(TaggedScheduler threadPool_);
+    ~ShaderWarmUp();
+
+    /// Compile the variants, on the thread pool if the context supports it and before returning otherwise.
+    /// A warm-up that is still running is waited for first.
+    void start(gfx::Context&, gfx::ShaderRegistry&, std::vector<ShaderPermutation>);
+
+    /// Block until the current warm-up is done
+    void wait();
+
+    /// Whether the calling thread is compiling shaders for a background warm-up
+    static bool onWarmUpThread() noexcept;
+
+    /// Queue a notification raised on a warm-up thread, to be delivered on the render thread
+    void defer(std::function<void()>&&);
+
+    /// Deliver the notifications queued since the last call. Must be called on the render thread.
+    void flush();
+
+private:
+    static void compile(gfx::Context&, gfx::ShaderRegistry&, const std::vector<ShaderPermutation>&);
+
+    TaggedScheduler threadPool;
+    std::future<void> pending;
+
+    std::mutex deferredMutex;
+    std::vector<std::function<void()>> deferred;
+};
+
+} // namespace mbgl
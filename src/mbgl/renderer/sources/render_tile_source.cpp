@@ -192,6 +192,8 @@ void TileSourceRenderItem::updateDebugDrawables(DebugLayerGroupMap& debugLayerGr
         builder->setCullFaceMode(gfx::CullFaceMode::disabled());
         builder->setVertexAttrId(idDebugPosVertexAttribute);
         builder->setDrawableName(drawableName);
+        // Borders are the same for every tile, and the outline and text of a tile are the same
+        builder->setSharedGeometry(true);
 
         return builder;
     }();
@@ -1,5 +1,7 @@
 #include <mbgl/renderer/layer_group.hpp>
 
+#include <mbgl/gfx/color_mode.hpp>
+#include <mbgl/gfx/cull_face_mode.hpp>
 #include <mbgl/gfx/upload_pass.hpp>
 
 #include <algorithm>
@@ -8,6 +10,40 @@
 
 namespace mbgl {
 
+namespace {
+
+bool sameColorMode(const gfx::ColorMode& a, const gfx::ColorMode& b) {
+    const auto factors = [](const gfx::ColorMode::BlendFunction& blend) {
+        return blend.match([](const auto& f) { return std::make_pair(f.srcFactor, f.dstFactor); });
+    };
+    return a.blendFunction.which() == b.blendFunction.which() && factors(a.blendFunction) == factors(b.blendFunction) &&
+           a.blendColor == b.blendColor && !(a.mask != b.mask);
+}
+
+bool sameCullFaceMode(const gfx::CullFaceMode& a, const gfx::CullFaceMode& b) {
+    return a.enabled == b.enabled && a.side == b.side && a.winding == b.winding;
+}
+
+/// Whether two drawables can be drawn one after the other without changing the shader, textures or render state
+bool sameDrawState(const gfx::Drawable& a, const gfx::Drawable& b) {
+    if (a.getIsCustom() || b.getIsCustom()) {
+        return false;
+    }
+    const auto& texturesA = a.getTextures();
+    const auto& texturesB = b.getTextures();
+    return a.getShader() == b.getShader() && a.getIs3D() == b.getIs3D() &&
+           a.getEnableDepth() == b.getEnableDepth() && a.getEnableStencil() == b.getEnableStencil() &&
+           a.getEnableColor() == b.getEnableColor() && a.getSubLayerIndex() == b.getSubLayerIndex() &&
+           a.getDepthType() == b.getDepthType() && a.getLineWidth() == b.getLineWidth() &&
+           sameCullFaceMode(a.getCullFaceMode(), b.getCullFaceMode()) &&
+           sameColorMode(a.getColorMode(), b.getColorMode()) &&
+           std::equal(texturesA.begin(), texturesA.end(), texturesB.begin(), [](const auto& ta, const auto& tb) {
+               return ta.get() == tb.get();
+           });
+}
+
+} // namespace
+
 LayerGroupBase::LayerGroupBase(int32_t layerIndex_, std::string name_, Type type_)
     : type(type_),
       layerIndex(layerIndex_),
@@ -41,6 +77,7 @@ std::vector<gfx::UniqueDrawable> TileLayerGroup::removeDrawables(mbgl::RenderPas
             return std::move(pair.second);
         });
     drawablesByTile.erase(range.first, range.second);
+    batchedDrawables.clear();
     std::ranges::for_each(result, [&](const auto& item) {
         const auto hit = sortedDrawables.find(item.get());
         assert(hit != sortedDrawables.end());
@@ -67,9 +104,77 @@ std::size_t TileLayerGroup::clearDrawables() {
     assert(count == sortedDrawables.size());
     sortedDrawables.clear();
     drawablesByTile.clear();
+    batchedDrawables.clear();
     return count;
 }
 
+const std::vector<TileLayerGroup::DrawableBatch>& TileLayerGroup::batchDrawables(mbgl::RenderPass pass) {
+    batchedDrawables.clear();
+    drawableBatches.clear();
+
+    for (auto* drawable : sortedDrawables) {
+        if (drawable->getEnabled() && drawable->hasRenderPass(pass)) {
+            batchedDrawables.push_back(drawable);
+        }
+    }
+
+    // Drawables of different priorities are drawn in order, so only those with the same priority are regrouped.
+    // Blended drawables of different tiles can overlap and are drawn in their sorted order, so that only opaque ones,
+    // which are depth tested, are regrouped.
+    const bool regroup = pass == RenderPass::Opaque;
+    std::vector<std::size_t> groupStarts;
+    std::unordered_map<OverscaledTileID, std::size_t> lastGroupOfTile;
+    for (std::size_t runBegin = 0; runBegin < batchedDrawables.size();) {
+        const auto priority = batchedDrawables[runBegin]->getDrawPriority();
+        std::size_t runEnd = runBegin + 1;
+        while (runEnd < batchedDrawables.size() && batchedDrawables[runEnd]->getDrawPriority() == priority) {
+            ++runEnd;
+        }
+
+        // Assign each drawable to the first group with the same state. The groups are drawn in the order they first
+        // appear, which keeps the order within each tile unless a tile has them the other way around.
+        batchScratch.clear();
+        groupStarts.clear();
+        lastGroupOfTile.clear();
+        std::size_t lastGroupWithoutTile = 0;
+        bool keepsTileOrder = regroup;
+        for (auto i = runBegin; keepsTileOrder && i < runEnd; ++i) {
+            auto* drawable = batchedDrawables[i];
+            const auto hit = std::ranges::find_if(
+                groupStarts, [&](const auto start) { return sameDrawState(*batchedDrawables[start], *drawable); });
+            const auto group = static_cast<std::size_t>(std::distance(groupStarts.begin(), hit));
+            if (hit == groupStarts.end()) {
+                groupStarts.push_back(i);
+            }
+            batchScratch.emplace_back(group, drawable);
+
+            auto& lastGroup = drawable->getTileID() ? lastGroupOfTile[*drawable->getTileID()] : lastGroupWithoutTile;
+            keepsTileOrder = group >= lastGroup;
+            lastGroup = group;
+        }
+
+        if (keepsTileOrder) {
+            std::ranges::stable_sort(batchScratch, {}, [](const auto& item) { return item.first; });
+            for (auto i = runBegin; i < runEnd; ++i) {
+                batchedDrawables[i] = batchScratch[i - runBegin].second;
+            }
+        }
+
+        // Split the run where the state changes
+        for (auto i = runBegin; i < runEnd; ++i) {
+            if (i == runBegin || !sameDrawState(*batchedDrawables[i - 1], *batchedDrawables[i])) {
+                drawableBatches.push_back({.begin = i, .end = i + 1});
+            } else {
+                drawableBatches.back().end = i + 1;
+            }
+        }
+
+        runBegin = runEnd;
+    }
+
+    return drawableBatches;
+}
+
 void TileLayerGroup::setStencilTiles(RenderTiles tiles) {
     stencilTiles = std::move(tiles);
 }
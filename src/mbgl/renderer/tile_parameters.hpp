@@ -2,6 +2,7 @@
 
 #include <mbgl/map/mode.hpp>
 #include <mbgl/actor/scheduler.hpp>
+#include <mbgl/util/compressed_image.hpp>
 
 #include <memory>
 #include <numbers>
@@ -38,6 +39,7 @@ public:
     double tileLodPitchThreshold = (60.0 / 180.0) * std::numbers::pi;
     double tileLodZoomShift = 0;
     gfx::DynamicTextureAtlasPtr dynamicTextureAtlas;
+    TextureCompressionSupport textureCompressionSupport;
 };
 
 } // namespace mbgl
@@ -17,8 +17,11 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
+#include <rapidjson/reader.h>
 
 #include <algorithm>
+#include <cassert>
+#include <deque>
 #include <memory>
 #include <set>
 #include <unordered_set>
@@ -26,6 +29,266 @@
 namespace mbgl {
 namespace style {
 
+namespace {
+
+// Assembles a JSValue from SAX events. Completed values are kept on a stack until the
+// enclosing object or array ends, mirroring what rapidjson does internally for a DOM.
+class JSValueBuilder {
+public:
+    bool Null() { return push(); }
+    bool Bool(bool value) { return push(value); }
+    bool Int(int value) { return push(value); }
+    bool Uint(unsigned value) { return push(value); }
+    bool Int64(int64_t value) { return push(value); }
+    bool Uint64(uint64_t value) { return push(value); }
+    bool Double(double value) { return push(value); }
+    bool RawNumber(const char*, rapidjson::SizeType, bool) { return false; }
+    bool String(const char* str, rapidjson::SizeType length, bool) { return push(str, length, allocator); }
+    bool Key(const char* str, rapidjson::SizeType length, bool) { return push(str, length, allocator); }
+
+    bool StartObject() {
+        ++depth;
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount) {
+        JSValue object(rapidjson::kObjectType);
+        for (auto i = stack.size() - 2 * memberCount; i < stack.size(); i += 2) {
+            object.AddMember(stack[i], stack[i + 1], allocator);
+        }
+        return pop(2 * memberCount, object);
+    }
+
+    bool StartArray() {
+        ++depth;
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType elementCount) {
+        JSValue array(rapidjson::kArrayType);
+        array.Reserve(elementCount, allocator);
+        for (auto i = stack.size() - elementCount; i < stack.size(); ++i) {
+            array.PushBack(stack[i], allocator);
+        }
+        return pop(elementCount, array);
+    }
+
+    // Whether a complete value has been assembled
+    bool complete() const { return depth == 0 && stack.size() == 1; }
+
+    void take(JSValue& result) {
+        assert(complete());
+        result.Swap(stack.back());
+        stack.pop_back();
+    }
+
+private:
+    template <typename... Args>
+    bool push(Args&&... args) {
+        stack.emplace_back(std::forward<Args>(args)...);
+        return true;
+    }
+
+    bool pop(std::size_t count, JSValue& container) {
+        for (std::size_t i = 0; i < count; ++i) {
+            stack.pop_back();
+        }
+        stack.emplace_back().Swap(container);
+        --depth;
+        return true;
+    }
+
+    // Values are never copied or relocated, which a deque guarantees for the back.
+    std::deque<JSValue> stack;
+    std::size_t depth = 0;
+    rapidjson::CrtAllocator allocator;
+};
+
+} // namespace
+
+// Walks the top-level style object. Every source and every layer is assembled into its
+// own small JSValue and converted right away. All other top-level members are gathered
+// into a header object which is handled like the DOM once the document has been read.
+class Parser::StreamingHandler {
+public:
+    explicit StreamingHandler(Parser& parser_)
+        : parser(parser_) {}
+
+    bool Null() { return beginValue() && builder.Null() && endValue(); }
+    bool Bool(bool value) { return beginValue() && builder.Bool(value) && endValue(); }
+    bool Int(int value) { return beginValue() && builder.Int(value) && endValue(); }
+    bool Uint(unsigned value) { return beginValue() && builder.Uint(value) && endValue(); }
+    bool Int64(int64_t value) { return beginValue() && builder.Int64(value) && endValue(); }
+    bool Uint64(uint64_t value) { return beginValue() && builder.Uint64(value) && endValue(); }
+    bool Double(double value) { return beginValue() && builder.Double(value) && endValue(); }
+    bool RawNumber(const char*, rapidjson::SizeType, bool) { return false; }
+
+    bool String(const char* str, rapidjson::SizeType length, bool copy) {
+        return beginValue() && builder.String(str, length, copy) && endValue();
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool copy) {
+        if (capturing) {
+            return builder.Key(str, length, copy);
+        }
+        key.assign(str, length);
+        return true;
+    }
+
+    bool StartObject() {
+        if (!capturing) {
+            if (level == Level::Document) {
+                level = Level::Style;
+                return true;
+            }
+            if (level == Level::Style && key == "sources") {
+                level = Level::Sources;
+                return true;
+            }
+        }
+        return beginValue() && builder.StartObject();
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount) {
+        if (capturing) {
+            return builder.EndObject(memberCount) && endValue();
+        }
+        level = level == Level::Sources ? Level::Style : Level::Document;
+        return true;
+    }
+
+    bool StartArray() {
+        if (!capturing && level == Level::Style && key == "layers") {
+            level = Level::Layers;
+            return true;
+        }
+        return beginValue() && builder.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType elementCount) {
+        if (capturing) {
+            return builder.EndArray(elementCount) && endValue();
+        }
+        level = Level::Style;
+        return true;
+    }
+
+    bool notAnObject() const { return rootIsNotAnObject; }
+
+    // Processes the header and resolves layers that reference a layer defined after them.
+    void finish() {
+        parser.parseDocument(header);
+
+        for (const auto& id : deferredLayerIDs) {
+            auto it = parser.layersMap.find(id);
+            parser.parseLayer(it->first, *it->second.first, it->second.second);
+        }
+
+        for (const auto& id : layerIDs) {
+            auto it = parser.layersMap.find(id);
+            if (it->second.second) {
+                parser.layers.emplace_back(std::move(it->second.second));
+            }
+        }
+    }
+
+private:
+    bool beginValue() {
+        if (capturing) {
+            return true;
+        }
+        if (level == Level::Document) {
+            rootIsNotAnObject = true;
+            return false;
+        }
+        capturing = true;
+        return true;
+    }
+
+    bool endValue() {
+        if (!builder.complete()) {
+            return true;
+        }
+
+        JSValue value;
+        builder.take(value);
+        capturing = false;
+
+        switch (level) {
+            case Level::Style: {
+                JSValue name(key.c_str(), static_cast<rapidjson::SizeType>(key.size()), allocator);
+                header.AddMember(name, value, allocator);
+                break;
+            }
+            case Level::Sources:
+                parser.parseSource(key, value);
+                break;
+            case Level::Layers:
+                addLayer(value);
+                break;
+            case Level::Document:
+                assert(false);
+                break;
+        }
+        return true;
+    }
+
+    void addLayer(JSValue& value) {
+        auto retained = std::make_unique<JSValue>();
+        retained->Swap(value);
+
+        auto id = parser.registerLayer(*retained);
+        if (!id) {
+            return;
+        }
+        layerIDs.push_back(*id);
+
+        // A layer referencing one that hasn't been read or couldn't be parsed yet
+        // is resolved once the whole document is available, like the DOM parser does.
+        bool deferred = false;
+        if (retained->HasMember("ref") && (*retained)["ref"].IsString()) {
+            const auto& refValue = (*retained)["ref"];
+            const auto ref = parser.layersMap.find({refValue.GetString(), refValue.GetStringLength()});
+            deferred = ref == parser.layersMap.end() || !ref->second.second;
+        }
+
+        auto& entry = parser.layersMap.find(*id)->second;
+        if (deferred) {
+            deferredLayerIDs.push_back(*id);
+        } else {
+            parser.parseLayer(*id, *retained, entry.second);
+        }
+
+        // Failed layers stay around as well, since references to them re-parse them.
+        if (entry.second) {
+            entry.first = nullptr;
+        } else {
+            retainedLayers.push_back(std::move(retained));
+        }
+    }
+
+    enum class Level {
+        Document,
+        Style,
+        Sources,
+        Layers
+    };
+
+    Parser& parser;
+    Level level = Level::Document;
+    std::string key;
+    bool capturing = false;
+    bool rootIsNotAnObject = false;
+    JSValueBuilder builder;
+
+    rapidjson::CrtAllocator allocator;
+    JSValue header{rapidjson::kObjectType};
+
+    std::vector<std::string> layerIDs;
+    std::vector<std::string> deferredLayerIDs;
+    std::vector<std::unique_ptr<JSValue>> retainedLayers;
+};
+
 Parser::~Parser() = default;
 
 StyleParseResult Parser::parse(const std::string& json) {
@@ -40,6 +303,39 @@ StyleParseResult Parser::parse(const std::string& json) {
         return std::make_exception_ptr(std::runtime_error("style must be an object"));
     }
 
+    parseDocument(document);
+
+    // Call for side effect of logging warnings for invalid values.
+    fontStacks();
+
+    return nullptr;
+}
+
+StyleParseResult Parser::parseStreaming(const std::string& json) {
+    StreamingHandler handler(*this);
+    rapidjson::Reader reader;
+    rapidjson::StringStream stream(json.c_str());
+    reader.Parse<0>(stream, handler);
+
+    if (handler.notAnObject()) {
+        return std::make_exception_ptr(std::runtime_error("style must be an object"));
+    }
+
+    if (reader.HasParseError()) {
+        return std::make_exception_ptr(
+            std::runtime_error(std::string{rapidjson::GetParseError_En(reader.GetParseErrorCode())} + " at offset " +
+                               util::toString(reader.GetErrorOffset())));
+    }
+
+    handler.finish();
+
+    // Call for side effect of logging warnings for invalid values.
+    fontStacks();
+
+    return nullptr;
+}
+
+void Parser::parseDocument(const JSValue& document) {
     if (document.HasMember("version")) {
         const JSValue& versionValue = document["version"];
         const int version = versionValue.IsNumber() ? versionValue.GetInt() : 0;
@@ -193,11 +489,6 @@ StyleParseResult Parser::parse(const std::string& json) {
         };
     }
 #endif
-
-    // Call for side effect of logging warnings for invalid values.
-    fontStacks();
-
-    return nullptr;
 }
 
 void Parser::parseTransition(const JSValue& value) {
@@ -229,18 +520,19 @@ void Parser::parseSources(const JSValue& value) {
     }
 
     for (const auto& property : value.GetObject()) {
-        std::string id{property.name.GetString(), property.name.GetStringLength()};
-
-        conversion::Error error;
-        std::optional<std::unique_ptr<Source>> source = conversion::convert<std::unique_ptr<Source>>(
-            property.value, error, id);
-        if (!source) {
-            Log::Warning(Event::ParseStyle, error.message);
-            continue;
-        }
+        parseSource({property.name.GetString(), property.name.GetStringLength()}, property.value);
+    }
+}
 
-        sources.emplace_back(std::move(*source));
+void Parser::parseSource(const std::string& id, const JSValue& value) {
+    conversion::Error error;
+    std::optional<std::unique_ptr<Source>> source = conversion::convert<std::unique_ptr<Source>>(value, error, id);
+    if (!source) {
+        Log::Warning(Event::ParseStyle, error.message);
+        return;
     }
+
+    sources.emplace_back(std::move(*source));
 }
 
 void Parser::parseSprites(const JSValue& value) {
@@ -286,36 +578,15 @@ void Parser::parseLayers(const JSValue& value) {
     }
 
     for (auto& layerValue : value.GetArray()) {
-        if (!layerValue.IsObject()) {
-            Log::Warning(Event::ParseStyle, "layer must be an object");
-            continue;
-        }
-
-        if (!layerValue.HasMember("id")) {
-            Log::Warning(Event::ParseStyle, "layer must have an id");
-            continue;
+        if (auto id = registerLayer(layerValue)) {
+            ids.push_back(std::move(*id));
         }
-
-        const JSValue& id = layerValue.FindMember("id")->value;
-        if (!id.IsString()) {
-            Log::Warning(Event::ParseStyle, "layer id must be a string");
-            continue;
-        }
-
-        const std::string layerID = {id.GetString(), id.GetStringLength()};
-        if (layersMap.find(layerID) != layersMap.end()) {
-            Log::Warning(Event::ParseStyle, "duplicate layer id " + layerID);
-            continue;
-        }
-
-        layersMap.emplace(layerID, std::pair<const JSValue&, std::unique_ptr<Layer>>{layerValue, nullptr});
-        ids.push_back(layerID);
     }
 
     for (const auto& id : ids) {
         auto it = layersMap.find(id);
 
-        parseLayer(it->first, it->second.first, it->second.second);
+        parseLayer(it->first, *it->second.first, it->second.second);
     }
 
     for (const auto& id : ids) {
@@ -327,6 +598,33 @@ void Parser::parseLayers(const JSValue& value) {
     }
 }
 
+std::optional<std::string> Parser::registerLayer(const JSValue& layerValue) {
+    if (!layerValue.IsObject()) {
+        Log::Warning(Event::ParseStyle, "layer must be an object");
+        return std::nullopt;
+    }
+
+    if (!layerValue.HasMember("id")) {
+        Log::Warning(Event::ParseStyle, "layer must have an id");
+        return std::nullopt;
+    }
+
+    const JSValue& id = layerValue.FindMember("id")->value;
+    if (!id.IsString()) {
+        Log::Warning(Event::ParseStyle, "layer id must be a string");
+        return std::nullopt;
+    }
+
+    std::string layerID = {id.GetString(), id.GetStringLength()};
+    if (layersMap.find(layerID) != layersMap.end()) {
+        Log::Warning(Event::ParseStyle, "duplicate layer id " + layerID);
+        return std::nullopt;
+    }
+
+    layersMap.emplace(layerID, std::pair<const JSValue*, std::unique_ptr<Layer>>{&layerValue, nullptr});
+    return layerID;
+}
+
 void Parser::parseLayer(const std::string& id, const JSValue& value, std::unique_ptr<Layer>& layer) {
     if (layer) {
         // Skip parsing this again. We already have a valid layer definition.
@@ -355,9 +653,11 @@ void Parser::parseLayer(const std::string& id, const JSValue& value, std::unique
         }
 
         // Recursively parse the referenced layer.
-        stack.push_front(id);
-        parseLayer(it->first, it->second.first, it->second.second);
-        stack.pop_front();
+        if (!it->second.second) {
+            stack.push_front(id);
+            parseLayer(it->first, *it->second.first, it->second.second);
+            stack.pop_front();
+        }
 
         Layer* reference = it->second.second.get();
         if (!reference) {
@@ -18,6 +18,7 @@
 #include <string>
 #include <unordered_map>
 #include <forward_list>
+#include <optional>
 
 namespace mbgl {
 namespace style {
@@ -30,6 +31,11 @@ public:
 
     StyleParseResult parse(const std::string&);
 
+    // Parses the style with a SAX reader instead of building a DOM for the whole
+    // document first. Sources and layers are converted as soon as their JSON value
+    // has been read, so only one of them is held in memory at any time.
+    StyleParseResult parseStreaming(const std::string&);
+
     std::vector<Sprite> sprites;
     std::string glyphURL;
     std::shared_ptr<FontFaces> fontFaces;
@@ -50,14 +56,21 @@ public:
     std::set<FontStack> fontStacks() const;
 
 private:
+    class StreamingHandler;
+
+    void parseDocument(const JSValue&);
     void parseTransition(const JSValue&);
     void parseLight(const JSValue&);
     void parseSources(const JSValue&);
+    void parseSource(const std::string& id, const JSValue&);
     void parseSprites(const JSValue&);
     void parseLayers(const JSValue&);
+    std::optional<std::string> registerLayer(const JSValue&);
     void parseLayer(const std::string& id, const JSValue&, std::unique_ptr<Layer>&);
 
-    std::unordered_map<std::string, std::pair<const JSValue&, std::unique_ptr<Layer>>> layersMap;
+    // The JSON value points into the document being parsed. The streaming parser
+    // resets it once the layer has been converted and the value was released.
+    std::unordered_map<std::string, std::pair<const JSValue*, std::unique_ptr<Layer>>> layersMap;
 
     // Store a stack of layer IDs we're parsing right now. This is to prevent reference cycles.
     std::forward_list<std::string> stack;
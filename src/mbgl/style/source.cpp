@@ -80,6 +80,18 @@ std::optional<uint8_t> Source::getMaxOverscaleFactorForParentTiles() const noexc
     return baseImpl->getMaxOverscaleFactorForParentTiles();
 }
 
+void Source::setSimplificationTolerance(std::optional<float> pixels) noexcept {
+    if (getSimplificationTolerance() == pixels) return;
+    auto newImpl = createMutable();
+    newImpl->setSimplificationTolerance(pixels);
+    baseImpl = std::move(newImpl);
+    observer->onSourceChanged(*this);
+}
+
+std::optional<float> Source::getSimplificationTolerance() const noexcept {
+    return baseImpl->getSimplificationTolerance();
+}
+
 void Source::dumpDebugLogs() const {
     Log::Info(Event::General, "Source::id: " + getID());
     Log::Info(Event::General, "Source::loaded: " + std::to_string(loaded));
@@ -25,6 +25,8 @@ public:
     Duration getMinimumTileUpdateInterval() const { return minimumTileUpdateInterval; }
     void setMaxOverscaleFactorForParentTiles(std::optional<uint8_t> overscaleFactor) noexcept;
     std::optional<uint8_t> getMaxOverscaleFactorForParentTiles() const noexcept;
+    void setSimplificationTolerance(std::optional<float> pixels) { simplificationTolerance = pixels; }
+    std::optional<float> getSimplificationTolerance() const { return simplificationTolerance; }
 
     bool isVolatile() const { return volatileFlag; }
     void setVolatile(bool set) { volatileFlag = set; }
@@ -34,6 +36,7 @@ public:
 protected:
     std::optional<uint8_t> prefetchZoomDelta;
     std::optional<uint8_t> maxOverscaleFactor;
+    std::optional<float> simplificationTolerance;
     Duration minimumTileUpdateInterval{Duration::zero()};
     bool volatileFlag = false;
 
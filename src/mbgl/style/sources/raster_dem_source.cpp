@@ -33,6 +33,7 @@ void RasterDEMSource::setTilesetOverrides(Tileset& tileset) {
         if (std::optional<Tileset::DEMEncoding> encoding = options.value().encoding) {
             tileset.encoding = encoding.value();
         }
+        tileset.prepareHillshadeOnCPU = options->prepareHillshadeOnCPU;
     }
 }
 
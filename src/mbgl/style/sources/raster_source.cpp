@@ -19,9 +19,22 @@ RasterSource::RasterSource(std::string id,
                            SourceType sourceType)
     : TileSource(id, urlOrTileset_, tileSize, sourceType) {}
 
+RasterSource::RasterSource(std::string id,
+                           variant<std::string, Tileset> urlOrTileset_,
+                           uint16_t tileSize,
+                           RasterOptions options_)
+    : TileSource(id, urlOrTileset_, tileSize, SourceType::Raster),
+      options(options_) {}
+
 bool RasterSource::supportsLayerType(const mbgl::style::LayerTypeInfo* info) const {
     return mbgl::underlying_type(Tile::Kind::Raster) == mbgl::underlying_type(info->tileKind);
 }
 
+void RasterSource::setTilesetOverrides(Tileset& tileset) {
+    if (options) {
+        tileset.textureCompression = options->textureCompression;
+    }
+}
+
 } // namespace style
 } // namespace mbgl
@@ -44,7 +44,9 @@ uint16_t TileSource::getTileSize() const {
 
 void TileSource::loadDescription(FileSource& fileSource) {
     if (urlOrTileset.is<Tileset>()) {
-        baseImpl = makeMutable<Impl>(impl(), urlOrTileset.get<Tileset>());
+        Tileset tileset = urlOrTileset.get<Tileset>();
+        setTilesetOverrides(tileset);
+        baseImpl = makeMutable<Impl>(impl(), std::move(tileset));
         loaded = true;
         observer->onSourceLoaded(*this);
         return;
@@ -1,4 +1,5 @@
 #include <mbgl/style/layers/custom_layer.hpp>
+#include <mbgl/platform/settings.hpp>
 #include <mbgl/sprite/sprite_loader.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/storage/resource.hpp>
@@ -82,7 +83,10 @@ void Style::Impl::loadURL(const std::string& url_) {
 void Style::Impl::parse(const std::string& json_) {
     Parser parser;
 
-    if (auto error = parser.parse(json_)) {
+    const auto streaming = platform::Settings::getInstance().get(platform::EXPERIMENTAL_STREAMING_STYLE_PARSER);
+    const bool* useStreaming = streaming.getBool();
+
+    if (auto error = (useStreaming && *useStreaming) ? parser.parseStreaming(json_) : parser.parse(json_)) {
         std::string message = "Failed to parse style: " + util::toString(error);
         Log::Error(Event::ParseStyle, message.c_str());
         observer->onStyleError(std::make_exception_ptr(util::StyleParseException(message)));
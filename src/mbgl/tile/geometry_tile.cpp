@@ -331,6 +331,20 @@ void GeometryTile::setShowCollisionBoxes(const bool showCollisionBoxes_) {
     }
 }
 
+void GeometryTile::setSimplificationTolerance(std::optional<float> pixels) {
+    MLN_TRACE_FUNC();
+
+    if (simplificationTolerance != pixels) {
+        simplificationTolerance = pixels;
+        if (!pending) {
+            pending = true;
+            observer->onTileAction(id, sourceID, TileOperation::StartParse);
+        }
+        ++correlationID;
+        worker.self().invoke(&GeometryTileWorker::setSimplificationTolerance, simplificationTolerance, correlationID);
+    }
+}
+
 void GeometryTile::onLayout(std::shared_ptr<LayoutResult> result, const uint64_t resultCorrelationID) {
     MLN_TRACE_FUNC();
 
@@ -342,6 +356,10 @@ void GeometryTile::onLayout(std::shared_ptr<LayoutResult> result, const uint64_t
     }
 
     layoutResult = std::move(result);
+    if (layoutResult) {
+        layoutStats.builtBuckets += layoutResult->builtBuckets;
+        layoutStats.reusedBuckets += layoutResult->reusedBuckets;
+    }
     if (!atlasTextures) {
         atlasTextures = std::make_shared<TileAtlasTextures>();
     }
@@ -43,6 +43,7 @@ public:
     std::unique_ptr<TileRenderData> createRenderData() override;
     void setLayers(const std::vector<Immutable<style::LayerProperties>>&) override;
     void setShowCollisionBoxes(bool showCollisionBoxes) override;
+    void setSimplificationTolerance(std::optional<float> pixels) override;
 
     void onGlyphsAvailable(GlyphMap, HBShapeRequests) override;
     void onImagesAvailable(ImageMap, ImageMap, ImageVersionMap versionMap, uint64_t imageCorrelationID) override;
@@ -73,6 +74,10 @@ public:
         gfx::GlyphAtlas glyphAtlas;
         gfx::ImageAtlas imageAtlas;
         gfx::DynamicTextureAtlasPtr dynamicTextureAtlas;
+        // Layout groups whose bucket was carried over from the previous parse
+        std::size_t reusedBuckets = 0;
+        // Layout groups whose bucket was built from the tile features
+        std::size_t builtBuckets = 0;
 
         LayerRenderData* getLayerRenderData(const style::Layer::Impl&);
 
@@ -80,12 +85,16 @@ public:
                      std::unique_ptr<FeatureIndex> featureIndex_,
                      gfx::GlyphAtlas glyphAtlas_,
                      gfx::ImageAtlas imageAtlas_,
-                     gfx::DynamicTextureAtlasPtr dynamicTextureAtlas_)
+                     gfx::DynamicTextureAtlasPtr dynamicTextureAtlas_,
+                     std::size_t reusedBuckets_ = 0,
+                     std::size_t builtBuckets_ = 0)
             : layerRenderData(std::move(renderData_)),
               featureIndex(std::move(featureIndex_)),
               glyphAtlas(std::move(glyphAtlas_)),
               imageAtlas(std::move(imageAtlas_)),
-              dynamicTextureAtlas(dynamicTextureAtlas_) {}
+              dynamicTextureAtlas(dynamicTextureAtlas_),
+              reusedBuckets(reusedBuckets_),
+              builtBuckets(builtBuckets_) {}
 
         ~LayoutResult();
     };
@@ -101,6 +110,16 @@ public:
 
     void setFeatureState(const LayerFeatureStates&) override;
 
+    struct LayoutStats {
+        /// Number of layout groups re-parsed from the tile data
+        std::size_t builtBuckets = 0;
+        /// Number of layout groups whose re-parse was avoided by reusing the previous bucket
+        std::size_t reusedBuckets = 0;
+    };
+
+    /// Cumulative layout statistics over all layout results received by this tile
+    const LayoutStats& getLayoutStats() const { return layoutStats; }
+
 protected:
     const GeometryTileData* getData() const;
     LayerRenderData* getLayerRenderData(const style::Layer::Impl&);
@@ -128,6 +147,9 @@ private:
     const MapMode mode;
 
     bool showCollisionBoxes;
+    std::optional<float> simplificationTolerance;
+
+    LayoutStats layoutStats;
 
     enum class FadeState {
         Loaded,
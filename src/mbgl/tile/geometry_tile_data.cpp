@@ -14,7 +14,9 @@
 #pragma warning(pop)
 #endif
 
+#include <algorithm>
 #include <numbers>
+#include <utility>
 
 using namespace std::numbers;
 
@@ -124,6 +126,92 @@ void limitHoles(GeometryCollection& polygon, uint32_t maxHoles) {
     }
 }
 
+GeometryCoordinates simplifyLine(const GeometryCoordinates& line, double tolerance) {
+    if (line.size() < 3 || tolerance <= 0) {
+        return line;
+    }
+
+    // Squared distance from p to the segment a-b
+    const auto distanceSq = [](const GeometryCoordinate& p, const GeometryCoordinate& a, const GeometryCoordinate& b) {
+        double x = a.x;
+        double y = a.y;
+        const double dx = b.x - x;
+        const double dy = b.y - y;
+        if (dx != 0 || dy != 0) {
+            const double t = ((p.x - x) * dx + (p.y - y) * dy) / (dx * dx + dy * dy);
+            if (t > 1) {
+                x = b.x;
+                y = b.y;
+            } else if (t > 0) {
+                x += dx * t;
+                y += dy * t;
+            }
+        }
+        return (p.x - x) * (p.x - x) + (p.y - y) * (p.y - y);
+    };
+
+    const double toleranceSq = tolerance * tolerance;
+    std::vector<bool> keep(line.size(), false);
+    keep.front() = keep.back() = true;
+
+    std::vector<std::pair<std::size_t, std::size_t>> stack{{0, line.size() - 1}};
+    while (!stack.empty()) {
+        const auto [first, last] = stack.back();
+        stack.pop_back();
+
+        double maxDistanceSq = toleranceSq;
+        std::size_t index = first;
+        for (std::size_t i = first + 1; i < last; ++i) {
+            const double d = distanceSq(line[i], line[first], line[last]);
+            if (d > maxDistanceSq) {
+                maxDistanceSq = d;
+                index = i;
+            }
+        }
+
+        if (index != first) {
+            keep[index] = true;
+            if (index - first > 1) stack.emplace_back(first, index);
+            if (last - index > 1) stack.emplace_back(index, last);
+        }
+    }
+
+    GeometryCoordinates simplified;
+    simplified.reserve(std::count(keep.begin(), keep.end(), true));
+    for (std::size_t i = 0; i < line.size(); ++i) {
+        if (keep[i]) {
+            simplified.push_back(line[i]);
+        }
+    }
+    return simplified;
+}
+
+GeometryCollection simplifyGeometry(const GeometryCollection& geometry, FeatureType type, double tolerance) {
+    MLN_TRACE_FUNC();
+
+    if (type == FeatureType::Point || tolerance <= 0) {
+        return geometry.clone();
+    }
+
+    GeometryCollection simplified;
+    simplified.reserve(geometry.size());
+    for (const auto& line : geometry) {
+        auto result = simplifyLine(line, tolerance);
+        if (type == FeatureType::Polygon) {
+            // Rings are classified into outer rings and holes by their winding, which
+            // the simplified ring has to keep.
+            const bool closed = line.size() > 1 && line.front() == line.back();
+            const std::size_t minPoints = closed ? 4 : 3;
+            const double area = result.size() < minPoints ? 0 : signedArea(result);
+            if (area == 0 || (area < 0) != (signedArea(line) < 0)) {
+                result = line;
+            }
+        }
+        simplified.push_back(std::move(result));
+    }
+    return simplified;
+}
+
 Feature::geometry_type convertGeometry(const GeometryTileFeature& geometryTileFeature, const CanonicalTileID& tileID) {
     MLN_TRACE_FUNC();
 
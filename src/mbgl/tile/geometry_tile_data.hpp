@@ -86,6 +86,14 @@ std::vector<GeometryCollection> classifyRings(const GeometryCollection&);
 // Truncate polygon to the largest `maxHoles` inner rings by area.
 void limitHoles(GeometryCollection&, uint32_t maxHoles);
 
+// Simplify a line with the Douglas-Peucker algorithm, dropping the points that
+// are within `tolerance` of the simplified line. The end points are always kept.
+GeometryCoordinates simplifyLine(const GeometryCoordinates&, double tolerance);
+
+// Simplify the lines or polygon rings of a feature. Rings that would collapse
+// are kept as they are, and points are never simplified.
+GeometryCollection simplifyGeometry(const GeometryCollection&, FeatureType, double tolerance);
+
 Feature::geometry_type convertGeometry(const GeometryTileFeature& geometryTileFeature, const CanonicalTileID& tileID);
 
 GeometryCollection convertGeometry(const Feature::geometry_type& geometryTileFeature, const CanonicalTileID& tileID);
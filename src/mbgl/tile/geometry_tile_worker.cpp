@@ -55,7 +55,8 @@ GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
 GeometryTileWorker::~GeometryTileWorker() {
     MLN_TRACE_FUNC();
 
-    scheduler.runOnRenderThread([renderData_{std::move(renderData)}]() {});
+    scheduler.runOnRenderThread(
+        [renderData_{std::move(renderData)}, reusableBuckets_{std::move(reusableBuckets)}]() {});
 }
 
 /*
@@ -139,6 +140,9 @@ void GeometryTileWorker::setData(std::unique_ptr<const GeometryTileData> data_,
         correlationID = correlationID_;
         availableImages = std::move(availableImages_);
 
+        // Retained buckets and feature indices refer to the previous data.
+        releaseReusableBuckets();
+
         switch (state) {
             case Idle:
                 parse();
@@ -189,6 +193,7 @@ void GeometryTileWorker::reset(uint64_t correlationID_) {
     layers = std::nullopt;
     data = std::nullopt;
     correlationID = correlationID_;
+    releaseReusableBuckets();
 
     switch (state) {
         case Idle:
@@ -231,6 +236,34 @@ void GeometryTileWorker::setShowCollisionBoxes(bool showCollisionBoxes_, uint64_
     }
 }
 
+void GeometryTileWorker::setSimplificationTolerance(std::optional<float> pixels, uint64_t correlationID_) {
+    MLN_TRACE_FUNC();
+
+    try {
+        simplificationTolerance = pixels;
+        correlationID = correlationID_;
+        // Buckets laid out with the previous tolerance can't be handed out again
+        releaseReusableBuckets();
+
+        switch (state) {
+            case Idle:
+                parse();
+                coalesce();
+                break;
+
+            case Coalescing:
+            case NeedsSymbolLayout:
+                state = NeedsParse;
+                break;
+
+            case NeedsParse:
+                break;
+        }
+    } catch (...) {
+        parent.invoke(&GeometryTile::onError, std::current_exception(), correlationID);
+    }
+}
+
 void GeometryTileWorker::symbolDependenciesChanged() {
     MLN_TRACE_FUNC();
 
@@ -406,6 +439,36 @@ void GeometryTileWorker::requestNewImages(const ImageDependencies& imageDependen
     }
 }
 
+void GeometryTileWorker::releaseReusableBuckets() {
+    if (!reusableBuckets.empty()) {
+        // Buckets are destroyed on the render thread, see the destructor.
+        scheduler.runOnRenderThread([released{std::move(reusableBuckets)}]() {});
+        reusableBuckets = {};
+    }
+}
+
+bool GeometryTileWorker::canReuse(const ReusableBucket& previous,
+                                  const std::vector<Immutable<style::LayerProperties>>& group) const {
+    if (previous.layers.size() != group.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < group.size(); ++i) {
+        const auto& before = previous.layers[i];
+        const auto& after = group[i];
+        if (before->baseImpl == after->baseImpl) {
+            continue;
+        }
+        // The layout key already covers the filter and the layout properties, so this
+        // only differs when data-driven paint properties (and hence the binders) change.
+        if (before->baseImpl->id != after->baseImpl->id ||
+            before->baseImpl->hasLayoutDifference(*after->baseImpl) ||
+            before->constantsMask() != after->constantsMask()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void GeometryTileWorker::parse() {
     MLN_TRACE_FUNC();
 
@@ -419,6 +482,16 @@ void GeometryTileWorker::parse() {
 
     renderData.clear();
     layouts.clear();
+    reusedBucketCount = 0;
+    builtBucketCount = 0;
+
+    ReusableBuckets nextReusableBuckets;
+
+    // The tolerance is given in screen pixels at the tile's own zoom level. Overzoomed
+    // tiles are drawn larger, so they get a smaller tolerance in tile units.
+    const double tolerance = simplificationTolerance
+                                 ? *simplificationTolerance * util::EXTENT / (util::tileSize_D * id.overscaleFactor())
+                                 : 0.0;
 
     featureIndex = std::make_unique<FeatureIndex>(*data ? (*data)->clone() : nullptr);
 
@@ -439,6 +512,7 @@ void GeometryTileWorker::parse() {
     }
 
     for (auto& pair : groupMap) {
+        const auto& key = pair.first;
         const auto& group = pair.second;
         if (obsolete) {
             return;
@@ -449,7 +523,15 @@ void GeometryTileWorker::parse() {
         }
 
         const style::Layer::Impl& leaderImpl = *(group.at(0)->baseImpl);
-        BucketParameters parameters{id, mode, pixelRatio, leaderImpl.getTypeInfo()};
+        // Start from the size of the previous layout to avoid growing the buffers one feature at a time
+        const auto sizeHint = bucketSizeHints.find(leaderImpl.id);
+        BucketParameters parameters{id,
+                                    mode,
+                                    pixelRatio,
+                                    leaderImpl.getTypeInfo(),
+                                    tolerance,
+                                    scheduler,
+                                    sizeHint != bucketSizeHints.end() ? sizeHint->second : BucketSizeHint{}};
 
         auto geometryLayer = (*data)->getLayer(leaderImpl.sourceLayer);
         if (!geometryLayer) {
@@ -464,6 +546,25 @@ void GeometryTileWorker::parse() {
 
         featureIndex->setBucketLayerIDs(leaderImpl.id, layerIDs);
 
+        // Hand out the previous bucket if only other layout groups changed, re-populating
+        // the feature index from the recorded features instead of re-running the filter.
+        const auto previous = reusableBuckets.find(key);
+        if (previous != reusableBuckets.end() && canReuse(previous->second, group)) {
+            const std::string& sourceLayerID = leaderImpl.sourceLayer;
+            for (const auto index : previous->second.featureIndices) {
+                const auto feature = geometryLayer->getFeature(index);
+                featureIndex->insert(feature->getGeometries(), index, sourceLayerID, leaderImpl.id);
+            }
+            for (const auto& layer : group) {
+                renderData.emplace(layer->baseImpl->id, LayerRenderData{previous->second.bucket, layer});
+            }
+            nextReusableBuckets.emplace(
+                key, ReusableBucket{group, previous->second.bucket, previous->second.featureIndices});
+            ++reusedBucketCount;
+            continue;
+        }
+        ++builtBucketCount;
+
         // Symbol layers and layers that support pattern properties have an
         // extra step at layout time to figure out what images/glyphs are needed
         // to render the layer. They use the intermediate Layout data structure
@@ -477,13 +578,14 @@ void GeometryTileWorker::parse() {
                 group);
             if (layout->hasDependencies()) {
                 layouts.push_back(std::move(layout));
-            } else {
-                layout->createBucket({}, featureIndex, renderData, firstLoad, showCollisionBoxes, id.canonical);
+                continue;
             }
+            layout->createBucket({}, featureIndex, renderData, firstLoad, showCollisionBoxes, id.canonical);
         } else {
             const Filter& filter = leaderImpl.filter;
             const std::string& sourceLayerID = leaderImpl.sourceLayer;
             std::shared_ptr<Bucket> bucket = LayerManager::get()->createBucket(parameters, group);
+            bucket->reserve(parameters.sizeHint);
 
             for (std::size_t i = 0; !obsolete && i < geometryLayer->featureCount(); i++) {
                 std::unique_ptr<GeometryTileFeature> feature = geometryLayer->getFeature(i);
@@ -505,8 +607,22 @@ void GeometryTileWorker::parse() {
                 renderData.emplace(layer->baseImpl->id, LayerRenderData{bucket, layer});
             }
         }
+
+        // Symbol buckets take part in placement and are always rebuilt.
+        if (leaderImpl.getTypeInfo()->crossTileIndex == LayerTypeInfo::CrossTileIndex::NotRequired) {
+            const auto it = renderData.find(leaderImpl.id);
+            if (it != renderData.end() && it->second.bucket) {
+                nextReusableBuckets.emplace(
+                    key,
+                    ReusableBucket{group, it->second.bucket, featureIndex->getBucketFeatureIndices(leaderImpl.id)});
+            }
+        }
     }
 
+    releaseReusableBuckets();
+    reusableBuckets = std::move(nextReusableBuckets);
+    MLN_ZONE_VALUE(reusedBucketCount);
+
     requestNewGlyphs(glyphDependencies);
     requestNewImages(imageDependencies);
 
@@ -570,6 +686,17 @@ void GeometryTileWorker::finalizeLayout() {
 
     layouts.clear();
 
+    // Remember the sizes of all the buckets, including the ones created by layouts, for the next parse
+    bucketSizeHints.clear();
+    for (const auto& [layerID, layerData] : renderData) {
+        if (layerData.bucket) {
+            const auto hint = layerData.bucket->getSizeHint();
+            if (hint.vertices || hint.indexes) {
+                bucketSizeHints.emplace(layerID, hint);
+            }
+        }
+    }
+
     firstLoad = false;
 
     MBGL_TIMING_FINISH(watch,
@@ -583,7 +710,9 @@ void GeometryTileWorker::finalizeLayout() {
                                                                std::move(featureIndex),
                                                                std::move(glyphAtlas),
                                                                std::move(imageAtlas),
-                                                               dynamicTextureAtlas),
+                                                               dynamicTextureAtlas,
+                                                               reusedBucketCount,
+                                                               builtBucketCount),
                   correlationID);
 }
 
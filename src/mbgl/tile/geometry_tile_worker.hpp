@@ -55,6 +55,7 @@ public:
                  uint64_t correlationID);
     void reset(uint64_t correlationID_);
     void setShowCollisionBoxes(bool showCollisionBoxes_, uint64_t correlationID_);
+    void setSimplificationTolerance(std::optional<float> pixels, uint64_t correlationID_);
 
     void onGlyphsAvailable(GlyphMap glyphs, HBShapeResults requests);
 
@@ -79,6 +80,19 @@ private:
 
     void checkPatternLayout(std::unique_ptr<Layout> layout);
 
+    // A bucket that doesn't depend on glyphs or images, retained from the
+    // previous parse so that it can be handed out again when a layer update
+    // leaves its layout group unchanged.
+    struct ReusableBucket {
+        std::vector<Immutable<style::LayerProperties>> layers;
+        std::shared_ptr<Bucket> bucket;
+        std::vector<std::size_t> featureIndices;
+    };
+    using ReusableBuckets = mbgl::unordered_map<std::string, ReusableBucket>;
+
+    bool canReuse(const ReusableBucket&, const std::vector<Immutable<style::LayerProperties>>& group) const;
+    void releaseReusableBuckets();
+
     ActorRef<GeometryTileWorker> self;
     ActorRef<GeometryTile> parent;
     TaggedScheduler scheduler;
@@ -109,6 +123,14 @@ private:
 
     std::vector<std::unique_ptr<Layout>> layouts;
 
+    // Keyed by `layoutKey` of the group leader
+    ReusableBuckets reusableBuckets;
+    std::size_t reusedBucketCount = 0;
+    std::size_t builtBucketCount = 0;
+
+    // Geometry sizes of the buckets of the previous layout, keyed by layer ID
+    mbgl::unordered_map<std::string, Bucket::SizeHint> bucketSizeHints;
+
     GlyphDependencies pendingGlyphDependencies;
     ImageDependencies pendingImageDependencies;
     GlyphMap glyphMap;
@@ -120,6 +142,9 @@ private:
     bool showCollisionBoxes;
     bool firstLoad = true;
 
+    // Screen pixels within which line and polygon geometry may be simplified before layout
+    std::optional<float> simplificationTolerance;
+
     gfx::DynamicTextureAtlasPtr dynamicTextureAtlas;
 
     std::shared_ptr<FontFaces> fontFaces;
@@ -25,6 +25,9 @@ RasterDEMTile::RasterDEMTile(const OverscaledTileID& id_,
       mailbox(std::make_shared<Mailbox>(*Scheduler::GetCurrent())),
       worker(parameters.threadPool, ActorRef<RasterDEMTile>(*this, mailbox)) {
     encoding = tileset.encoding;
+    if (tileset.prepareHillshadeOnCPU) {
+        prepareHillshade = HillshadePrepareZoom{id.canonical.z, tileset.zoomRange.max};
+    }
     if (id.canonical.y == 0) {
         // this tile doesn't have upper neighboring tiles so marked those as backfilled
         neighboringTiles = neighboringTiles | DEMTileNeighbors::NoUpper;
@@ -73,7 +76,7 @@ void RasterDEMTile::setData(const std::shared_ptr<const std::string>& data) {
         }
 
         pending = true;
-        worker.self().invoke(&RasterDEMTileWorker::parse, data, correlationID, encoding);
+        worker.self().invoke(&RasterDEMTileWorker::parse, data, correlationID, encoding, prepareHillshade);
     }
 }
 
@@ -128,6 +131,7 @@ void RasterDEMTile::backfillBorder(const RasterDEMTile& borderTile, const DEMTil
         DEMData& tileDEM = bucket->getDEMData();
 
         tileDEM.backfillBorder(borderDEM, dx, dy);
+        bucket->updatePreparedBorder();
         // update the bitmask to indicate that this tiles have been backfilled by flipping the relevant bit
         this->neighboringTiles = this->neighboringTiles | mask;
         // mark HillshadeBucket.prepared as false so it runs through the prepare
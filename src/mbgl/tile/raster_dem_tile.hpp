@@ -100,6 +100,8 @@ private:
 
     uint64_t correlationID = 0;
     Tileset::DEMEncoding encoding;
+    // Set when the hillshade slopes are computed on the worker
+    std::optional<HillshadePrepareZoom> prepareHillshade;
 
     // Contains the Bucket object for the tile. Buckets are render
     // objects and they get added by tile parsing operations.
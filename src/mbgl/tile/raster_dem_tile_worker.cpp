@@ -11,7 +11,8 @@ RasterDEMTileWorker::RasterDEMTileWorker(const ActorRef<RasterDEMTileWorker>&, A
 
 void RasterDEMTileWorker::parse(const std::shared_ptr<const std::string>& data,
                                 uint64_t correlationID,
-                                Tileset::DEMEncoding encoding) {
+                                Tileset::DEMEncoding encoding,
+                                std::optional<HillshadePrepareZoom> prepareHillshade) {
     if (!data) {
         parent.invoke(&RasterDEMTile::onParsed, nullptr,
                       correlationID); // No data; empty tile.
@@ -20,6 +21,9 @@ void RasterDEMTileWorker::parse(const std::shared_ptr<const std::string>& data,
 
     try {
         auto bucket = std::make_unique<HillshadeBucket>(decodeImage(*data), encoding);
+        if (prepareHillshade) {
+            bucket->prepareOnCPU(*prepareHillshade);
+        }
         parent.invoke(&RasterDEMTile::onParsed, std::move(bucket), correlationID);
     } catch (...) {
         parent.invoke(&RasterDEMTile::onError, std::current_exception(), correlationID);
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <mbgl/actor/actor_ref.hpp>
+#include <mbgl/geometry/hillshade_prepare.hpp>
 #include <mbgl/util/tileset.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace mbgl {
@@ -14,7 +16,10 @@ class RasterDEMTileWorker {
 public:
     RasterDEMTileWorker(const ActorRef<RasterDEMTileWorker>&, ActorRef<RasterDEMTile>);
 
-    void parse(const std::shared_ptr<const std::string>& data, uint64_t correlationID, Tileset::DEMEncoding encoding);
+    void parse(const std::shared_ptr<const std::string>& data,
+               uint64_t correlationID,
+               Tileset::DEMEncoding encoding,
+               std::optional<HillshadePrepareZoom> prepareHillshade);
 
 private:
     ActorRef<RasterDEMTile> parent;
@@ -10,10 +10,56 @@
 #include <mbgl/tile/raster_tile_worker.hpp>
 #include <mbgl/tile/tile_loader_impl.hpp>
 #include <mbgl/tile/tile_observer.hpp>
+
+#include <algorithm>
+#include <atomic>
 #include <utility>
 
 namespace mbgl {
 
+namespace {
+
+std::atomic_size_t firstPixelTiles{0};
+std::atomic_size_t firstPixelPreviews{0};
+std::atomic<Duration::rep> totalTimeToFirstPixel{0};
+std::atomic<Duration::rep> maxTimeToFirstPixel{0};
+
+std::optional<gfx::TexturePixelType> selectTextureCompression(Tileset::TextureCompression requested,
+                                                              const TextureCompressionSupport& supported) {
+    switch (requested) {
+        case Tileset::TextureCompression::None:
+            break;
+        case Tileset::TextureCompression::Automatic:
+            if (supported.etc2) {
+                return gfx::TexturePixelType::ETC2;
+            }
+            if (supported.bc1) {
+                return gfx::TexturePixelType::BC1;
+            }
+            break;
+        case Tileset::TextureCompression::ETC2:
+            if (supported.etc2) {
+                return gfx::TexturePixelType::ETC2;
+            }
+            break;
+        case Tileset::TextureCompression::BC1:
+            if (supported.bc1) {
+                return gfx::TexturePixelType::BC1;
+            }
+            break;
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+RasterTileStats getRasterTileStats() {
+    return {firstPixelTiles,
+            firstPixelPreviews,
+            Duration(totalTimeToFirstPixel.load()),
+            Duration(maxTimeToFirstPixel.load())};
+}
+
 RasterTile::RasterTile(const OverscaledTileID& id_,
                        std::string sourceID_,
                        const TileParameters& parameters,
@@ -23,7 +69,10 @@ RasterTile::RasterTile(const OverscaledTileID& id_,
       loader(*this, id_, parameters, tileset),
       threadPool(parameters.threadPool),
       mailbox(std::make_shared<Mailbox>(*Scheduler::GetCurrent())),
-      worker(parameters.threadPool, ActorRef<RasterTile>(*this, mailbox)) {}
+      worker(parameters.threadPool, ActorRef<RasterTile>(*this, mailbox)),
+      progressive(parameters.mode == MapMode::Continuous),
+      compression(selectTextureCompression(tileset.textureCompression, parameters.textureCompressionSupport)),
+      textureCompressionSupport(parameters.textureCompressionSupport) {}
 
 RasterTile::~RasterTile() {
     markObsolete();
@@ -62,23 +111,71 @@ void RasterTile::setData(const std::shared_ptr<const std::string>& data) {
         }
 
         pending = true;
-        worker.self().invoke(&RasterTileWorker::parse, data, correlationID);
+        if (!bucket) {
+            dataReceived = Clock::now();
+        }
+        worker.self().invoke(
+            &RasterTileWorker::parse, data, correlationID, progressive, compression, textureCompressionSupport);
     }
 }
 
+void RasterTile::onPreview(std::shared_ptr<PremultipliedImage> preview, const uint64_t resultCorrelationID) {
+    // Previews are only worth showing in place of nothing
+    if (obsolete || bucket || resultCorrelationID != correlationID) {
+        return;
+    }
+    bucket = std::make_shared<RasterBucket>(std::move(preview));
+    showingPreview = true;
+    loaded = true;
+    renderable = bucket->hasData();
+    if (renderable) {
+        recordFirstPixel(true);
+    }
+    observer->onTileChanged(*this);
+}
+
 void RasterTile::onParsed(std::unique_ptr<RasterBucket> result, const uint64_t resultCorrelationID) {
     if (!obsolete) {
+        if (showingPreview && result) {
+            // Replace the preview with a new bucket, so that its ID changes and the drawables of the tile are rebuilt
+            // with the full resolution texture, keeping the mask of the preview
+            result->setMask(TileMask{bucket->mask});
+            // The preview texture needs to be released on the render thread
+            threadPool.runOnRenderThread([preview{std::move(bucket)}]() {});
+        }
         bucket = std::move(result);
+        showingPreview = false;
         loaded = true;
         if (resultCorrelationID == correlationID) {
             pending = false;
             observer->onTileAction(id, sourceID, TileOperation::EndParse);
         }
         renderable = static_cast<bool>(bucket);
+        if (renderable) {
+            recordFirstPixel(false);
+        }
         observer->onTileChanged(*this);
     }
 }
 
+void RasterTile::recordFirstPixel(bool preview) {
+    if (!dataReceived) {
+        return;
+    }
+    const auto elapsed = Clock::now() - *dataReceived;
+    dataReceived.reset();
+    timeToFirstPixel = elapsed;
+
+    firstPixelTiles++;
+    if (preview) {
+        firstPixelPreviews++;
+    }
+    totalTimeToFirstPixel += elapsed.count();
+    auto longest = maxTimeToFirstPixel.load();
+    while (longest < elapsed.count() && !maxTimeToFirstPixel.compare_exchange_weak(longest, elapsed.count())) {
+    }
+}
+
 void RasterTile::onError(std::exception_ptr err, const uint64_t resultCorrelationID) {
     loaded = true;
     if (resultCorrelationID == correlationID) {
@@ -4,6 +4,10 @@
 #include <mbgl/tile/tile_loader.hpp>
 #include <mbgl/tile/raster_tile_worker.hpp>
 #include <mbgl/actor/actor.hpp>
+#include <mbgl/util/chrono.hpp>
+#include <mbgl/util/image.hpp>
+
+#include <optional>
 
 namespace mbgl {
 
@@ -11,6 +15,20 @@ class Tileset;
 class TileParameters;
 class RasterBucket;
 
+struct RasterTileStats {
+    /// Number of raster tiles that became renderable
+    std::size_t tiles = 0;
+    /// Number of those that were first rendered from a reduced resolution preview
+    std::size_t previews = 0;
+    /// Sum of the times from receiving the data of a tile until it could first be rendered
+    Duration totalTimeToFirstPixel = Duration::zero();
+    /// Longest of those times
+    Duration maxTimeToFirstPixel = Duration::zero();
+};
+
+/// Aggregated time-to-first-pixel of all the raster tiles
+RasterTileStats getRasterTileStats();
+
 namespace style {
 class Layer;
 } // namespace style
@@ -33,13 +51,18 @@ public:
 
     void setMask(TileMask&&) override;
 
+    void onPreview(std::shared_ptr<PremultipliedImage> preview, uint64_t correlationID);
     void onParsed(std::unique_ptr<RasterBucket> result, uint64_t correlationID);
     void onError(std::exception_ptr, uint64_t correlationID);
 
     void cancel() override;
 
+    /// Time from receiving the data of the tile until it could first be rendered, once it could
+    std::optional<Duration> getTimeToFirstPixel() const { return timeToFirstPixel; }
+
 private:
     void markObsolete();
+    void recordFirstPixel(bool preview);
 
     TileLoader<RasterTile> loader;
 
@@ -49,6 +72,16 @@ private:
 
     uint64_t correlationID = 0;
 
+    // Decode a preview before the full image, for continuously rendered maps
+    const bool progressive;
+    // Block compressed format to keep decoded images in, if any
+    const std::optional<gfx::TexturePixelType> compression;
+    const TextureCompressionSupport textureCompressionSupport;
+    // Set while the bucket holds the preview of the data being parsed
+    bool showingPreview = false;
+    std::optional<TimePoint> dataReceived;
+    std::optional<Duration> timeToFirstPixel;
+
     // Contains the Bucket object for the tile. Buckets are render
     // objects and they get added by tile parsing operations.
     std::shared_ptr<RasterBucket> bucket;
@@ -2,14 +2,28 @@
 #include <mbgl/tile/raster_tile.hpp>
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/actor/actor.hpp>
+#include <mbgl/util/image_pool.hpp>
 #include <mbgl/util/premultiply.hpp>
 
+#include <stdexcept>
+
 namespace mbgl {
 
 RasterTileWorker::RasterTileWorker(const ActorRef<RasterTileWorker>&, ActorRef<RasterTile> parent_)
     : parent(std::move(parent_)) {}
 
-void RasterTileWorker::parse(const std::shared_ptr<const std::string>& data, uint64_t correlationID) {
+namespace {
+
+// A quarter of the size along each side, e.g. 128px for 512px tiles
+constexpr uint32_t previewScale = 4;
+
+} // namespace
+
+void RasterTileWorker::parse(const std::shared_ptr<const std::string>& data,
+                             uint64_t correlationID,
+                             bool progressive,
+                             std::optional<gfx::TexturePixelType> compression,
+                             TextureCompressionSupport supported) {
     if (!data) {
         parent.invoke(&RasterTile::onParsed, nullptr,
                       correlationID); // No data; empty tile.
@@ -17,7 +31,40 @@ void RasterTileWorker::parse(const std::shared_ptr<const std::string>& data, uin
     }
 
     try {
-        auto bucket = std::make_unique<RasterBucket>(decodeImage(*data));
+        if (isKTX2(*data)) {
+            auto compressed = decodeKTX2(*data);
+            if (!supported.supports(compressed.format)) {
+                throw std::runtime_error("texture format of KTX2 tile is not supported by the renderer");
+            }
+            auto bucket = std::make_unique<RasterBucket>(std::make_shared<CompressedImage>(std::move(compressed)));
+            parent.invoke(&RasterTile::onParsed, std::move(bucket), correlationID);
+            return;
+        }
+
+        auto& pool = ImagePool::get();
+        const auto allocate = [&pool](Size size) {
+            return pool.acquire(size);
+        };
+
+        if (progressive) {
+            auto preview = decodeImagePreview(*data, previewScale, allocate);
+            if (preview.valid()) {
+                parent.invoke(&RasterTile::onPreview, pool.share(std::move(preview)), correlationID);
+            }
+        }
+
+        auto image = decodeImage(*data, allocate);
+        if (compression) {
+            auto compressed = compressImage(image, *compression);
+            if (compressed.valid()) {
+                pool.release(std::move(image));
+                auto bucket = std::make_unique<RasterBucket>(std::make_shared<CompressedImage>(std::move(compressed)));
+                parent.invoke(&RasterTile::onParsed, std::move(bucket), correlationID);
+                return;
+            }
+        }
+
+        auto bucket = std::make_unique<RasterBucket>(pool.share(std::move(image)));
         parent.invoke(&RasterTile::onParsed, std::move(bucket), correlationID);
     } catch (...) {
         parent.invoke(&RasterTile::onError, std::current_exception(), correlationID);
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <mbgl/actor/actor_ref.hpp>
+#include <mbgl/util/compressed_image.hpp>
 
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace mbgl {
@@ -13,7 +15,15 @@ class RasterTileWorker {
 public:
     RasterTileWorker(const ActorRef<RasterTileWorker>&, ActorRef<RasterTile>);
 
-    void parse(const std::shared_ptr<const std::string>& data, uint64_t correlationID);
+    /// Decode a tile. When `progressive` is set, a reduced resolution preview is sent
+    /// first if the image format allows decoding one quickly. Opaque images are then
+    /// compressed to `compression`, if set. KTX2 tiles are kept as they are, and fail
+    /// if their format isn't in `supported`.
+    void parse(const std::shared_ptr<const std::string>& data,
+               uint64_t correlationID,
+               bool progressive,
+               std::optional<gfx::TexturePixelType> compression,
+               TextureCompressionSupport supported);
 
 private:
     ActorRef<RasterTile> parent;
@@ -199,17 +199,21 @@ IntersectionResult Frustum::intersects(const AABB& aabb) const {
     // Each frustum plane together with 3 major axes define the separating axes
     // This implementation is conservative as it's not checking all possible axes.
     // False positive rate is ~0.5% of all cases (see intersectsPrecise).
-    // Note: test only 4 points as both min and max points have zero elevation
-    assert(aabb.min[2] == 0.0 && aabb.max[2] == 0.0);
-
     if (!bounds.intersects(aabb)) return IntersectionResult::Separate;
 
-    const std::array<vec4, 4> aabbPoints = {{
-        vec4{{aabb.min[0], aabb.min[1], 0.0, 1.0}},
-        vec4{{aabb.max[0], aabb.min[1], 0.0, 1.0}},
-        vec4{{aabb.max[0], aabb.max[1], 0.0, 1.0}},
-        vec4{{aabb.min[0], aabb.max[1], 0.0, 1.0}},
+    // Test only 4 points when both min and max points have the same elevation
+    const bool flat = aabb.min[2] == aabb.max[2];
+    const std::array<vec4, 8> aabbPoints = {{
+        vec4{{aabb.min[0], aabb.min[1], aabb.min[2], 1.0}},
+        vec4{{aabb.max[0], aabb.min[1], aabb.min[2], 1.0}},
+        vec4{{aabb.max[0], aabb.max[1], aabb.min[2], 1.0}},
+        vec4{{aabb.min[0], aabb.max[1], aabb.min[2], 1.0}},
+        vec4{{aabb.min[0], aabb.min[1], aabb.max[2], 1.0}},
+        vec4{{aabb.max[0], aabb.min[1], aabb.max[2], 1.0}},
+        vec4{{aabb.max[0], aabb.max[1], aabb.max[2], 1.0}},
+        vec4{{aabb.min[0], aabb.max[1], aabb.max[2], 1.0}},
     }};
+    const size_t pointCount = flat ? 4 : aabbPoints.size();
 
     bool fullyInside = true;
 
@@ -218,17 +222,16 @@ IntersectionResult Frustum::intersects(const AABB& aabb) const {
     for (const vec4& plane : planes) {
         size_t pointsInside = 0;
 
-        pointsInside += vec4Dot(plane, aabbPoints[0]) >= -epsilon;
-        pointsInside += vec4Dot(plane, aabbPoints[1]) >= -epsilon;
-        pointsInside += vec4Dot(plane, aabbPoints[2]) >= -epsilon;
-        pointsInside += vec4Dot(plane, aabbPoints[3]) >= -epsilon;
+        for (size_t i = 0; i < pointCount; i++) {
+            pointsInside += vec4Dot(plane, aabbPoints[i]) >= -epsilon;
+        }
 
         if (!pointsInside) {
             // Separating axis found, no intersection
             return IntersectionResult::Separate;
         }
 
-        if (pointsInside != aabbPoints.size()) fullyInside = false;
+        if (pointsInside != pointCount) fullyInside = false;
     }
 
     return fullyInside ? IntersectionResult::Contains : IntersectionResult::Intersects;
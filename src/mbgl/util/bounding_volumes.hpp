@@ -43,10 +43,12 @@ public:
 
     // Performs conservative intersection test using separating axis theorem.
     // Some accuracy is traded for better performance. False positive rate is < 1%
+    // Boxes with a height are tested with all 8 corners, flat ones with the 4 at their elevation
     IntersectionResult intersects(const AABB& aabb) const;
 
     // Performs precise intersection test using separating axis theorem.
     // It is possible run only edge cases that were not covered in intersects()
+    // Only the ground footprint of the box is tested
     IntersectionResult intersectsPrecise(const AABB& aabb, bool edgeCasesOnly = false) const;
 
     const std::array<vec3, 8>& getPoints() const { return points; }
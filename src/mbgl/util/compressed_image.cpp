@@ -0,0 +1,466 @@
+#include <mbgl/util/compressed_image.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace mbgl {
+
+namespace {
+
+constexpr uint32_t blockDim = 4;
+constexpr uint32_t blockPixels = blockDim * blockDim;
+
+struct Color {
+    int r;
+    int g;
+    int b;
+};
+
+int distance(const Color& a, const Color& b) {
+    const int dr = a.r - b.r;
+    const int dg = a.g - b.g;
+    const int db = a.b - b.b;
+    return dr * dr + dg * dg + db * db;
+}
+
+int clampChannel(int value) {
+    return std::clamp(value, 0, 255);
+}
+
+// Loads a block in row order, repeating the last row and column for blocks that overhang the image
+void loadBlock(const PremultipliedImage& image, uint32_t x0, uint32_t y0, std::array<Color, blockPixels>& block) {
+    for (uint32_t y = 0; y < blockDim; y++) {
+        const uint32_t sy = std::min(y0 + y, image.size.height - 1);
+        for (uint32_t x = 0; x < blockDim; x++) {
+            const uint32_t sx = std::min(x0 + x, image.size.width - 1);
+            const uint8_t* pixel = image.data.get() + (static_cast<std::size_t>(sy) * image.size.width + sx) * 4;
+            block[y * blockDim + x] = {pixel[0], pixel[1], pixel[2]};
+        }
+    }
+}
+
+uint16_t packRGB565(const Color& c) {
+    const auto r = static_cast<uint16_t>((c.r * 31 + 127) / 255);
+    const auto g = static_cast<uint16_t>((c.g * 63 + 127) / 255);
+    const auto b = static_cast<uint16_t>((c.b * 31 + 127) / 255);
+    return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+Color unpackRGB565(uint16_t c) {
+    const int r = c >> 11;
+    const int g = (c >> 5) & 0x3f;
+    const int b = c & 0x1f;
+    return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+// Chooses the closest four color mode palette entry for every pixel, returning the total error
+int fitBC1Indices(const std::array<Color, blockPixels>& block, uint16_t color0, uint16_t color1, uint32_t& indices) {
+    const Color c0 = unpackRGB565(color0);
+    const Color c1 = unpackRGB565(color1);
+    const std::array<Color, 4> palette{c0,
+                                       c1,
+                                       Color{(2 * c0.r + c1.r) / 3, (2 * c0.g + c1.g) / 3, (2 * c0.b + c1.b) / 3},
+                                       Color{(c0.r + 2 * c1.r) / 3, (c0.g + 2 * c1.g) / 3, (c0.b + 2 * c1.b) / 3}};
+    int total = 0;
+    indices = 0;
+    for (uint32_t i = 0; i < blockPixels; i++) {
+        uint32_t best = 0;
+        int bestError = std::numeric_limits<int>::max();
+        for (uint32_t p = 0; p < palette.size(); p++) {
+            const int error = distance(block[i], palette[p]);
+            if (error < bestError) {
+                bestError = error;
+                best = p;
+            }
+        }
+        indices |= best << (2 * i);
+        total += bestError;
+    }
+    return total;
+}
+
+// BC1 with the endpoints at the extremes of the block along its principal axis, refined by a least squares fit
+void encodeBC1Block(const std::array<Color, blockPixels>& block, uint8_t* out) {
+    std::array<float, 3> mean{0, 0, 0};
+    for (const auto& c : block) {
+        mean[0] += static_cast<float>(c.r);
+        mean[1] += static_cast<float>(c.g);
+        mean[2] += static_cast<float>(c.b);
+    }
+    for (auto& m : mean) {
+        m /= blockPixels;
+    }
+
+    std::array<float, 6> cov{0, 0, 0, 0, 0, 0};
+    for (const auto& c : block) {
+        const float r = static_cast<float>(c.r) - mean[0];
+        const float g = static_cast<float>(c.g) - mean[1];
+        const float b = static_cast<float>(c.b) - mean[2];
+        cov[0] += r * r;
+        cov[1] += r * g;
+        cov[2] += r * b;
+        cov[3] += g * g;
+        cov[4] += g * b;
+        cov[5] += b * b;
+    }
+
+    // A few rounds of power iteration are enough to find the principal axis
+    std::array<float, 3> axis{1, 1, 1};
+    for (int i = 0; i < 4; i++) {
+        const std::array<float, 3> next{cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2],
+                                        cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2],
+                                        cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2]};
+        const float length = std::max({std::abs(next[0]), std::abs(next[1]), std::abs(next[2])});
+        if (length <= std::numeric_limits<float>::epsilon()) {
+            break;
+        }
+        axis = {next[0] / length, next[1] / length, next[2] / length};
+    }
+
+    std::size_t minIndex = 0;
+    std::size_t maxIndex = 0;
+    float minProjection = std::numeric_limits<float>::max();
+    float maxProjection = std::numeric_limits<float>::lowest();
+    for (std::size_t i = 0; i < blockPixels; i++) {
+        const float projection = static_cast<float>(block[i].r) * axis[0] + static_cast<float>(block[i].g) * axis[1] +
+                                 static_cast<float>(block[i].b) * axis[2];
+        if (projection < minProjection) {
+            minProjection = projection;
+            minIndex = i;
+        }
+        if (projection > maxProjection) {
+            maxProjection = projection;
+            maxIndex = i;
+        }
+    }
+
+    uint16_t color0 = packRGB565(block[maxIndex]);
+    uint16_t color1 = packRGB565(block[minIndex]);
+    uint32_t indices = 0;
+    int error = fitBC1Indices(block, color0, color1, indices);
+
+    if (color0 != color1) {
+        // Refine the endpoints with a least squares fit to the chosen palette entries, which each
+        // blend the endpoints with a fixed weight
+        constexpr std::array<float, 4> weights{1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+        float aa = 0, ab = 0, bb = 0;
+        std::array<float, 3> ap{0, 0, 0};
+        std::array<float, 3> bp{0, 0, 0};
+        for (uint32_t i = 0; i < blockPixels; i++) {
+            const float a = weights[(indices >> (2 * i)) & 3];
+            const float b = 1.0f - a;
+            const std::array<float, 3> c{
+                static_cast<float>(block[i].r), static_cast<float>(block[i].g), static_cast<float>(block[i].b)};
+            aa += a * a;
+            ab += a * b;
+            bb += b * b;
+            for (std::size_t k = 0; k < 3; k++) {
+                ap[k] += a * c[k];
+                bp[k] += b * c[k];
+            }
+        }
+        const float determinant = aa * bb - ab * ab;
+        if (std::abs(determinant) > std::numeric_limits<float>::epsilon()) {
+            std::array<int, 3> end0;
+            std::array<int, 3> end1;
+            for (std::size_t k = 0; k < 3; k++) {
+                end0[k] = clampChannel(static_cast<int>(std::lround((ap[k] * bb - bp[k] * ab) / determinant)));
+                end1[k] = clampChannel(static_cast<int>(std::lround((bp[k] * aa - ap[k] * ab) / determinant)));
+            }
+            const uint16_t refined0 = packRGB565({end0[0], end0[1], end0[2]});
+            const uint16_t refined1 = packRGB565({end1[0], end1[1], end1[2]});
+            uint32_t refinedIndices = 0;
+            const int refinedError = fitBC1Indices(block, refined0, refined1, refinedIndices);
+            if (refinedError < error) {
+                color0 = refined0;
+                color1 = refined1;
+                indices = refinedIndices;
+                error = refinedError;
+            }
+        }
+    }
+
+    if (color0 < color1) {
+        // color0 > color1 selects the four color mode, swapping the endpoints swaps the palette entries
+        std::swap(color0, color1);
+        indices ^= 0x55555555;
+    } else if (color0 == color1) {
+        indices = 0;
+    }
+
+    out[0] = static_cast<uint8_t>(color0);
+    out[1] = static_cast<uint8_t>(color0 >> 8);
+    out[2] = static_cast<uint8_t>(color1);
+    out[3] = static_cast<uint8_t>(color1 >> 8);
+    for (int i = 0; i < 4; i++) {
+        out[4 + i] = static_cast<uint8_t>(indices >> (8 * i));
+    }
+}
+
+constexpr std::array<std::array<int, 2>, 8> etcModifiers{
+    {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}}};
+
+struct SubblockFit {
+    int error = std::numeric_limits<int>::max();
+    uint8_t table = 0;
+    std::array<uint8_t, blockPixels / 2> indices{};
+};
+
+// Finds the modifier table and per pixel modifiers that best fit a half block around a base color.
+// Modifier index 0 and 1 add the small and large modifier, 2 and 3 subtract them.
+SubblockFit fitSubblock(const std::array<Color, blockPixels / 2>& pixels, const Color& base) {
+    SubblockFit best;
+    for (uint8_t table = 0; table < etcModifiers.size(); table++) {
+        SubblockFit fit;
+        fit.error = 0;
+        fit.table = table;
+        for (std::size_t i = 0; i < pixels.size(); i++) {
+            int bestError = std::numeric_limits<int>::max();
+            for (uint8_t index = 0; index < 4; index++) {
+                const int modifier = (index & 2) ? -etcModifiers[table][index & 1] : etcModifiers[table][index & 1];
+                const Color candidate{
+                    clampChannel(base.r + modifier), clampChannel(base.g + modifier), clampChannel(base.b + modifier)};
+                const int error = distance(pixels[i], candidate);
+                if (error < bestError) {
+                    bestError = error;
+                    fit.indices[i] = index;
+                }
+            }
+            fit.error += bestError;
+            if (fit.error >= best.error) {
+                break;
+            }
+        }
+        if (fit.error < best.error) {
+            best = fit;
+        }
+    }
+    return best;
+}
+
+// ETC1 blocks, which every ETC2 decoder accepts. The differential mode is used
+// whenever the two half blocks are close enough, and the individual mode otherwise.
+void encodeETC2Block(const std::array<Color, blockPixels>& block, uint8_t* out) {
+    int bestError = std::numeric_limits<int>::max();
+    std::array<uint8_t, 8> bestBlock{};
+
+    for (uint8_t flip = 0; flip < 2; flip++) {
+        // Without flip the half blocks are the left and right 2x4 pixels, with flip the top and bottom 4x2
+        std::array<std::array<Color, blockPixels / 2>, 2> halves;
+        std::array<std::array<uint8_t, blockPixels / 2>, 2> positions;
+        std::array<std::size_t, 2> counts{0, 0};
+        for (uint32_t y = 0; y < blockDim; y++) {
+            for (uint32_t x = 0; x < blockDim; x++) {
+                const std::size_t half = flip ? (y >= 2) : (x >= 2);
+                halves[half][counts[half]] = block[y * blockDim + x];
+                // Pixel indices are stored in column order
+                positions[half][counts[half]] = static_cast<uint8_t>(x * blockDim + y);
+                counts[half]++;
+            }
+        }
+
+        std::array<std::array<float, 3>, 2> averages{};
+        for (std::size_t half = 0; half < 2; half++) {
+            for (const auto& c : halves[half]) {
+                averages[half][0] += static_cast<float>(c.r);
+                averages[half][1] += static_cast<float>(c.g);
+                averages[half][2] += static_cast<float>(c.b);
+            }
+            for (auto& a : averages[half]) {
+                a /= static_cast<float>(blockPixels / 2);
+            }
+        }
+
+        const auto quantize = [&](std::size_t half, int levels) {
+            std::array<int, 3> q;
+            for (std::size_t c = 0; c < 3; c++) {
+                q[c] = static_cast<int>(std::lround(averages[half][c] * static_cast<float>(levels) / 255.0f));
+            }
+            return q;
+        };
+
+        std::array<uint8_t, 8> encoded{};
+        std::array<Color, 2> bases;
+        const auto q0 = quantize(0, 31);
+        const auto q1 = quantize(1, 31);
+        const bool differential = std::ranges::all_of(std::array<int, 3>{0, 1, 2}, [&](int c) {
+            return q1[c] - q0[c] >= -4 && q1[c] - q0[c] <= 3;
+        });
+        if (differential) {
+            const auto expand = [](int v) {
+                return (v << 3) | (v >> 2);
+            };
+            for (std::size_t c = 0; c < 3; c++) {
+                encoded[c] = static_cast<uint8_t>((q0[c] << 3) | ((q1[c] - q0[c]) & 0x7));
+            }
+            bases = {Color{expand(q0[0]), expand(q0[1]), expand(q0[2])},
+                     Color{expand(q1[0]), expand(q1[1]), expand(q1[2])}};
+        } else {
+            const auto i0 = quantize(0, 15);
+            const auto i1 = quantize(1, 15);
+            const auto expand = [](int v) {
+                return (v << 4) | v;
+            };
+            for (std::size_t c = 0; c < 3; c++) {
+                encoded[c] = static_cast<uint8_t>((i0[c] << 4) | i1[c]);
+            }
+            bases = {Color{expand(i0[0]), expand(i0[1]), expand(i0[2])},
+                     Color{expand(i1[0]), expand(i1[1]), expand(i1[2])}};
+        }
+
+        const auto fit0 = fitSubblock(halves[0], bases[0]);
+        const auto fit1 = fitSubblock(halves[1], bases[1]);
+        const int error = fit0.error + fit1.error;
+        if (error >= bestError) {
+            continue;
+        }
+
+        encoded[3] = static_cast<uint8_t>((fit0.table << 5) | (fit1.table << 2) | (differential ? 2 : 0) | flip);
+        uint32_t bits = 0;
+        for (std::size_t half = 0; half < 2; half++) {
+            const auto& fit = half == 0 ? fit0 : fit1;
+            for (std::size_t i = 0; i < fit.indices.size(); i++) {
+                const uint32_t position = positions[half][i];
+                bits |= static_cast<uint32_t>(fit.indices[i] >> 1) << (16 + position);
+                bits |= static_cast<uint32_t>(fit.indices[i] & 1) << position;
+            }
+        }
+        for (int i = 0; i < 4; i++) {
+            encoded[4 + i] = static_cast<uint8_t>(bits >> (24 - 8 * i));
+        }
+
+        bestError = error;
+        bestBlock = encoded;
+    }
+
+    std::memcpy(out, bestBlock.data(), bestBlock.size());
+}
+
+uint32_t readUInt32(const std::string& data, std::size_t offset) {
+    uint32_t value = 0;
+    for (std::size_t i = 0; i < 4; i++) {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(data[offset + i])) << (8 * i);
+    }
+    return value;
+}
+
+uint64_t readUInt64(const std::string& data, std::size_t offset) {
+    return readUInt32(data, offset) | (static_cast<uint64_t>(readUInt32(data, offset + 4)) << 32);
+}
+
+constexpr std::array<uint8_t, 12> ktx2Identifier{0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+constexpr std::size_t ktx2HeaderSize = 80;
+constexpr std::size_t ktx2LevelIndexEntrySize = 24;
+// The largest texture that renderers are required to support, anything larger in a tile is bogus
+constexpr uint32_t ktx2MaxDimension = 16384;
+
+} // namespace
+
+std::size_t compressedDataSize(gfx::TexturePixelType format, Size size) {
+    // In 64 bits, so that dimensions close to the 32 bit limit don't wrap around to zero blocks
+    const uint64_t blocks = ((static_cast<uint64_t>(size.width) + blockDim - 1) / blockDim) *
+                            ((static_cast<uint64_t>(size.height) + blockDim - 1) / blockDim);
+    switch (format) {
+        case gfx::TexturePixelType::ETC2:
+        case gfx::TexturePixelType::BC1:
+            return blocks * 8;
+        case gfx::TexturePixelType::ASTC:
+            return blocks * 16;
+        default:
+            return 0;
+    }
+}
+
+bool isKTX2(const std::string& data) {
+    return data.size() >= ktx2Identifier.size() &&
+           std::memcmp(data.data(), ktx2Identifier.data(), ktx2Identifier.size()) == 0;
+}
+
+CompressedImage decodeKTX2(const std::string& data) {
+    if (!isKTX2(data) || data.size() < ktx2HeaderSize + ktx2LevelIndexEntrySize) {
+        throw std::runtime_error("invalid KTX2 container");
+    }
+
+    gfx::TexturePixelType format;
+    switch (readUInt32(data, 12)) {
+        case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+        case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+        case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+        case 134: // VK_FORMAT_BC1_RGBA_SRGB_BLOCK
+            format = gfx::TexturePixelType::BC1;
+            break;
+        case 147: // VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK
+        case 148: // VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK
+            format = gfx::TexturePixelType::ETC2;
+            break;
+        case 157: // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+        case 158: // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+            format = gfx::TexturePixelType::ASTC;
+            break;
+        default:
+            throw std::runtime_error("unsupported KTX2 texture format");
+    }
+
+    const Size size{readUInt32(data, 20), readUInt32(data, 24)};
+    const uint32_t depth = readUInt32(data, 28);
+    const uint32_t layers = readUInt32(data, 32);
+    const uint32_t faces = readUInt32(data, 36);
+    const uint32_t supercompression = readUInt32(data, 44);
+    if (size.isEmpty() || depth != 0 || layers > 1 || faces != 1) {
+        throw std::runtime_error("KTX2 container is not a single 2D texture");
+    }
+    if (size.width > ktx2MaxDimension || size.height > ktx2MaxDimension) {
+        throw std::runtime_error("KTX2 texture is too large");
+    }
+    if (supercompression != 0) {
+        throw std::runtime_error("supercompressed KTX2 containers are not supported");
+    }
+
+    // The first level is the base level
+    const uint64_t offset = readUInt64(data, ktx2HeaderSize);
+    const uint64_t length = readUInt64(data, ktx2HeaderSize + 8);
+    // Checked before allocating, the header alone can't be trusted with the size of the image
+    if (length != compressedDataSize(format, size) || offset > data.size() || length > data.size() - offset) {
+        throw std::runtime_error("invalid KTX2 level data");
+    }
+
+    CompressedImage image(format, size);
+
+    std::memcpy(image.data.get(), data.data() + offset, image.bytes());
+    return image;
+}
+
+CompressedImage compressImage(const PremultipliedImage& image, gfx::TexturePixelType format) {
+    if (!image.valid() || (format != gfx::TexturePixelType::ETC2 && format != gfx::TexturePixelType::BC1)) {
+        return {};
+    }
+
+    const std::size_t pixels = image.size.area();
+    for (std::size_t i = 0; i < pixels; i++) {
+        if (image.data[i * 4 + 3] != 255) {
+            return {};
+        }
+    }
+
+    CompressedImage result(format, image.size);
+    uint8_t* out = result.data.get();
+    std::array<Color, blockPixels> block;
+    for (uint32_t y = 0; y < image.size.height; y += blockDim) {
+        for (uint32_t x = 0; x < image.size.width; x += blockDim) {
+            loadBlock(image, x, y, block);
+            if (format == gfx::TexturePixelType::ETC2) {
+                encodeETC2Block(block, out);
+            } else {
+                encodeBC1Block(block, out);
+            }
+            out += 8;
+        }
+    }
+    return result;
+}
+
+} // namespace mbgl
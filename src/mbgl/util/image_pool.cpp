@@ -0,0 +1,64 @@
+#include <mbgl/util/image_pool.hpp>
+
+#include <algorithm>
+
+namespace mbgl {
+
+ImagePool& ImagePool::get() {
+    // Leaked so that images destroyed during shutdown can still return their storage
+    static auto* pool = new ImagePool();
+    return *pool;
+}
+
+PremultipliedImage ImagePool::acquire(Size size) {
+    const auto bytes = static_cast<std::size_t>(size.width) * size.height * PremultipliedImage::channels;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = std::find_if(
+            pooled.begin(), pooled.end(), [&](const auto& storage) { return storage.first == bytes; });
+        if (it != pooled.end()) {
+            auto data = std::move(it->second);
+            *it = std::move(pooled.back());
+            pooled.pop_back();
+            retainedBytes -= bytes;
+            return {size, std::move(data)};
+        }
+    }
+    return PremultipliedImage(size);
+}
+
+void ImagePool::release(PremultipliedImage&& image) {
+    const auto bytes = image.bytes();
+    if (!image.valid() || bytes > maxRetainedBytes) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pooled.size() >= maxRetainedImages || retainedBytes + bytes > maxRetainedBytes) {
+        return;
+    }
+    pooled.emplace_back(bytes, std::move(image.data));
+    retainedBytes += bytes;
+    image.size = {0, 0};
+}
+
+std::shared_ptr<PremultipliedImage> ImagePool::share(PremultipliedImage&& image) {
+    return std::shared_ptr<PremultipliedImage>(new PremultipliedImage(std::move(image)),
+                                               [](PremultipliedImage* shared) {
+                                                   ImagePool::get().release(std::move(*shared));
+                                                   delete shared;
+                                               });
+}
+
+void ImagePool::clear() {
+    decltype(pooled) freed;
+    std::lock_guard<std::mutex> lock(mutex);
+    freed.swap(pooled);
+    retainedBytes = 0;
+}
+
+std::size_t ImagePool::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pooled.size();
+}
+
+} // namespace mbgl
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <mbgl/util/image.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+
+/// Recycles the pixel storage of decoded raster tiles, which mostly come in a few sizes.
+///
+/// Images are decoded on worker threads and released on the render thread once their tile is gone,
+/// so the pool is shared between threads. It keeps at most a few tiles worth of pixels, which are
+/// freed when the renderer is asked to reduce its memory use.
+class ImagePool {
+public:
+    static constexpr std::size_t maxRetainedBytes = 16 * 1024 * 1024;
+    static constexpr std::size_t maxRetainedImages = 16;
+
+    static ImagePool& get();
+
+    /// Get an image of the given size, reusing pooled storage of the same byte size if there is any.
+    /// The contents of the image are undefined.
+    PremultipliedImage acquire(Size);
+
+    /// Return the storage of an image that is no longer needed
+    void release(PremultipliedImage&&);
+
+    /// Share an image, returning its storage to the pool once the last reference to it is gone
+    std::shared_ptr<PremultipliedImage> share(PremultipliedImage&&);
+
+    /// Free all pooled storage
+    void clear();
+
+    std::size_t size() const;
+
+private:
+    ImagePool() = default;
+
+    mutable std::mutex mutex;
+    std::vector<std::pair<std::size_t, std::unique_ptr<uint8_t[]>>> pooled;
+    std::size_t retainedBytes = 0;
+};
+
+} // namespace mbgl
@@ -0,0 +1,92 @@
+#include <mbgl/util/parallel_for.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+
+struct ParallelForState {
+    ParallelForState(std::size_t count_, std::size_t grain_, const std::function<void(std::size_t, std::size_t)>& fn_)
+        : count(count_),
+          grain(grain_),
+          fn(fn_) {}
+
+    // Claims and runs ranges until there are none left
+    void run() {
+        while (true) {
+            const auto begin = next.fetch_add(grain);
+            if (begin >= count) {
+                return;
+            }
+            const auto end = std::min(begin + grain, count);
+            try {
+                fn(begin, end);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+            if (done.fetch_add(end - begin) + (end - begin) == count) {
+                std::lock_guard<std::mutex> lock(mutex);
+                finished.notify_all();
+            }
+        }
+    }
+
+    const std::size_t count;
+    const std::size_t grain;
+    // Only called for claimed ranges, which the calling thread waits for, so the reference stays valid
+    const std::function<void(std::size_t, std::size_t)>& fn;
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+    std::exception_ptr error;
+};
+
+} // namespace
+
+void parallelFor(const TaggedScheduler& scheduler,
+                 std::size_t count,
+                 std::size_t grain,
+                 const std::function<void(std::size_t begin, std::size_t end)>& fn) {
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<std::size_t>(grain, 1);
+    const auto ranges = (count + grain - 1) / grain;
+    if (ranges == 1) {
+        fn(0, count);
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>(count, grain, fn);
+
+    // Helpers that start after all the ranges were claimed return right away
+    const auto helpers = std::min<std::size_t>(ranges - 1, std::max(1u, std::thread::hardware_concurrency()) - 1);
+    auto pool = scheduler;
+    for (std::size_t i = 0; i < helpers; ++i) {
+        pool.schedule([state] { state->run(); });
+    }
+
+    state->run();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&] { return state->done.load() == count; });
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+} // namespace util
+} // namespace mbgl
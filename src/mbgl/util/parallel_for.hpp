@@ -0,0 +1,23 @@
+#pragma once
+
+#include <mbgl/actor/scheduler.hpp>
+
+#include <cstddef>
+#include <functional>
+
+namespace mbgl {
+namespace util {
+
+/// Run `fn(begin, end)` over consecutive ranges of at most `grain` elements covering `[0, count)`, spreading the
+/// ranges over the threads of `scheduler`.
+///
+/// The calling thread works on the ranges too and only ever waits for ranges that another thread has already
+/// started, so this can be called from a task running on the same scheduler without risking a deadlock.
+/// Exceptions thrown by `fn` are rethrown on the calling thread once all the started ranges are done.
+void parallelFor(const TaggedScheduler& scheduler,
+                 std::size_t count,
+                 std::size_t grain,
+                 const std::function<void(std::size_t begin, std::size_t end)>& fn);
+
+} // namespace util
+} // namespace mbgl
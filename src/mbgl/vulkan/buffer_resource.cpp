@@ -49,7 +49,8 @@ BufferResource::BufferResource(
     : context(context_),
       size(size_),
       usage(usage_),
-      persistent(persistent_) {
+      persistent(persistent_),
+      resourceID(context_.nextResourceID()) {
     MLN_TRACE_FUNC();
 
     const auto& allocator = context.getBackend().getAllocator();
@@ -120,6 +121,7 @@ BufferResource::BufferResource(BufferResource&& other) noexcept
       usage(other.usage),
       version(other.version),
       persistent(other.persistent),
+      resourceID(other.resourceID),
       bufferAllocation(std::move(other.bufferAllocation)),
       bufferWindowSize(other.bufferWindowSize),
       bufferWindowVersions(std::move(other.bufferWindowVersions)) {
@@ -156,6 +158,7 @@ BufferResource& BufferResource::operator=(BufferResource&& other) noexcept {
     size = other.size;
     usage = other.usage;
     persistent = other.persistent;
+    resourceID = other.resourceID;
     bufferAllocation = std::move(other.bufferAllocation);
     bufferWindowSize = other.bufferWindowSize;
     return *this;
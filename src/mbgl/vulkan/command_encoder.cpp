@@ -4,6 +4,7 @@
 #include <mbgl/vulkan/upload_pass.hpp>
 #include <mbgl/vulkan/render_pass.hpp>
 
+#include <cassert>
 #include <cstring>
 
 namespace mbgl {
@@ -11,7 +12,8 @@ namespace vulkan {
 
 CommandEncoder::CommandEncoder(Context& context_, const vk::UniqueCommandBuffer& buffer_)
     : context(context_),
-      commandBuffer(buffer_) {}
+      primaryCommandBuffer(buffer_),
+      commandBuffer(&buffer_) {}
 
 CommandEncoder::~CommandEncoder() {}
 
@@ -33,11 +35,30 @@ void CommandEncoder::pushDebugGroup(const char* name) {
 }
 
 void CommandEncoder::pushDebugGroup(const char* name, const std::array<float, 4>& color) {
-    context.getBackend().beginDebugLabel(commandBuffer.get(), name, color);
+    if (commandBuffer != &primaryCommandBuffer) {
+        secondaryDebugGroups.push_back({name, color});
+    }
+    context.getBackend().beginDebugLabel(commandBuffer->get(), name, color);
 }
 
 void CommandEncoder::popDebugGroup() {
-    context.getBackend().endDebugLabel(commandBuffer.get());
+    if (commandBuffer != &primaryCommandBuffer) {
+        assert(!secondaryDebugGroups.empty());
+        secondaryDebugGroups.pop_back();
+    }
+    context.getBackend().endDebugLabel(commandBuffer->get());
+}
+
+void CommandEncoder::beginSecondaryDebugGroups(const vk::UniqueCommandBuffer& buffer) const {
+    for (const auto& label : secondaryDebugGroups) {
+        context.getBackend().beginDebugLabel(buffer.get(), label.name.c_str(), label.color);
+    }
+}
+
+void CommandEncoder::endSecondaryDebugGroups(const vk::UniqueCommandBuffer& buffer) const {
+    for (std::size_t i = 0; i < secondaryDebugGroups.size(); ++i) {
+        context.getBackend().endDebugLabel(buffer.get());
+    }
 }
 
 } // namespace vulkan
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <thread>
 
 namespace mbgl {
 namespace vulkan {
@@ -41,6 +42,9 @@ constexpr uint32_t layerDescriptorPoolSize = 3 * 256;
 constexpr uint32_t drawableUniformDescriptorPoolSize = 3 * 1024;
 constexpr uint32_t drawableImageDescriptorPoolSize = drawableUniformDescriptorPoolSize / 2;
 
+// Recording is cheap compared to the rest of the frame, more threads than this don't pay off
+constexpr std::size_t maxEncoderThreadCount = 8;
+
 namespace {
 uint32_t glslangRefCount = 0;
 }
@@ -117,6 +121,25 @@ void Context::initFrameResources() {
         backend.setDebugName(frame.flightFrameFence.get(), "FrameFence_" + std::to_string(index));
     }
 
+    // secondary command buffers for encoding render passes in parallel, one pool per encoder thread and one for the
+    // render thread
+    const auto hardwareThreads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    encoderThreadCount = std::min(hardwareThreads > 1 ? hardwareThreads - 1 : 0, maxEncoderThreadCount);
+
+    if (encoderThreadCount > 0) {
+        encoderScheduler = std::make_unique<ThreadedScheduler>(encoderThreadCount);
+
+        const vk::CommandPoolCreateInfo poolInfo(vk::CommandPoolCreateFlagBits::eTransient,
+                                                 backend.getGraphicsQueueIndex());
+
+        for (auto& frame : frameResources) {
+            frame.secondaryPools.resize(encoderThreadCount + 1);
+            for (auto& secondaryPool : frame.secondaryPools) {
+                secondaryPool.pool = device->createCommandPoolUnique(poolInfo, nullptr, dispatcher);
+            }
+        }
+    }
+
     // force placeholder texture upload before any descriptor sets
     (void)getDummyTexture();
 
@@ -227,6 +250,7 @@ void Context::beginFrame() {
     MLN_TRACE_FUNC();
 
     frameResourceIndex = (frameResourceIndex + 1) % frameResources.size();
+    ++frameNumber;
 
     const auto& device = backend.getDevice();
     const auto& dispatcher = backend.getDispatcher();
@@ -278,6 +302,21 @@ void Context::beginFrame() {
 
     frame.runDeletionQueue(*this);
 
+    // the frame that used these resources last is done, and so are the ones before it
+    const auto frameCount = static_cast<uint64_t>(frameResources.size());
+    if (frameNumber > frameCount) {
+        for (auto& [type, pool] : descriptorPoolMap) {
+            pool.releaseUnusedSets(frameNumber - frameCount);
+        }
+    }
+
+    for (auto& secondaryPool : frame.secondaryPools) {
+        if (secondaryPool.used > 0) {
+            device->resetCommandPool(secondaryPool.pool.get(), {}, dispatcher);
+            secondaryPool.used = 0;
+        }
+    }
+
     if (platformSurface) {
         MLN_TRACE_ZONE(acquireNextImageKHR);
         try {
@@ -363,6 +402,21 @@ void Context::submitFrame() {
     backend.endFrameCapture();
 }
 
+const vk::UniqueCommandBuffer& Context::acquireSecondaryCommandBuffer(std::size_t thread) {
+    auto& secondaryPool = frameResources[frameResourceIndex].secondaryPools[thread];
+
+    if (secondaryPool.used == secondaryPool.buffers.size()) {
+        const auto& device = backend.getDevice();
+        const vk::CommandBufferAllocateInfo allocateInfo(
+            secondaryPool.pool.get(), vk::CommandBufferLevel::eSecondary, 1);
+
+        auto buffers = device->allocateCommandBuffersUnique(allocateInfo, backend.getDispatcher());
+        secondaryPool.buffers.push_back(std::move(buffers.front()));
+    }
+
+    return secondaryPool.buffers[secondaryPool.used++];
+}
+
 std::unique_ptr<gfx::CommandEncoder> Context::createCommandEncoder() {
     const auto& frame = frameResources[frameResourceIndex];
     return std::make_unique<CommandEncoder>(*this, frame.commandBuffer);
@@ -385,6 +439,8 @@ UniqueShaderProgram Context::createProgram(shaders::BuiltIn shaderID,
 
 void Context::performCleanup() {
     stats.numDrawCalls = 0;
+    stats.numDrawableBatches = 0;
+    stats.numIndirectDrawCalls = 0;
     ++stats.numFrames;
 }
 
@@ -433,6 +489,17 @@ gfx::Texture2DPtr Context::createTexture2D() {
     return std::make_shared<Texture2D>(*this);
 }
 
+TextureCompressionSupport Context::getTextureCompressionSupport() const {
+    const auto& features = backend.getDeviceFeatures();
+    return {.etc2 = features.textureCompressionETC2 == VK_TRUE,
+            .bc1 = features.textureCompressionBC == VK_TRUE,
+            .astc = features.textureCompressionASTC_LDR == VK_TRUE};
+}
+
+bool Context::isSoftwareRenderer() const {
+    return backend.getDeviceProperties().deviceType == vk::PhysicalDeviceType::eCpu;
+}
+
 RenderTargetPtr Context::createRenderTarget(const Size size, const gfx::TextureChannelDataType type) {
     return std::make_shared<RenderTarget>(*this, size, type);
 }
@@ -488,6 +555,7 @@ void Context::bindGlobalUniformBuffers(gfx::RenderPass& renderPass) const noexce
     }
 
     context.globalUniformBuffers.bindDescriptorSets(renderPassImpl.getEncoder());
+    renderPassImpl.setGlobalUniformBuffersBound();
 }
 
 bool Context::renderTileClippingMasks(gfx::RenderPass& renderPass,
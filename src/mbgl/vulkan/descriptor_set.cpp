@@ -3,34 +3,45 @@
 #include <mbgl/vulkan/context.hpp>
 #include <mbgl/vulkan/command_encoder.hpp>
 #include <mbgl/vulkan/texture2d.hpp>
+#include <mbgl/util/hash.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/util/instrumentation.hpp>
 #include <mbgl/util/monotonic_timer.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
-#define USE_DESCRIPTOR_POOL_RESET
-
 namespace mbgl {
 namespace vulkan {
 
+std::size_t DescriptorPoolGrowable::CacheKeyHash::operator()(const CacheKey& key) const noexcept {
+    std::size_t seed = key.size();
+    for (const auto value : key) {
+        util::hash_combine(seed, value);
+    }
+    return seed;
+}
+
+void DescriptorPoolGrowable::releaseUnusedSets(uint64_t completedFrame) {
+    MLN_TRACE_FUNC();
+
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (it->second.use_count() == 1 && it->second->lastUsedFrame <= completedFrame) {
+            freeSets.push_back(it->second->set);
+            it = cache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 DescriptorSet::DescriptorSet(Context& context_, DescriptorSetType type_)
     : context(context_),
       type(type_) {}
 
-DescriptorSet::~DescriptorSet() {
-    context.enqueueDeletion(
-        [type_ = type, poolIndex = descriptorPoolIndex, sets = std::move(descriptorSets)](auto& context_) mutable {
-            auto& poolInfo = context_.getDescriptorPool(type_).pools[poolIndex];
-#ifdef USE_DESCRIPTOR_POOL_RESET
-            poolInfo.unusedSets.push(std::move(sets));
-#else
-            context_.getBackend().getDevice()->freeDescriptorSets(poolInfo.pool.get(), sets);
-            poolInfo.remainingSets += sets.size();
-#endif
-        });
-}
+// The cache keeps the sets until the GPU is done with them
+DescriptorSet::~DescriptorSet() = default;
 
 void DescriptorSet::createDescriptorPool(DescriptorPoolGrowable& growablePool) {
     const auto& backend = context.getBackend();
@@ -39,12 +50,6 @@ void DescriptorSet::createDescriptorPool(DescriptorPoolGrowable& growablePool) {
     const uint32_t maxSets = static_cast<uint32_t>(growablePool.maxSets *
                                                    std::pow(growablePool.growFactor, growablePool.pools.size()));
 
-#ifdef USE_DESCRIPTOR_POOL_RESET
-    const auto poolFlags = vk::DescriptorPoolCreateFlags();
-#else
-    const auto poolFlags = vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet;
-#endif
-
     std::vector<vk::DescriptorPoolSize> sizes;
     if (growablePool.descriptorStoragePerSet > 0) {
         sizes.emplace_back(
@@ -59,69 +64,82 @@ void DescriptorSet::createDescriptorPool(DescriptorPoolGrowable& growablePool) {
                                                   maxSets * growablePool.descriptorTexturesPerSet));
     }
 
-    const auto descriptorPoolInfo = vk::DescriptorPoolCreateInfo(poolFlags).setPoolSizes(sizes).setMaxSets(maxSets);
+    const auto descriptorPoolInfo = vk::DescriptorPoolCreateInfo().setPoolSizes(sizes).setMaxSets(maxSets);
 
     growablePool.pools.emplace_back(
         device->createDescriptorPoolUnique(descriptorPoolInfo, nullptr, backend.getDispatcher()), maxSets);
     growablePool.currentPoolIndex = static_cast<int32_t>(growablePool.pools.size() - 1);
 };
 
-void DescriptorSet::allocate() {
+vk::DescriptorSet DescriptorSet::allocate(DescriptorPoolGrowable& growablePool) {
     MLN_TRACE_FUNC();
 
-    if (!descriptorSets.empty()) {
-        return;
+    // sets are never freed, evicted ones are written again instead
+    if (!growablePool.freeSets.empty()) {
+        const auto set = growablePool.freeSets.back();
+        growablePool.freeSets.pop_back();
+        return set;
+    }
+
+    if (growablePool.currentPoolIndex == -1 || growablePool.current().remainingSets == 0) {
+        // find a pool that has available memory to allocate more descriptor sets
+        const auto& freePoolIt = std::find_if(growablePool.pools.begin(),
+                                              growablePool.pools.end(),
+                                              [&](const auto& p) { return p.remainingSets > 0; });
+
+        if (freePoolIt != growablePool.pools.end()) {
+            growablePool.currentPoolIndex = static_cast<int32_t>(std::distance(growablePool.pools.begin(), freePoolIt));
+        } else {
+            createDescriptorPool(growablePool);
+        }
     }
 
     const auto& backend = context.getBackend();
     const auto& device = backend.getDevice();
     const auto& descriptorSetLayout = context.getDescriptorSetLayout(type);
-    auto& growablePool = context.getDescriptorPool(type);
-    const std::vector<vk::DescriptorSetLayout> layouts(backend.getMaxFrames(), descriptorSetLayout);
-
-    if (growablePool.currentPoolIndex == -1 ||
-        (growablePool.current().unusedSets.empty() && growablePool.current().remainingSets < layouts.size())) {
-#ifdef USE_DESCRIPTOR_POOL_RESET
-        // find a pool that has unused allocated descriptor sets
-        const auto& unusedPoolIt = std::find_if(
-            growablePool.pools.begin(), growablePool.pools.end(), [&](const auto& p) { return !p.unusedSets.empty(); });
-
-        if (unusedPoolIt != growablePool.pools.end()) {
-            growablePool.currentPoolIndex = static_cast<int32_t>(
-                std::distance(growablePool.pools.begin(), unusedPoolIt));
-        } else
-#endif
-        {
-            // find a pool that has available memory to allocate more descriptor sets
-            const auto& freePoolIt = std::find_if(growablePool.pools.begin(),
-                                                  growablePool.pools.end(),
-                                                  [&](const auto& p) { return p.remainingSets >= layouts.size(); });
-
-            if (freePoolIt != growablePool.pools.end()) {
-                growablePool.currentPoolIndex = static_cast<int32_t>(
-                    std::distance(growablePool.pools.begin(), freePoolIt));
-            } else {
-                createDescriptorPool(growablePool);
-            }
-        }
+
+    const auto sets = device->allocateDescriptorSets(vk::DescriptorSetAllocateInfo()
+                                                         .setDescriptorPool(growablePool.current().pool.get())
+                                                         .setSetLayouts(descriptorSetLayout),
+                                                     backend.getDispatcher());
+    growablePool.current().remainingSets--;
+
+    return sets.front();
+}
+
+bool DescriptorSet::needsUpdate() {
+    if (descriptorSets.empty()) {
+        const auto frameCount = context.getBackend().getMaxFrames();
+        descriptorSets.resize(frameCount);
+        dirty = std::vector(frameCount, true);
+    }
+
+    const uint8_t frameIndex = context.getCurrentFrameResourceIndex();
+    if (dirty[frameIndex] || !descriptorSets[frameIndex]) {
+        return true;
     }
 
-    descriptorPoolIndex = growablePool.currentPoolIndex;
-
-#ifdef USE_DESCRIPTOR_POOL_RESET
-    if (!growablePool.current().unusedSets.empty()) {
-        descriptorSets = growablePool.current().unusedSets.front();
-        growablePool.current().unusedSets.pop();
-    } else
-#endif
-    {
-        descriptorSets = device->allocateDescriptorSets(
-            vk::DescriptorSetAllocateInfo().setDescriptorPool(growablePool.current().pool.get()).setSetLayouts(layouts),
-            backend.getDispatcher());
-        growablePool.current().remainingSets -= descriptorSets.size();
+    descriptorSets[frameIndex]->lastUsedFrame = context.getFrameNumber();
+    return false;
+}
+
+void DescriptorSet::useCachedSet(const std::function<void(vk::DescriptorSet)>& write) {
+    MLN_TRACE_FUNC();
+
+    auto& growablePool = context.getDescriptorPool(type);
+    auto it = growablePool.cache.find(growablePool.scratchKey);
+    if (it == growablePool.cache.end()) {
+        auto cachedSet = std::make_shared<DescriptorPoolGrowable::CachedSet>();
+        cachedSet->set = allocate(growablePool);
+        write(cachedSet->set);
+
+        it = growablePool.cache.emplace(growablePool.scratchKey, std::move(cachedSet)).first;
     }
 
-    dirty = std::vector(descriptorSets.size(), true);
+    const uint8_t frameIndex = context.getCurrentFrameResourceIndex();
+    it->second->lastUsedFrame = context.getFrameNumber();
+    descriptorSets[frameIndex] = it->second;
+    dirty[frameIndex] = false;
 }
 
 void DescriptorSet::markDirty() {
@@ -129,16 +147,19 @@ void DescriptorSet::markDirty() {
 }
 
 void DescriptorSet::bind(CommandEncoder& encoder) {
+    bind(encoder.getCommandBuffer());
+}
+
+void DescriptorSet::bind(const vk::UniqueCommandBuffer& commandBuffer) const {
     MLN_TRACE_FUNC();
-    const auto& backend = encoder.getContext().getBackend();
-    auto& commandBuffer = encoder.getCommandBuffer();
+    const auto& backend = context.getBackend();
 
     const uint8_t index = context.getCurrentFrameResourceIndex();
 
     commandBuffer->bindDescriptorSets(vk::PipelineBindPoint::eGraphics,
                                       context.getGeneralPipelineLayout().get(),
                                       static_cast<uint32_t>(type),
-                                      descriptorSets[index],
+                                      descriptorSets[index]->set,
                                       nullptr,
                                       backend.getDispatcher());
 }
@@ -152,44 +173,52 @@ void UniformDescriptorSet::update(const gfx::UniformBufferArray& uniforms,
                                   uint32_t descriptorUniformCount) {
     MLN_TRACE_FUNC();
 
-    allocate();
-
-    const uint8_t frameIndex = context.getCurrentFrameResourceIndex();
-    if (!dirty[frameIndex]) {
+    if (!needsUpdate()) {
         return;
     }
 
-    const auto& backend = context.getBackend();
-    const auto& device = backend.getDevice();
+    const auto descriptorCount = descriptorStorageCount + descriptorUniformCount;
+    std::vector<vk::DescriptorBufferInfo> bufferInfos(descriptorCount);
 
-    for (size_t index = 0; index < descriptorStorageCount + descriptorUniformCount; ++index) {
-        vk::DescriptorBufferInfo descriptorBufferInfo;
+    auto& key = context.getDescriptorPool(type).scratchKey;
+    key.clear();
 
+    for (size_t index = 0; index < descriptorCount; ++index) {
         if (const auto& uniformBuffer = uniforms.get(descriptorStartIndex + index)) {
-            const auto& uniformBufferImpl = static_cast<const UniformBuffer&>(*uniformBuffer);
-            const auto& bufferResource = uniformBufferImpl.getBufferResource();
-            descriptorBufferInfo.setBuffer(bufferResource.getVulkanBuffer())
+            const auto& bufferResource = static_cast<const UniformBuffer&>(*uniformBuffer).getBufferResource();
+            bufferInfos[index]
+                .setBuffer(bufferResource.getVulkanBuffer())
                 .setOffset(bufferResource.getVulkanBufferOffset())
                 .setRange(bufferResource.getSizeInBytes());
+            key.push_back(bufferResource.getResourceID());
         } else {
             const auto& dummyBuffer = context.getDummyBuffer();
-            descriptorBufferInfo.setBuffer(dummyBuffer->getVulkanBuffer()).setOffset(0).setRange(VK_WHOLE_SIZE);
+            bufferInfos[index].setBuffer(dummyBuffer->getVulkanBuffer()).setOffset(0).setRange(VK_WHOLE_SIZE);
+            key.push_back(dummyBuffer->getResourceID());
         }
 
-        const auto descriptorType = index < descriptorStorageCount ? vk::DescriptorType::eStorageBuffer
-                                                                   : vk::DescriptorType::eUniformBuffer;
+        key.push_back(bufferInfos[index].offset);
+        key.push_back(bufferInfos[index].range);
+    }
 
-        const auto writeDescriptorSet = vk::WriteDescriptorSet()
-                                            .setBufferInfo(descriptorBufferInfo)
-                                            .setDescriptorCount(1)
-                                            .setDescriptorType(descriptorType)
-                                            .setDstBinding(static_cast<uint32_t>(index))
-                                            .setDstSet(descriptorSets[frameIndex]);
+    useCachedSet([&](vk::DescriptorSet set) {
+        const auto& backend = context.getBackend();
 
-        device->updateDescriptorSets(writeDescriptorSet, nullptr, backend.getDispatcher());
-    }
+        std::vector<vk::WriteDescriptorSet> writes(descriptorCount);
+        for (size_t index = 0; index < descriptorCount; ++index) {
+            const auto descriptorType = index < descriptorStorageCount ? vk::DescriptorType::eStorageBuffer
+                                                                       : vk::DescriptorType::eUniformBuffer;
 
-    dirty[frameIndex] = false;
+            writes[index]
+                .setBufferInfo(bufferInfos[index])
+                .setDescriptorCount(1)
+                .setDescriptorType(descriptorType)
+                .setDstBinding(static_cast<uint32_t>(index))
+                .setDstSet(set);
+        }
+
+        backend.getDevice()->updateDescriptorSets(writes, nullptr, backend.getDispatcher());
+    });
 }
 
 ImageDescriptorSet::ImageDescriptorSet(Context& context_)
@@ -204,36 +233,45 @@ void ImageDescriptorSet::markDirty() {
 
 void ImageDescriptorSet::update(const std::array<gfx::Texture2DPtr, shaders::maxTextureCountPerShader>& textures) {
     MLN_TRACE_FUNC();
-    allocate();
 
-    const uint8_t frameIndex = context.getCurrentFrameResourceIndex();
-    if (!dirty[frameIndex]) {
+    if (!needsUpdate()) {
         return;
     }
 
-    const auto& backend = context.getBackend();
-    const auto& device = backend.getDevice();
+    std::array<vk::DescriptorImageInfo, shaders::maxTextureCountPerShader> imageInfos;
+
+    auto& key = context.getDescriptorPool(type).scratchKey;
+    key.clear();
 
     for (size_t id = 0; id < shaders::maxTextureCountPerShader; ++id) {
         const auto& texture = id < textures.size() ? textures[id] : nullptr;
         auto& textureImpl = texture ? static_cast<Texture2D&>(*texture) : *context.getDummyTexture();
 
-        const auto descriptorImageInfo = vk::DescriptorImageInfo()
-                                             .setImageLayout(textureImpl.getVulkanImageLayout())
-                                             .setImageView(textureImpl.getVulkanImageView().get())
-                                             .setSampler(textureImpl.getVulkanSampler());
-
-        const auto writeDescriptorSet = vk::WriteDescriptorSet()
-                                            .setImageInfo(descriptorImageInfo)
-                                            .setDescriptorCount(1)
-                                            .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
-                                            .setDstBinding(static_cast<uint32_t>(id))
-                                            .setDstSet(descriptorSets[frameIndex]);
+        // the sampler is created on demand, which changes the resource ID
+        imageInfos[id]
+            .setSampler(textureImpl.getVulkanSampler())
+            .setImageLayout(textureImpl.getVulkanImageLayout())
+            .setImageView(textureImpl.getVulkanImageView().get());
 
-        device->updateDescriptorSets(writeDescriptorSet, nullptr, backend.getDispatcher());
+        key.push_back(textureImpl.getResourceID());
+        key.push_back(static_cast<uint64_t>(imageInfos[id].imageLayout));
     }
 
-    dirty[frameIndex] = false;
+    useCachedSet([&](vk::DescriptorSet set) {
+        const auto& backend = context.getBackend();
+
+        std::array<vk::WriteDescriptorSet, shaders::maxTextureCountPerShader> writes;
+        for (size_t id = 0; id < shaders::maxTextureCountPerShader; ++id) {
+            writes[id]
+                .setImageInfo(imageInfos[id])
+                .setDescriptorCount(1)
+                .setDescriptorType(vk::DescriptorType::eCombinedImageSampler)
+                .setDstBinding(static_cast<uint32_t>(id))
+                .setDstSet(set);
+        }
+
+        backend.getDevice()->updateDescriptorSets(writes, nullptr, backend.getDispatcher());
+    });
 }
 
 } // namespace vulkan
@@ -20,6 +20,7 @@
 #include <mbgl/util/hash.hpp>
 #include <mbgl/util/instrumentation.hpp>
 
+#include <algorithm>
 #include <cassert>
 #if !defined(NDEBUG)
 #include <sstream>
@@ -127,6 +128,7 @@ void Drawable::updateVertexAttributes(gfx::VertexAttributeArrayPtr vertices,
 
     impl->indexes = std::move(indexes);
     impl->segments = std::move(drawSegs);
+    impl->indirectCommands.reset();
 }
 
 void Drawable::upload(gfx::UploadPass& uploadPass_) {
@@ -233,34 +235,79 @@ void Drawable::upload(gfx::UploadPass& uploadPass_) {
         uploadTextures(uploadPass);
     }
 
+    buildIndirectCommands(uploadPass);
+
     attributeUpdateTime = util::MonotonicTimer::now();
 }
 
+void Drawable::buildIndirectCommands(UploadPass& uploadPass) {
+    const auto instances = instanceAttributes ? instanceAttributes->getMaxCount() : 1;
+    if (impl->indirectCommands && impl->indirectInstances == instances) {
+        return;
+    }
+
+    // Several draws per call need the `multiDrawIndirect` feature, and all of them use the same pipeline
+    auto& context = static_cast<Context&>(uploadPass.getContext());
+    const auto& segments = impl->segments;
+    if (segments.size() < 2 || !context.getBackend().getDeviceFeatures().multiDrawIndirect ||
+        !std::ranges::all_of(segments,
+                             [&](const auto& seg) {
+                                 return seg->getSegment().indexLength && seg->getMode() == segments.front()->getMode();
+                             })) {
+        impl->indirectCommands.reset();
+        return;
+    }
+
+    std::vector<vk::DrawIndexedIndirectCommand> commands;
+    commands.reserve(segments.size());
+    for (const auto& seg : segments) {
+        const auto& segment = seg->getSegment();
+        commands.emplace_back(static_cast<uint32_t>(segment.indexLength),
+                              static_cast<uint32_t>(instances),
+                              static_cast<uint32_t>(segment.indexOffset),
+                              static_cast<int32_t>(segment.vertexOffset),
+                              0);
+    }
+
+    // A new buffer, the previous one may still be in use by the previous frame
+    impl->indirectCommands.emplace(context.createBuffer(commands.data(),
+                                                        commands.size() * sizeof(vk::DrawIndexedIndirectCommand),
+                                                        VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT,
+                                                        /*persistent=*/false));
+    impl->indirectInstances = instances;
+}
+
 void Drawable::draw(PaintParameters& parameters) const {
+    vk::Pipeline boundPipeline;
+    draw(parameters, boundPipeline);
+}
+
+void Drawable::draw(PaintParameters& parameters, vk::Pipeline& boundPipeline) const {
     MLN_TRACE_FUNC();
 
-    if (isCustom) {
+    if (!prepareDraw(parameters)) {
         return;
     }
 
     auto& context = static_cast<Context&>(parameters.context);
-    auto& dispatcher = context.getBackend().getDispatcher();
     auto& renderPass_ = static_cast<RenderPass&>(*parameters.renderPass);
-    auto& encoder = renderPass_.getEncoder();
-    auto& commandBuffer = encoder.getCommandBuffer();
+    encodeDraw(context, renderPass_.getEncoder().getCommandBuffer(), boundPipeline);
+}
 
-    auto& shaderImpl = static_cast<mbgl::vulkan::ShaderProgram&>(*shader);
+bool Drawable::prepareDraw(PaintParameters& parameters) const {
+    MLN_TRACE_FUNC();
 
-    if (!bindAttributes(encoder)) return;
-    if (!bindDescriptors(encoder)) return;
+    if (isCustom) {
+        return false;
+    }
 
-    commandBuffer->pushConstants(
-        context.getGeneralPipelineLayout().get(),
-        vk::ShaderStageFlags() | vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
-        0,
-        sizeof(uboIndex),
-        &uboIndex,
-        dispatcher);
+    auto& context = static_cast<Context&>(parameters.context);
+    auto& renderPass_ = static_cast<RenderPass&>(*parameters.renderPass);
+
+    if (impl->vulkanVertexBuffers.empty()) return false;
+    if (!prepareDescriptors(context)) return false;
+
+    auto& shaderImpl = static_cast<mbgl::vulkan::ShaderProgram&>(*shader);
 
     if (enableDepth) {
         if (impl->depthFor3D.has_value()) {
@@ -290,9 +337,69 @@ void Drawable::draw(PaintParameters& parameters) const {
 
     impl->pipelineInfo.setRenderable(renderPass_.getDescriptor().renderable);
 
-    const auto instances = instanceAttributes ? instanceAttributes->getMaxCount() : 1;
+    // pipelines are created on first use, so they're looked up here rather than while encoding
+    impl->preparedPipelines.clear();
+
+    if (impl->indirectCommands && impl->indirectCommands->isValid()) {
+        impl->pipelineInfo.setDrawMode(impl->segments.front()->getMode());
+        impl->preparedPipelines.push_back(shaderImpl.getPipeline(impl->pipelineInfo).get());
+
+        context.renderingStats().numDrawCalls++;
+        context.renderingStats().numIndirectDrawCalls++;
+        return true;
+    }
 
     for (const auto& seg : impl->segments) {
+        impl->pipelineInfo.setDrawMode(seg->getMode());
+        impl->preparedPipelines.push_back(shaderImpl.getPipeline(impl->pipelineInfo).get());
+    }
+
+    context.renderingStats().numDrawCalls += static_cast<int>(impl->segments.size());
+    return true;
+}
+
+void Drawable::encodeDraw(Context& context,
+                          const vk::UniqueCommandBuffer& commandBuffer,
+                          vk::Pipeline& boundPipeline) const {
+    MLN_TRACE_FUNC();
+
+    const auto& dispatcher = context.getBackend().getDispatcher();
+
+    bindAttributes(context, commandBuffer);
+    bindDescriptors(commandBuffer);
+
+    commandBuffer->pushConstants(
+        context.getGeneralPipelineLayout().get(),
+        vk::ShaderStageFlags() | vk::ShaderStageFlagBits::eVertex | vk::ShaderStageFlagBits::eFragment,
+        0,
+        sizeof(uboIndex),
+        &uboIndex,
+        dispatcher);
+
+    const auto bindPipeline = [&](const vk::Pipeline& pipeline) {
+        if (pipeline != boundPipeline) {
+            commandBuffer->bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline, dispatcher);
+            boundPipeline = pipeline;
+        }
+    };
+
+    if (impl->indirectCommands && impl->indirectCommands->isValid()) {
+        impl->pipelineInfo.setDrawMode(impl->segments.front()->getMode());
+        impl->pipelineInfo.setDynamicValues(context.getBackend(), commandBuffer);
+        bindPipeline(impl->preparedPipelines.front());
+
+        commandBuffer->drawIndexedIndirect(impl->indirectCommands->getVulkanBuffer(),
+                                           0,
+                                           static_cast<uint32_t>(impl->segments.size()),
+                                           sizeof(vk::DrawIndexedIndirectCommand),
+                                           dispatcher);
+        return;
+    }
+
+    const auto instances = instanceAttributes ? instanceAttributes->getMaxCount() : 1;
+
+    for (std::size_t i = 0; i < impl->segments.size(); ++i) {
+        const auto& seg = impl->segments[i];
         const auto& segment = seg->getSegment();
 
         // update pipeline info with per segment modifiers
@@ -300,8 +407,7 @@ void Drawable::draw(PaintParameters& parameters) const {
 
         impl->pipelineInfo.setDynamicValues(context.getBackend(), commandBuffer);
 
-        const auto& pipeline = shaderImpl.getPipeline(impl->pipelineInfo);
-        commandBuffer->bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline.get(), dispatcher);
+        bindPipeline(impl->preparedPipelines[i]);
 
         if (segment.indexLength) {
             commandBuffer->drawIndexed(static_cast<uint32_t>(segment.indexLength),
@@ -317,8 +423,6 @@ void Drawable::draw(PaintParameters& parameters) const {
                                 0,
                                 dispatcher);
         }
-
-        context.renderingStats().numDrawCalls++;
     }
 }
 
@@ -326,6 +430,7 @@ void Drawable::setIndexData(gfx::IndexVectorBasePtr indexes, std::vector<UniqueD
     assert(indexes && indexes->elements());
     impl->indexes = std::move(indexes);
     impl->segments = std::move(segments);
+    impl->indirectCommands.reset();
 }
 
 void Drawable::setVertices(std::vector<uint8_t>&& data, std::size_t count, gfx::AttributeDataType type_) {
@@ -410,13 +515,10 @@ void Drawable::buildVulkanInputBindings() noexcept {
     impl->pipelineInfo.updateVertexInputHash();
 }
 
-bool Drawable::bindAttributes(CommandEncoder& encoder) const noexcept {
+void Drawable::bindAttributes(Context& context, const vk::UniqueCommandBuffer& commandBuffer) const noexcept {
     MLN_TRACE_FUNC();
 
-    if (impl->vulkanVertexBuffers.empty()) return false;
-
-    const auto& dispatcher = encoder.getContext().getBackend().getDispatcher();
-    const auto& commandBuffer = encoder.getCommandBuffer();
+    const auto& dispatcher = context.getBackend().getDispatcher();
 
     commandBuffer->bindVertexBuffers(0, impl->vulkanVertexBuffers, impl->vulkanVertexOffsets, dispatcher);
 
@@ -427,23 +529,21 @@ bool Drawable::bindAttributes(CommandEncoder& encoder) const noexcept {
                 indexBufferResource.getVulkanBuffer(), 0, vk::IndexType::eUint16, dispatcher);
         }
     }
-
-    return true;
 }
 
-bool Drawable::bindDescriptors(CommandEncoder& encoder) const noexcept {
+bool Drawable::prepareDescriptors(Context& context) const noexcept {
     MLN_TRACE_FUNC();
 
     if (!shader) return false;
 
-    // bind uniforms
-    impl->uniformBuffers.bindDescriptorSets(encoder);
+    // update uniforms
+    impl->uniformBuffers.prepareDescriptorSets(context);
 
     const auto& shaderImpl = static_cast<const mbgl::vulkan::ShaderProgram&>(*shader);
     if (shaderImpl.hasTextures()) {
         // update image set
         if (!impl->imageDescriptorSet) {
-            impl->imageDescriptorSet = std::make_unique<ImageDescriptorSet>(encoder.getContext());
+            impl->imageDescriptorSet = std::make_unique<ImageDescriptorSet>(context);
         }
 
         for (const auto& texture : textures) {
@@ -456,12 +556,22 @@ bool Drawable::bindDescriptors(CommandEncoder& encoder) const noexcept {
         }
 
         impl->imageDescriptorSet->update(textures);
-        impl->imageDescriptorSet->bind(encoder);
     }
 
     return true;
 }
 
+void Drawable::bindDescriptors(const vk::UniqueCommandBuffer& commandBuffer) const noexcept {
+    MLN_TRACE_FUNC();
+
+    impl->uniformBuffers.bindDescriptorSets(commandBuffer);
+
+    const auto& shaderImpl = static_cast<const mbgl::vulkan::ShaderProgram&>(*shader);
+    if (shaderImpl.hasTextures()) {
+        impl->imageDescriptorSet->bind(commandBuffer);
+    }
+}
+
 void Drawable::uploadTextures(UploadPass&) const noexcept {
     MLN_TRACE_FUNC();
     for (const auto& texture : textures) {
@@ -4,6 +4,7 @@
 #include <mbgl/gfx/drawable_impl.hpp>
 #include <mbgl/gfx/index_buffer.hpp>
 #include <mbgl/gfx/uniform.hpp>
+#include <mbgl/vulkan/buffer_resource.hpp>
 #include <mbgl/vulkan/uniform_buffer.hpp>
 #include <mbgl/vulkan/render_pass.hpp>
 #include <mbgl/vulkan/upload_pass.hpp>
@@ -53,6 +54,13 @@ public:
     std::vector<vk::DeviceSize> vulkanVertexOffsets;
 
     std::unique_ptr<ImageDescriptorSet> imageDescriptorSet;
+
+    // The pipeline of each segment, or of the indirect draw, as of the last `prepareDraw`
+    std::vector<vk::Pipeline> preparedPipelines;
+
+    // `vk::DrawIndexedIndirectCommand` for each segment, when they can be drawn with one call
+    std::optional<BufferResource> indirectCommands;
+    std::size_t indirectInstances = 0;
 };
 
 } // namespace vulkan
@@ -3,7 +3,11 @@
 #include <mbgl/vulkan/command_encoder.hpp>
 #include <mbgl/vulkan/renderable_resource.hpp>
 #include <mbgl/vulkan/context.hpp>
+#include <mbgl/util/instrumentation.hpp>
 #include <mbgl/util/logging.hpp>
+#include <mbgl/util/thread_pool.hpp>
+
+#include <cassert>
 
 namespace mbgl {
 namespace vulkan {
@@ -30,10 +34,25 @@ RenderPass::RenderPass(CommandEncoder& commandEncoder_, const char* name, const
 
     pushDebugGroup(name);
 
-    commandEncoder.getCommandBuffer()->beginRenderPass(
-        renderPassBeginInfo, vk::SubpassContents::eInline, commandEncoder.getContext().getBackend().getDispatcher());
+    auto& context = commandEncoder.getContext();
+    useSecondaryCommandBuffers = context.getEncoderThreadCount() > 0;
+
+    commandEncoder.getCommandBuffer()->beginRenderPass(renderPassBeginInfo,
+                                                       useSecondaryCommandBuffers
+                                                           ? vk::SubpassContents::eSecondaryCommandBuffers
+                                                           : vk::SubpassContents::eInline,
+                                                       context.getBackend().getDispatcher());
+
+    if (useSecondaryCommandBuffers) {
+        inheritanceInfo.setRenderPass(resource.getRenderPass().get())
+            .setSubpass(0)
+            .setFramebuffer(resource.getFramebuffer().get());
+
+        // everything that isn't encoded in parallel goes to the render thread's secondary command buffers
+        commandEncoder.setCommandBuffer(beginSecondaryCommandBuffer(context.getEncoderThreadCount()));
+    }
 
-    commandEncoder.context.performCleanup();
+    context.performCleanup();
 }
 
 RenderPass::~RenderPass() {
@@ -43,7 +62,82 @@ RenderPass::~RenderPass() {
 }
 
 void RenderPass::endEncoding() {
-    commandEncoder.getCommandBuffer()->endRenderPass(commandEncoder.getContext().getBackend().getDispatcher());
+    const auto& dispatcher = commandEncoder.getContext().getBackend().getDispatcher();
+    const auto& primaryCommandBuffer = commandEncoder.getPrimaryCommandBuffer();
+
+    if (useSecondaryCommandBuffers) {
+        endSecondaryCommandBuffer(commandEncoder.getCommandBuffer());
+        commandEncoder.setCommandBuffer(primaryCommandBuffer);
+
+        primaryCommandBuffer->executeCommands(secondaryCommandBuffers, dispatcher);
+        secondaryCommandBuffers.clear();
+    }
+
+    primaryCommandBuffer->endRenderPass(dispatcher);
+}
+
+const vk::UniqueCommandBuffer& RenderPass::beginSecondaryCommandBuffer(std::size_t thread) {
+    auto& context = commandEncoder.getContext();
+    const auto& dispatcher = context.getBackend().getDispatcher();
+    const auto& buffer = context.acquireSecondaryCommandBuffer(thread);
+
+    const auto beginInfo = vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eRenderPassContinue |
+                                                      vk::CommandBufferUsageFlagBits::eOneTimeSubmit)
+                               .setPInheritanceInfo(&inheritanceInfo);
+    buffer->begin(beginInfo, dispatcher);
+
+    // bound descriptor sets aren't inherited from the primary command buffer
+    if (globalUniformBuffersBound) {
+        static_cast<const UniformBufferArray&>(context.getGlobalUniformBuffers()).bindDescriptorSets(buffer);
+    }
+
+    // labels pushed in earlier secondary command buffers are still open
+    commandEncoder.beginSecondaryDebugGroups(buffer);
+
+    secondaryCommandBuffers.push_back(buffer.get());
+    return buffer;
+}
+
+void RenderPass::endSecondaryCommandBuffer(const vk::UniqueCommandBuffer& buffer) const {
+    commandEncoder.endSecondaryDebugGroups(buffer);
+    buffer->end(commandEncoder.getContext().getBackend().getDispatcher());
+}
+
+bool RenderPass::encodeParallel(
+    std::size_t taskCount, const std::function<void(std::size_t task, const vk::UniqueCommandBuffer&)>& encode) {
+    MLN_TRACE_FUNC();
+
+    if (!useSecondaryCommandBuffers || taskCount == 0) {
+        return false;
+    }
+
+    auto& context = commandEncoder.getContext();
+    assert(taskCount <= context.getEncoderThreadCount());
+
+    endSecondaryCommandBuffer(commandEncoder.getCommandBuffer());
+
+    // Buffers are taken from the pools on this thread, and each pool is only recorded into by one task
+    std::vector<const vk::UniqueCommandBuffer*> buffers(taskCount);
+    for (std::size_t task = 0; task < taskCount; ++task) {
+        buffers[task] = &beginSecondaryCommandBuffer(task);
+    }
+
+    auto& scheduler = context.getEncoderScheduler();
+    for (std::size_t task = 1; task < taskCount; ++task) {
+        scheduler.schedule([&, task] {
+            encode(task, *buffers[task]);
+            endSecondaryCommandBuffer(*buffers[task]);
+        });
+    }
+
+    // the render thread takes the first task instead of waiting idle
+    encode(0, *buffers[0]);
+    endSecondaryCommandBuffer(*buffers[0]);
+
+    scheduler.waitForEmpty();
+
+    commandEncoder.setCommandBuffer(beginSecondaryCommandBuffer(context.getEncoderThreadCount()));
+    return true;
 }
 
 void RenderPass::clearStencil(uint32_t value) const {
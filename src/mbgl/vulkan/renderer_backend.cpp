@@ -582,6 +582,14 @@ void RendererBackend::initDevice() {
         mbgl::Log::Error(mbgl::Event::Render, "Feature not available: samplerAnisotropy");
     }
 
+    // Optional, raster tiles fall back to uncompressed textures
+    physicalDeviceFeatures.setTextureCompressionETC2(supportedDeviceFeatures.textureCompressionETC2);
+    physicalDeviceFeatures.setTextureCompressionBC(supportedDeviceFeatures.textureCompressionBC);
+    physicalDeviceFeatures.setTextureCompressionASTC_LDR(supportedDeviceFeatures.textureCompressionASTC_LDR);
+
+    // Optional, drawables with several segments fall back to one draw call per segment
+    physicalDeviceFeatures.setMultiDrawIndirect(supportedDeviceFeatures.multiDrawIndirect);
+
     auto createInfo = vk::DeviceCreateInfo()
                           .setQueueCreateInfos(queueCreateInfos)
                           .setPEnabledExtensionNames(extensions)
@@ -82,6 +82,11 @@ gfx::Texture2D& Texture2D::setImage(std::shared_ptr<PremultipliedImage> image_)
     return *this;
 }
 
+gfx::Texture2D& Texture2D::setCompressedImage(std::shared_ptr<CompressedImage> image_) noexcept {
+    compressedImageData = std::move(image_);
+    return *this;
+}
+
 gfx::Texture2D& Texture2D::setUsage(Texture2DUsage value) noexcept {
     textureUsage = value;
     textureDirty = true;
@@ -89,6 +94,9 @@ gfx::Texture2D& Texture2D::setUsage(Texture2DUsage value) noexcept {
 }
 
 size_t Texture2D::getDataSize() const noexcept {
+    if (isCompressed(pixelFormat)) {
+        return compressedDataSize(pixelFormat, size);
+    }
     return Texture2D::getPixelStride() * size.width * size.height;
 }
 
@@ -127,6 +135,12 @@ void Texture2D::create() noexcept {
 }
 
 void Texture2D::upload() noexcept {
+    if (compressedImageData) {
+        setFormat(compressedImageData->format, gfx::TextureChannelDataType::UnsignedByte);
+        upload(compressedImageData->data.get(), compressedImageData->size);
+        compressedImageData.reset();
+    }
+
     if (!imageData) return;
 
     upload(imageData->data.get(), imageData->size);
@@ -162,8 +176,11 @@ void Texture2D::uploadSubRegion(const void* pixelData,
     const auto& backend = context.getBackend();
     const auto& allocator = backend.getAllocator();
 
+    const bool compressed = isCompressed(pixelFormat);
+    const auto dataSize = compressed ? compressedDataSize(pixelFormat, size_)
+                                     : static_cast<vk::DeviceSize>(size_.width) * size_.height * getPixelStride();
     const auto bufferInfo = vk::BufferCreateInfo()
-                                .setSize(static_cast<vk::DeviceSize>(size_.width) * size_.height * getPixelStride())
+                                .setSize(dataSize)
                                 .setUsage(vk::BufferUsageFlagBits::eTransferSrc)
                                 .setSharingMode(vk::SharingMode::eExclusive);
 
@@ -187,7 +204,8 @@ void Texture2D::uploadSubRegion(const void* pixelData,
 
         const auto region = vk::BufferImageCopy()
                                 .setBufferOffset(0)
-                                .setBufferRowLength(size_.width)
+                                // Compressed rows are tightly packed blocks
+                                .setBufferRowLength(compressed ? 0 : size_.width)
                                 .setImageSubresource(
                                     vk::ImageSubresourceLayers(vk::ImageAspectFlagBits::eColor, 0, 0, 1))
                                 .setImageOffset(vk::Offset3D(xOffset, yOffset))
@@ -196,7 +214,7 @@ void Texture2D::uploadSubRegion(const void* pixelData,
         buffer->copyBufferToImage(
             bufferAllocation->buffer, imageAllocation->image, imageLayout, region, backend.getDispatcher());
 
-        if (samplerState.mipmapped && textureUsage == Texture2DUsage::ShaderInput) {
+        if (samplerState.mipmapped && textureUsage == Texture2DUsage::ShaderInput && !compressed) {
             generateMips(buffer);
         } else {
             transitionToShaderReadLayout(buffer);
@@ -228,6 +246,10 @@ vk::Format Texture2D::vulkanFormat(const gfx::TexturePixelType pixel, gfx::Textu
         }
     }
 
+    if (pixel == gfx::TexturePixelType::ETC2) return vk::Format::eEtc2R8G8B8UnormBlock;
+    if (pixel == gfx::TexturePixelType::BC1) return vk::Format::eBc1RgbaUnormBlock;
+    if (pixel == gfx::TexturePixelType::ASTC) return vk::Format::eAstc4x4UnormBlock;
+
     if (pixel == gfx::TexturePixelType::RGBA) {
         switch (channel) {
             case gfx::TextureChannelDataType::UnsignedByte:
@@ -366,6 +388,7 @@ void Texture2D::createTexture() {
 
     textureDirty = false;
     lastModified = util::MonotonicTimer::now();
+    resourceID = context.nextResourceID();
 }
 
 void Texture2D::createSampler() {
@@ -398,6 +421,7 @@ void Texture2D::createSampler() {
 
     samplerStateDirty = false;
     lastModified = util::MonotonicTimer::now();
+    resourceID = context.nextResourceID();
 }
 
 void Texture2D::destroyTexture() {
@@ -628,7 +652,8 @@ std::shared_ptr<PremultipliedImage> Texture2D::readImage() {
 }
 
 uint32_t Texture2D::getMipLevels() const {
-    if (samplerState.mipmapped && size.width > 0 && size.height > 0) {
+    // Compressed formats can't be blitted to generate mips
+    if (samplerState.mipmapped && !isCompressed(pixelFormat) && size.width > 0 && size.height > 0) {
         return static_cast<uint32_t>(std::floor(std::log2(std::max(size.width, size.height))) + 1);
     }
 
@@ -12,9 +12,14 @@
 #include <mbgl/util/convert.hpp>
 #include <mbgl/util/logging.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 namespace vulkan {
 
+// Below this, handing the drawables to the encoder threads costs more than recording them
+constexpr std::size_t minDrawablesPerEncoderTask = 128;
+
 TileLayerGroup::TileLayerGroup(int32_t layerIndex_, std::size_t initialCapacity, std::string name_)
     : mbgl::TileLayerGroup(layerIndex_, initialCapacity, std::move(name_)),
       uniformBuffers(DescriptorSetType::Layer,
@@ -86,33 +91,89 @@ void TileLayerGroup::render(RenderOrchestrator&, PaintParameters& parameters) {
         parameters.renderTileClippingMasks(stencilTiles);
     }
 
-    bool bindUBOs = false;
+    // Tweakers may change the textures or state that the drawables are batched by
     visitDrawables([&](gfx::Drawable& drawable) {
-        if (!drawable.getEnabled() || !drawable.hasRenderPass(parameters.pass)) {
-            return;
+        if (drawable.getEnabled() && drawable.hasRenderPass(parameters.pass)) {
+            for (const auto& tweaker : drawable.getTweakers()) {
+                tweaker->execute(drawable, parameters);
+            }
         }
+    });
 
-        if (!bindUBOs) {
-            uniformBuffers.bindDescriptorSets(encoder);
-            bindUBOs = true;
-        }
+    const auto& batches = batchDrawables(parameters.pass);
+    const auto& drawables = getBatchedDrawables();
 
-        for (const auto& tweaker : drawable.getTweakers()) {
-            tweaker->execute(drawable, parameters);
-        }
+    if (encodeParallel(parameters, depthMode3d, stencilMode3d)) {
+        parameters.context.renderingStats().numDrawableBatches += static_cast<int>(batches.size());
+        return;
+    }
 
-        if (features3d) {
-            auto& drawableImpl = static_cast<Drawable&>(drawable);
+    bool bindUBOs = false;
+    for (const auto& batch : batches) {
+        vk::Pipeline boundPipeline;
+        for (auto i = batch.begin; i < batch.end; ++i) {
+            auto& drawable = static_cast<Drawable&>(*drawables[i]);
+
+            if (!bindUBOs) {
+                uniformBuffers.bindDescriptorSets(encoder);
+                bindUBOs = true;
+            }
 
-            const auto& depth = drawableImpl.getEnableDepth() ? depthMode3d.value() : gfx::DepthMode::disabled();
-            drawableImpl.setDepthModeFor3D(depth);
+            if (features3d) {
+                const auto& depth = drawable.getEnableDepth() ? depthMode3d.value() : gfx::DepthMode::disabled();
+                drawable.setDepthModeFor3D(depth);
 
-            const auto& stencil = drawableImpl.getEnableStencil() ? stencilMode3d.value()
+                const auto& stencil = drawable.getEnableStencil() ? stencilMode3d.value()
                                                                   : gfx::StencilMode::disabled();
-            drawableImpl.setStencilModeFor3D(stencil);
+                drawable.setStencilModeFor3D(stencil);
+            }
+
+            drawable.draw(parameters, boundPipeline);
+        }
+        parameters.context.renderingStats().numDrawableBatches++;
+    }
+}
+
+bool TileLayerGroup::encodeParallel(PaintParameters& parameters,
+                                    const std::optional<gfx::DepthMode>& depthMode3d,
+                                    const std::optional<gfx::StencilMode>& stencilMode3d) {
+    auto& context = static_cast<Context&>(parameters.context);
+    auto& renderPass = static_cast<RenderPass&>(*parameters.renderPass);
+    const auto& drawables = getBatchedDrawables();
+
+    const auto taskCount = std::min(context.getEncoderThreadCount(), drawables.size() / minDrawablesPerEncoderTask);
+    if (taskCount < 2) {
+        return false;
+    }
+
+    // Descriptor set updates, pipeline creation and stats aren't thread safe, so they're done up front
+    preparedDrawables.assign(drawables.size(), false);
+    for (std::size_t i = 0; i < drawables.size(); ++i) {
+        auto& drawable = static_cast<Drawable&>(*drawables[i]);
+
+        if (depthMode3d) {
+            drawable.setDepthModeFor3D(drawable.getEnableDepth() ? *depthMode3d : gfx::DepthMode::disabled());
+            drawable.setStencilModeFor3D(drawable.getEnableStencil() && stencilMode3d ? *stencilMode3d
+                                                                                      : gfx::StencilMode::disabled());
         }
 
-        drawable.draw(parameters);
+        preparedDrawables[i] = drawable.prepareDraw(parameters);
+    }
+
+    uniformBuffers.prepareDescriptorSets(context);
+
+    // Each task takes a contiguous range of the batched drawables, so the order they're drawn in doesn't change
+    return renderPass.encodeParallel(taskCount, [&](std::size_t task, const vk::UniqueCommandBuffer& commandBuffer) {
+        uniformBuffers.bindDescriptorSets(commandBuffer);
+
+        vk::Pipeline boundPipeline;
+        const auto begin = drawables.size() * task / taskCount;
+        const auto end = drawables.size() * (task + 1) / taskCount;
+        for (auto i = begin; i < end; ++i) {
+            if (preparedDrawables[i]) {
+                static_cast<const Drawable&>(*drawables[i]).encodeDraw(context, commandBuffer, boundPipeline);
+            }
+        }
     });
 }
 
@@ -74,14 +74,19 @@ void UniformBufferArray::bind(gfx::RenderPass& renderPass) {
 }
 
 void UniformBufferArray::bindDescriptorSets(CommandEncoder& encoder) {
+    prepareDescriptorSets(encoder.getContext());
+    bindDescriptorSets(encoder.getCommandBuffer());
+}
+
+void UniformBufferArray::prepareDescriptorSets(Context& context) {
     if (!descriptorSet) {
-        descriptorSet = std::make_unique<UniformDescriptorSet>(encoder.getContext(), descriptorSetType);
+        descriptorSet = std::make_unique<UniformDescriptorSet>(context, descriptorSetType);
     }
 
     descriptorSet->update(*this, descriptorStartIndex, descriptorStorageCount, descriptorUniformCount);
 
-    const auto frameCount = encoder.getContext().getBackend().getMaxFrames();
-    const int32_t currentIndex = encoder.getContext().getCurrentFrameResourceIndex();
+    const auto frameCount = context.getBackend().getMaxFrames();
+    const int32_t currentIndex = context.getCurrentFrameResourceIndex();
     const int32_t prevIndex = currentIndex == 0 ? frameCount - 1 : currentIndex - 1;
 
     for (uint32_t i = 0; i < descriptorStorageCount + descriptorUniformCount; ++i) {
@@ -94,8 +99,11 @@ void UniformBufferArray::bindDescriptorSets(CommandEncoder& encoder) {
         auto& buff = static_cast<UniformBuffer*>(uniformBufferVector[index].get())->mutableBufferResource();
         buff.updateVulkanBuffer(currentIndex, prevIndex);
     }
+}
 
-    descriptorSet->bind(encoder);
+void UniformBufferArray::bindDescriptorSets(const vk::UniqueCommandBuffer& commandBuffer) const {
+    assert(descriptorSet);
+    descriptorSet->bind(commandBuffer);
 }
 
 } // namespace vulkan
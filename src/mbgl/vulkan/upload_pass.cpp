@@ -34,8 +34,11 @@ std::unique_ptr<gfx::VertexBufferResource> UploadPass::createVertexBufferResourc
         commandEncoder.context.createBuffer(data, size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, persistent));
 }
 
-void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource, const void* data, std::size_t size) {
-    static_cast<VertexBufferResource&>(resource).get().update(data, size, /*offset=*/0);
+void UploadPass::updateVertexBufferResource(gfx::VertexBufferResource& resource,
+                                            const void* data,
+                                            std::size_t size,
+                                            std::size_t offset) {
+    static_cast<VertexBufferResource&>(resource).get().update(data, size, offset);
 }
 
 std::unique_ptr<gfx::IndexBufferResource> UploadPass::createIndexBufferResource(const void* data,
@@ -83,6 +86,7 @@ const gfx::UniqueVertexBufferResource& UploadPass::getBuffer(const gfx::VertexVe
             auto buffer = std::make_unique<VertexBuffer>();
             buffer->resource = createVertexBufferResource(rawBufPtr, rawBufSize, usage, /*persistent=*/false);
             vec->setBuffer(std::move(buffer));
+            vec->resetModifiedRanges();
 
             auto* rawData = static_cast<VertexBuffer*>(vec->getBuffer());
             auto& resource = static_cast<VertexBufferResource&>(*rawData->resource);
@@ -135,3 +135,33 @@ TEST(DEMData, BackfillNeighbor) {
     // backfulls BottomLeft neighbor
     EXPECT_TRUE(dem0.get(4, -1) == dem1.get(0, 3));
 };
+
+TEST(DEMData, Elevations) {
+    for (const auto encoding : {Tileset::DEMEncoding::Mapbox, Tileset::DEMEncoding::Terrarium}) {
+        PremultipliedImage image = fakeImage({5, 5});
+        DEMData demdata(image, encoding);
+
+        const auto elevations = demdata.getElevations();
+        ASSERT_EQ(size_t(7 * 7), elevations.size());
+        for (int y = -1; y < 6; y++) {
+            for (int x = -1; x < 6; x++) {
+                EXPECT_EQ(demdata.get(x, y), static_cast<int32_t>(elevations[(y + 1) * 7 + (x + 1)]));
+            }
+        }
+    }
+}
+
+TEST(DEMData, DecodeElevations) {
+    // Not a multiple of the vector width, to cover the remainder
+    PremultipliedImage image = fakeImage({13, 13});
+    const auto count = image.bytes() / 4;
+    DEMData demdata(image, Tileset::DEMEncoding::Mapbox);
+
+    std::vector<float> vectorized(count);
+    std::vector<float> scalar(count);
+    DEMData::decodeElevations(image.data.get(), count, demdata.getUnpackVector(), vectorized.data());
+    DEMData::decodeElevationsScalar(image.data.get(), count, demdata.getUnpackVector(), scalar.data());
+    for (size_t i = 0; i < count; i++) {
+        EXPECT_FLOAT_EQ(scalar[i], vectorized[i]);
+    }
+}
@@ -0,0 +1,89 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/geometry/heatmap_density.hpp>
+#include <mbgl/util/mat4.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace mbgl;
+
+namespace {
+
+constexpr float gaussCoef = 0.3989422804014327f;
+
+// What the heatmap shader renders at a distance from a point, in tile units
+float kernel(const HeatmapPoint& point, float intensity, float extrudeScale, float dx, float dy) {
+    const float scale = point.radius * extrudeScale;
+    return point.weight * intensity * gaussCoef * std::exp(-4.5f * (dx * dx + dy * dy) / (scale * scale));
+}
+
+} // namespace
+
+TEST(HeatmapDensity, SinglePoint) {
+    const HeatmapPoint point{100.0f, 200.0f, 1.0f, 10.0f};
+    const auto density = accumulateHeatmapDensity({point}, 1.0f, 2.0f, 4.0f);
+    ASSERT_FALSE(density.empty());
+    EXPECT_EQ(4.0f, density.cellSize);
+    EXPECT_EQ(0.0f, std::fmod(density.originX, density.cellSize));
+
+    // Cell centers are 2 units away from the point along both axes
+    EXPECT_NEAR(kernel(point, 1.0f, 2.0f, 2.0f, 2.0f), density.sample(102.0f, 202.0f), 1e-6f);
+    EXPECT_NEAR(kernel(point, 1.0f, 2.0f, 10.0f, -6.0f), density.sample(110.0f, 194.0f), 1e-6f);
+    EXPECT_NEAR(density.sample(102.0f, 202.0f), density.sample(98.0f, 198.0f), 1e-6f);
+
+    // The kernel is cut off where it falls below what the shader considers zero
+    EXPECT_EQ(0.0f, density.sample(100.0f, 250.0f));
+    EXPECT_EQ(0.0f, density.sample(0.0f, 0.0f));
+}
+
+TEST(HeatmapDensity, Accumulates) {
+    const std::vector<HeatmapPoint> points{{64.0f, 64.0f, 1.0f, 8.0f}, {80.0f, 64.0f, 0.5f, 8.0f}};
+    const auto density = accumulateHeatmapDensity(points, 2.0f, 1.0f, 2.0f);
+    for (const float x : {63.0f, 71.0f, 79.0f}) {
+        EXPECT_NEAR(kernel(points[0], 2.0f, 1.0f, x - 64.0f, 1.0f) + kernel(points[1], 2.0f, 1.0f, x - 80.0f, 1.0f),
+                    density.sample(x, 65.0f),
+                    1e-5f);
+    }
+}
+
+TEST(HeatmapDensity, SkipsInvisiblePoints) {
+    EXPECT_TRUE(accumulateHeatmapDensity({}, 1.0f, 1.0f, 1.0f).empty());
+    EXPECT_TRUE(accumulateHeatmapDensity({{0.0f, 0.0f, 0.0f, 10.0f}}, 1.0f, 1.0f, 1.0f).empty());
+    EXPECT_TRUE(accumulateHeatmapDensity({{0.0f, 0.0f, 1.0f, 0.0f}}, 1.0f, 1.0f, 1.0f).empty());
+}
+
+TEST(HeatmapDensity, MaxCells) {
+    const auto density = accumulateHeatmapDensity({{0.0f, 0.0f, 1.0f, 1000.0f}}, 1.0f, 1.0f, 1.0f, 64);
+    EXPECT_LE(density.size.width, 64u);
+    EXPECT_LE(density.size.height, 64u);
+    EXPECT_GT(density.cellSize, 1.0f);
+    EXPECT_NEAR(gaussCoef, density.sample(0.0f, 0.0f), 0.01f);
+}
+
+TEST(HeatmapDensity, Composite) {
+    const HeatmapPoint point{48.0f, 16.0f, 1.0f, 4.0f};
+    const auto density = accumulateHeatmapDensity({point}, 1.0f, 1.0f, 1.0f);
+
+    // Tile units map to pixels one to one, with y pointing down
+    const Size size{64, 32};
+    mat4 matrix;
+    matrix::ortho(matrix, 0, size.width, size.height, 0, -1, 1);
+
+    std::vector<float> viewport(size.area(), 0.0f);
+    compositeHeatmapDensity(density, matrix, size, viewport);
+    EXPECT_NEAR(density.sample(47.5f, 15.5f), viewport[15 * size.width + 47], 1e-5f);
+    EXPECT_NEAR(density.sample(40.5f, 20.5f), viewport[20 * size.width + 40], 1e-5f);
+    EXPECT_EQ(0.0f, viewport[0]);
+
+    // Adds to what is there
+    compositeHeatmapDensity(density, matrix, size, viewport);
+    EXPECT_NEAR(2.0f * density.sample(47.5f, 15.5f), viewport[15 * size.width + 47], 1e-5f);
+
+    const auto topDown = packHeatmapDensity(viewport, size, false);
+    const auto bottomUp = packHeatmapDensity(viewport, size, true);
+    const auto expected = static_cast<uint8_t>(std::min(viewport[15 * size.width + 47], 1.0f) * 255.0f + 0.5f);
+    EXPECT_EQ(expected, topDown.data[(15 * size.width + 47) * 4]);
+    EXPECT_EQ(expected, bottomUp.data[(16 * size.width + 47) * 4]);
+    EXPECT_EQ(255, topDown.data[3]);
+}
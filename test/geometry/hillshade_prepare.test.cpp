@@ -0,0 +1,73 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/geometry/dem_data.hpp>
+#include <mbgl/geometry/hillshade_prepare.hpp>
+
+#include <cstring>
+
+using namespace mbgl;
+
+namespace {
+
+// Terrarium encoded tile whose elevation is `slope` meters per pixel along x, plus `offset`
+PremultipliedImage slopedImage(uint32_t dim, int32_t slope, int32_t offset) {
+    PremultipliedImage image({dim, dim});
+    for (uint32_t y = 0; y < dim; y++) {
+        for (uint32_t x = 0; x < dim; x++) {
+            const auto value = static_cast<uint32_t>(32768 + offset + slope * static_cast<int32_t>(x));
+            uint8_t* pixel = image.data.get() + (y * dim + x) * 4;
+            pixel[0] = static_cast<uint8_t>(value >> 8);
+            pixel[1] = static_cast<uint8_t>(value);
+            pixel[2] = 0;
+            pixel[3] = 255;
+        }
+    }
+    return image;
+}
+
+} // namespace
+
+TEST(HillshadePrepare, Flat) {
+    DEMData dem(slopedImage(8, 0, 100), Tileset::DEMEncoding::Terrarium);
+    const auto prepared = prepareHillshade(dem, {10, 15});
+
+    ASSERT_EQ(Size(8, 8), prepared.size);
+    for (size_t i = 0; i < prepared.bytes(); i += 4) {
+        EXPECT_EQ(128, prepared.data[i]);
+        EXPECT_EQ(128, prepared.data[i + 1]);
+        EXPECT_EQ(255, prepared.data[i + 2]);
+        EXPECT_EQ(255, prepared.data[i + 3]);
+    }
+}
+
+TEST(HillshadePrepare, Slope) {
+    DEMData dem(slopedImage(8, 1, 0), Tileset::DEMEncoding::Terrarium);
+    const auto prepared = prepareHillshade(dem, {14, 14});
+
+    // Rising towards +x, flat along y. The duplicated border flattens the edge columns.
+    for (uint32_t y = 0; y < 8; y++) {
+        for (uint32_t x = 1; x < 7; x++) {
+            const uint8_t* pixel = prepared.data.get() + (y * 8 + x) * 4;
+            EXPECT_GT(pixel[0], 128);
+            EXPECT_EQ(128, pixel[1]);
+        }
+        EXPECT_LT(prepared.data[(y * 8) * 4], prepared.data[(y * 8 + 1) * 4]);
+    }
+
+    // Exaggerated below the maximum zoom level of the source
+    const auto exaggerated = prepareHillshade(dem, {14, 18});
+    EXPECT_GT(exaggerated.data[(3 * 8 + 3) * 4], prepared.data[(3 * 8 + 3) * 4]);
+}
+
+TEST(HillshadePrepare, UpdateBorder) {
+    DEMData dem(slopedImage(8, 50, 0), Tileset::DEMEncoding::Terrarium);
+    auto prepared = prepareHillshade(dem, {12, 14});
+
+    // The tile to the left continues the slope
+    const DEMData left(slopedImage(8, 50, -400), Tileset::DEMEncoding::Terrarium);
+    dem.backfillBorder(left, -1, 0);
+    updateHillshadeBorder(dem, {12, 14}, prepared);
+
+    const auto expected = prepareHillshade(dem, {12, 14});
+    EXPECT_EQ(0, std::memcmp(expected.data.get(), prepared.data.get(), expected.bytes()));
+}
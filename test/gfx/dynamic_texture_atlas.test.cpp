@@ -0,0 +1,172 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/context.hpp>
+#include <mbgl/gfx/dynamic_texture_atlas.hpp>
+#include <mbgl/gfx/headless_backend.hpp>
+#include <mbgl/gfx/renderer_backend.hpp>
+
+#include <memory>
+
+using namespace mbgl;
+
+namespace {
+
+GlyphMap makeGlyph(uint32_t id, uint32_t size) {
+    auto glyph = makeMutable<Glyph>();
+    glyph->id = id;
+    glyph->bitmap = AlphaImage({size, size});
+    glyph->metrics.width = size;
+    glyph->metrics.height = size;
+
+    GlyphMap glyphs;
+    glyphs[0].emplace(GlyphID(id), Immutable<Glyph>(std::move(glyph)));
+    return glyphs;
+}
+
+ImageMap makeIcon(const std::string& id, uint32_t size) {
+    ImageMap icons;
+    icons.emplace(id, makeMutable<style::Image::Impl>(id, PremultipliedImage({size, size}), 1.0f));
+    return icons;
+}
+
+class DynamicTextureAtlasTest {
+public:
+    DynamicTextureAtlasTest()
+        : backend(gfx::HeadlessBackend::Create()),
+          scope(*backend->getRendererBackend()),
+          atlas(backend->getRendererBackend()->getContext()) {}
+
+    std::unique_ptr<gfx::HeadlessBackend> backend;
+    gfx::BackendScope scope;
+    gfx::DynamicTextureAtlas atlas;
+};
+
+// Area of the bin reserved for an image, which is padded on each side
+constexpr std::size_t binArea(uint32_t size) {
+    return static_cast<std::size_t>(size + 4) * (size + 4);
+}
+
+} // namespace
+
+TEST(DynamicTextureAtlas, CountsUsedArea) {
+    DynamicTextureAtlasTest test;
+
+    const auto first = test.atlas.uploadGlyphs(makeGlyph(1, 10));
+    const auto texture = first.dynamicTexture;
+    ASSERT_TRUE(texture);
+    const auto area = static_cast<float>(texture->getTexture()->getSize().area());
+    EXPECT_FLOAT_EQ(binArea(10) / area, texture->getOccupancy());
+
+    // The same glyph shares its bin, and is only counted once
+    const auto second = test.atlas.uploadGlyphs(makeGlyph(1, 10));
+    EXPECT_EQ(texture, second.dynamicTexture);
+    EXPECT_FLOAT_EQ(binArea(10) / area, texture->getOccupancy());
+
+    const auto other = test.atlas.uploadGlyphs(makeGlyph(2, 20));
+    EXPECT_EQ(texture, other.dynamicTexture);
+    EXPECT_FLOAT_EQ((binArea(10) + binArea(20)) / area, texture->getOccupancy());
+
+    auto usage = test.atlas.getUsage();
+    EXPECT_EQ(1u, usage.numTextures);
+    EXPECT_EQ(texture->getMemorySize(), usage.textureBytes);
+    EXPECT_NEAR(binArea(10) + binArea(20), usage.usedBytes, 1);
+
+    // Removing a bin that is still shared keeps it
+    test.atlas.removeTextures(first.textureHandles, first.dynamicTexture);
+    EXPECT_FLOAT_EQ((binArea(10) + binArea(20)) / area, texture->getOccupancy());
+    test.atlas.removeTextures(second.textureHandles, second.dynamicTexture);
+    EXPECT_FLOAT_EQ(binArea(20) / area, texture->getOccupancy());
+    test.atlas.removeTextures(other.textureHandles, other.dynamicTexture);
+    EXPECT_FLOAT_EQ(0.0f, texture->getOccupancy());
+    EXPECT_EQ(0u, test.atlas.getUsage().numTextures);
+}
+
+TEST(DynamicTextureAtlas, KeepsNewestTexture) {
+    DynamicTextureAtlasTest test;
+    test.atlas.setMemoryBudget(1);
+
+    // The only texture of its format keeps taking glyphs, however far over the budget
+    const auto first = test.atlas.uploadGlyphs(makeGlyph(1, 10));
+    const auto second = test.atlas.uploadGlyphs(makeGlyph(2, 10));
+    EXPECT_EQ(first.dynamicTexture, second.dynamicTexture);
+    EXPECT_FALSE(first.dynamicTexture->isRetired());
+
+    // Also under memory pressure
+    test.atlas.reduceMemoryUse();
+    EXPECT_FALSE(first.dynamicTexture->isRetired());
+    EXPECT_EQ(0u, test.atlas.getUsage().numRetiredTextures);
+}
+
+TEST(DynamicTextureAtlas, RetiresSparseGlyphTextures) {
+    DynamicTextureAtlasTest test;
+
+    // Fill a texture with a small and a large glyph, then spill over into a second one
+    const auto small = test.atlas.uploadGlyphs(makeGlyph(1, 10));
+    const auto large = test.atlas.uploadGlyphs(makeGlyph(2, 480));
+    const auto spilled = test.atlas.uploadGlyphs(makeGlyph(3, 100));
+    const auto sparse = small.dynamicTexture;
+    ASSERT_EQ(sparse, large.dynamicTexture);
+    ASSERT_NE(sparse, spilled.dynamicTexture);
+    EXPECT_EQ(2u, test.atlas.getUsage().numTextures);
+
+    // Without a budget nothing is retired
+    test.atlas.removeTextures(large.textureHandles, large.dynamicTexture);
+    const auto unlimited = test.atlas.uploadGlyphs(makeGlyph(4, 10));
+    EXPECT_FALSE(sparse->isRetired());
+    EXPECT_EQ(sparse, unlimited.dynamicTexture);
+    test.atlas.removeTextures(unlimited.textureHandles, unlimited.dynamicTexture);
+
+    // Over the budget the sparse texture is retired, and new glyphs go to the newest one
+    test.atlas.setMemoryBudget(1);
+    const auto next = test.atlas.uploadGlyphs(makeGlyph(5, 10));
+    EXPECT_TRUE(sparse->isRetired());
+    EXPECT_FALSE(spilled.dynamicTexture->isRetired());
+    EXPECT_EQ(spilled.dynamicTexture, next.dynamicTexture);
+
+    // A glyph that is already in the retired texture isn't added to it again either
+    const auto again = test.atlas.uploadGlyphs(makeGlyph(1, 10));
+    EXPECT_EQ(spilled.dynamicTexture, again.dynamicTexture);
+
+    auto usage = test.atlas.getUsage();
+    EXPECT_EQ(2u, usage.numTextures);
+    EXPECT_EQ(1u, usage.numRetiredTextures);
+
+    // The retired texture is released with its last image
+    test.atlas.removeTextures(small.textureHandles, small.dynamicTexture);
+    usage = test.atlas.getUsage();
+    EXPECT_EQ(1u, usage.numTextures);
+    EXPECT_EQ(0u, usage.numRetiredTextures);
+}
+
+TEST(DynamicTextureAtlas, ReduceMemoryUseIgnoresBudget) {
+    DynamicTextureAtlasTest test;
+    test.atlas.setMemoryBudget(1024 * 1024 * 1024);
+
+    const ImageMap noPatterns;
+    const ImageVersionMap versions;
+    const auto small = test.atlas.uploadIconsAndPatterns(makeIcon("small", 10), noPatterns, versions);
+    const auto large = test.atlas.uploadIconsAndPatterns(makeIcon("large", 480), noPatterns, versions);
+    const auto spilled = test.atlas.uploadIconsAndPatterns(makeIcon("spilled", 100), noPatterns, versions);
+    const auto sparse = small.dynamicTexture;
+    ASSERT_EQ(sparse, large.dynamicTexture);
+    ASSERT_NE(sparse, spilled.dynamicTexture);
+    test.atlas.removeTextures(large.textureHandles, large.dynamicTexture);
+
+    // Well within the budget
+    const auto within = test.atlas.uploadIconsAndPatterns(makeIcon("within", 10), noPatterns, versions);
+    EXPECT_FALSE(sparse->isRetired());
+    test.atlas.removeTextures(within.textureHandles, within.dynamicTexture);
+
+    test.atlas.reduceMemoryUse();
+    EXPECT_TRUE(sparse->isRetired());
+    EXPECT_FALSE(spilled.dynamicTexture->isRetired());
+    EXPECT_EQ(1024u * 1024 * 1024, test.atlas.getMemoryBudget());
+
+    // Retired textures take no new icons
+    const auto next = test.atlas.uploadIconsAndPatterns(makeIcon("next", 10), noPatterns, versions);
+    EXPECT_EQ(spilled.dynamicTexture, next.dynamicTexture);
+
+    test.atlas.removeTextures(small.textureHandles, small.dynamicTexture);
+    EXPECT_EQ(1u, test.atlas.getUsage().numTextures);
+}
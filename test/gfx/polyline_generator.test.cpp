@@ -0,0 +1,412 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/polyline_generator.hpp>
+#include <mbgl/renderer/buckets/line_bucket.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/math.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+using namespace mbgl;
+using namespace std::numbers;
+
+namespace {
+
+// Everything that is passed to the layout vertex function
+struct Vertex {
+    Point<int16_t> p;
+    Point<double> e;
+    bool round;
+    bool up;
+    int8_t dir;
+    int32_t linesofar;
+
+    bool operator==(const Vertex& other) const {
+        return std::tie(p, e, round, up, dir, linesofar) ==
+               std::tie(other.p, other.e, other.round, other.up, other.dir, other.linesofar);
+    }
+};
+
+struct Triangle {
+    uint16_t a, b, c;
+
+    bool operator==(const Triangle& other) const {
+        return std::tie(a, b, c) == std::tie(other.a, other.b, other.c);
+    }
+};
+
+struct Polyline {
+    std::vector<Vertex> vertices;
+    std::vector<Triangle> triangles;
+};
+
+// The generator as it was before segment normals and lengths were computed in a separate pass, computing them
+// for each vertex with `util::perp(util::unit(...))` and `util::dist`. Clip distances aren't supported.
+class ReferenceGenerator {
+public:
+    Polyline generate(const GeometryCoordinates& coordinates, const gfx::PolylineGeneratorOptions& options) {
+        const float COS_HALF_SHARP_CORNER = std::cos(75.0f / 2.0f * (pi_v<float> / 180.0f));
+        constexpr float SHARP_CORNER_OFFSET = 15.0f;
+        constexpr float DEG_PER_TRIANGLE = 20.0f;
+
+        std::size_t len = coordinates.size();
+        while (len >= 2 && coordinates[len - 1] == coordinates[len - 2]) {
+            len--;
+        }
+        std::size_t first = 0;
+        while (first + 1 < len && coordinates[first] == coordinates[first + 1]) {
+            first++;
+        }
+        if (len < ((options.type == FeatureType::Polygon) ? 3u : 2u)) {
+            return {};
+        }
+
+        const style::LineJoinType joinType = options.joinType;
+        const float miterLimit = joinType == style::LineJoinType::Bevel ? 1.05f : options.miterLimit;
+        const uint32_t overscaling = options.overscaling;
+        const double sharpCornerOffset =
+            overscaling == 0
+                ? SHARP_CORNER_OFFSET * (util::EXTENT / util::tileSize_D)
+                : (overscaling <= 16.0 ? SHARP_CORNER_OFFSET * (util::EXTENT / (util::tileSize_D * overscaling))
+                                       : 0.0);
+
+        const GeometryCoordinate firstCoordinate = coordinates[first];
+        const style::LineCapType beginCap = options.beginCap;
+        const style::LineCapType endCap = options.type == FeatureType::Polygon ? style::LineCapType::Butt
+                                                                               : options.endCap;
+
+        double distance = 0.0;
+        bool startOfLine = true;
+        std::optional<GeometryCoordinate> currentCoordinate;
+        std::optional<GeometryCoordinate> prevCoordinate;
+        std::optional<GeometryCoordinate> nextCoordinate;
+        std::optional<Point<double>> prevNormal;
+        std::optional<Point<double>> nextNormal;
+
+        e1 = e2 = e3 = -1;
+        result = {};
+
+        if (options.type == FeatureType::Polygon) {
+            currentCoordinate = coordinates[len - 2];
+            nextNormal = util::perp(util::unit(convertPoint<double>(firstCoordinate - *currentCoordinate)));
+        }
+
+        for (std::size_t i = first; i < len; ++i) {
+            if (options.type == FeatureType::Polygon && i == len - 1) {
+                nextCoordinate = coordinates[first + 1];
+            } else if (i + 1 < len) {
+                nextCoordinate = coordinates[i + 1];
+            } else {
+                nextCoordinate = {};
+            }
+
+            if (nextCoordinate && coordinates[i] == *nextCoordinate) {
+                continue;
+            }
+
+            if (nextNormal) {
+                prevNormal = *nextNormal;
+            }
+            if (currentCoordinate) {
+                prevCoordinate = *currentCoordinate;
+            }
+
+            currentCoordinate = coordinates[i];
+
+            nextNormal = nextCoordinate
+                             ? util::perp(util::unit(convertPoint<double>(*nextCoordinate - *currentCoordinate)))
+                             : prevNormal;
+
+            if (!prevNormal) {
+                prevNormal = *nextNormal;
+            }
+
+            Point<double> joinNormal = *prevNormal + *nextNormal;
+            if (joinNormal.x != 0 || joinNormal.y != 0) {
+                joinNormal = util::unit(joinNormal);
+            }
+
+            const double cosAngle = prevNormal->x * nextNormal->x + prevNormal->y * nextNormal->y;
+            const double cosHalfAngle = joinNormal.x * nextNormal->x + joinNormal.y * nextNormal->y;
+            const double miterLength = cosHalfAngle != 0 ? 1 / cosHalfAngle : std::numeric_limits<double>::infinity();
+            const double approxAngle = 2 * std::sqrt(2 - 2 * cosHalfAngle);
+            const bool isSharpCorner = cosHalfAngle < COS_HALF_SHARP_CORNER && prevCoordinate && nextCoordinate;
+
+            if (isSharpCorner && i > first) {
+                const auto prevSegmentLength = util::dist<double>(*currentCoordinate, *prevCoordinate);
+                if (prevSegmentLength > 2.0 * sharpCornerOffset) {
+                    GeometryCoordinate newPrevVertex = *currentCoordinate -
+                                                       convertPoint<int16_t>(util::round(
+                                                           convertPoint<double>(*currentCoordinate - *prevCoordinate) *
+                                                           (sharpCornerOffset / prevSegmentLength)));
+                    distance += util::dist<double>(newPrevVertex, *prevCoordinate);
+                    addCurrentVertex(newPrevVertex, distance, *prevNormal, 0, 0, false);
+                    prevCoordinate = newPrevVertex;
+                }
+            }
+
+            const bool middleVertex = prevCoordinate && nextCoordinate;
+            style::LineJoinType currentJoin = joinType;
+            const style::LineCapType currentCap = nextCoordinate ? beginCap : endCap;
+
+            if (middleVertex) {
+                if (currentJoin == style::LineJoinType::Round) {
+                    if (miterLength < options.roundLimit) {
+                        currentJoin = style::LineJoinType::Miter;
+                    } else if (miterLength <= 2) {
+                        currentJoin = style::LineJoinType::FakeRound;
+                    }
+                }
+                if (currentJoin == style::LineJoinType::Miter && miterLength > miterLimit) {
+                    currentJoin = style::LineJoinType::Bevel;
+                }
+                if (currentJoin == style::LineJoinType::Bevel) {
+                    if (miterLength > 2) {
+                        currentJoin = style::LineJoinType::FlipBevel;
+                    }
+                    if (miterLength < miterLimit) {
+                        currentJoin = style::LineJoinType::Miter;
+                    }
+                }
+            }
+
+            if (prevCoordinate) distance += util::dist<double>(*currentCoordinate, *prevCoordinate);
+
+            if (middleVertex && currentJoin == style::LineJoinType::Miter) {
+                joinNormal = joinNormal * miterLength;
+                addCurrentVertex(*currentCoordinate, distance, joinNormal, 0, 0, false);
+            } else if (middleVertex && currentJoin == style::LineJoinType::FlipBevel) {
+                if (miterLength > 100) {
+                    joinNormal = *nextNormal * -1.0;
+                } else {
+                    const double direction = prevNormal->x * nextNormal->y - prevNormal->y * nextNormal->x > 0 ? -1
+                                                                                                              : 1;
+                    const double bevelLength = miterLength * util::mag(*prevNormal + *nextNormal) /
+                                               util::mag(*prevNormal - *nextNormal);
+                    joinNormal = util::perp(joinNormal) * bevelLength * direction;
+                }
+                addCurrentVertex(*currentCoordinate, distance, joinNormal, 0, 0, false);
+                addCurrentVertex(*currentCoordinate, distance, joinNormal * -1.0, 0, 0, false);
+            } else if (middleVertex &&
+                       (currentJoin == style::LineJoinType::Bevel || currentJoin == style::LineJoinType::FakeRound)) {
+                const bool lineTurnsLeft = (prevNormal->x * nextNormal->y - prevNormal->y * nextNormal->x) > 0;
+                const auto offset = static_cast<float>(-std::sqrt(miterLength * miterLength - 1));
+                const float offsetA = lineTurnsLeft ? offset : 0;
+                const float offsetB = lineTurnsLeft ? 0 : offset;
+
+                if (!startOfLine) {
+                    addCurrentVertex(*currentCoordinate, distance, *prevNormal, offsetA, offsetB, false);
+                }
+
+                if (currentJoin == style::LineJoinType::FakeRound) {
+                    const auto n = static_cast<unsigned>(::round((approxAngle * 180 / pi) / DEG_PER_TRIANGLE));
+                    for (unsigned m = 1; m < n; ++m) {
+                        double t = static_cast<double>(m) / n;
+                        if (t != 0.5) {
+                            const double t2 = t - 0.5;
+                            const double A = 1.0904 + cosAngle * (-3.2452 + cosAngle * (3.55645 - cosAngle * 1.43519));
+                            const double B = 0.848013 + cosAngle * (-1.06021 + cosAngle * 0.215638);
+                            t = t + t * t2 * (t - 1) * (A * t2 * t2 + B);
+                        }
+                        addPieSliceVertex(*currentCoordinate,
+                                          distance,
+                                          util::unit(*prevNormal * (1.0 - t) + *nextNormal * t),
+                                          lineTurnsLeft);
+                    }
+                }
+
+                if (nextCoordinate) {
+                    addCurrentVertex(*currentCoordinate, distance, *nextNormal, -offsetA, -offsetB, false);
+                }
+            } else if (!middleVertex && currentCap == style::LineCapType::Butt) {
+                if (!startOfLine) {
+                    addCurrentVertex(*currentCoordinate, distance, *prevNormal, 0, 0, false);
+                }
+                if (nextCoordinate) {
+                    addCurrentVertex(*currentCoordinate, distance, *nextNormal, 0, 0, false);
+                }
+            } else if (!middleVertex && currentCap == style::LineCapType::Square) {
+                if (!startOfLine) {
+                    addCurrentVertex(*currentCoordinate, distance, *prevNormal, 1, 1, false);
+                    e1 = e2 = -1;
+                }
+                if (nextCoordinate) {
+                    addCurrentVertex(*currentCoordinate, distance, *nextNormal, -1, -1, false);
+                }
+            } else if (middleVertex ? currentJoin == style::LineJoinType::Round
+                                    : currentCap == style::LineCapType::Round) {
+                if (!startOfLine) {
+                    addCurrentVertex(*currentCoordinate, distance, *prevNormal, 0, 0, false);
+                    addCurrentVertex(*currentCoordinate, distance, *prevNormal, 1, 1, true);
+                    e1 = e2 = -1;
+                }
+                if (nextCoordinate) {
+                    addCurrentVertex(*currentCoordinate, distance, *nextNormal, -1, -1, true);
+                    addCurrentVertex(*currentCoordinate, distance, *nextNormal, 0, 0, false);
+                }
+            }
+
+            if (isSharpCorner && i < len - 1) {
+                const auto nextSegmentLength = util::dist<double>(*currentCoordinate, *nextCoordinate);
+                if (nextSegmentLength > 2 * sharpCornerOffset) {
+                    GeometryCoordinate newCurrentVertex = *currentCoordinate +
+                                                          convertPoint<int16_t>(util::round(
+                                                              convertPoint<double>(*nextCoordinate -
+                                                                                   *currentCoordinate) *
+                                                              (sharpCornerOffset / nextSegmentLength)));
+                    distance += util::dist<double>(newCurrentVertex, *currentCoordinate);
+                    addCurrentVertex(newCurrentVertex, distance, *nextNormal, 0, 0, false);
+                    currentCoordinate = newCurrentVertex;
+                }
+            }
+
+            startOfLine = false;
+        }
+
+        return std::move(result);
+    }
+
+private:
+    static constexpr float LINE_DISTANCE_SCALE = 1.0 / 2.0;
+    static constexpr auto MAX_LINE_DISTANCE = static_cast<float>((1u << 14) / LINE_DISTANCE_SCALE);
+
+    void addVertex(Vertex vertex) {
+        result.vertices.push_back(vertex);
+        e3 = static_cast<std::ptrdiff_t>(result.vertices.size()) - 1;
+        if (e1 >= 0 && e2 >= 0) {
+            result.triangles.push_back(
+                {static_cast<uint16_t>(e1), static_cast<uint16_t>(e2), static_cast<uint16_t>(e3)});
+        }
+    }
+
+    void addCurrentVertex(const GeometryCoordinate& currentCoordinate,
+                          double& distance,
+                          const Point<double>& normal,
+                          double endLeft,
+                          double endRight,
+                          bool round) {
+        const auto linesofar = static_cast<int32_t>(distance * LINE_DISTANCE_SCALE);
+
+        Point<double> extrude = normal;
+        if (endLeft) extrude = extrude - (util::perp(normal) * endLeft);
+        addVertex({currentCoordinate, extrude, round, false, static_cast<int8_t>(endLeft), linesofar});
+        e1 = e2;
+        e2 = e3;
+
+        extrude = normal * -1.0;
+        if (endRight) extrude = extrude - (util::perp(normal) * endRight);
+        addVertex({currentCoordinate, extrude, round, true, static_cast<int8_t>(-endRight), linesofar});
+        e1 = e2;
+        e2 = e3;
+
+        if (distance > MAX_LINE_DISTANCE / 2.0f) {
+            distance = 0.0;
+            addCurrentVertex(currentCoordinate, distance, normal, endLeft, endRight, round);
+        }
+    }
+
+    void addPieSliceVertex(const GeometryCoordinate& currentVertex,
+                           double distance,
+                           const Point<double>& extrude,
+                           bool lineTurnsLeft) {
+        addVertex({currentVertex,
+                   extrude * (lineTurnsLeft ? -1.0 : 1.0),
+                   false,
+                   lineTurnsLeft,
+                   0,
+                   static_cast<int32_t>(distance * LINE_DISTANCE_SCALE)});
+        if (lineTurnsLeft) {
+            e2 = e3;
+        } else {
+            e1 = e3;
+        }
+    }
+
+    std::ptrdiff_t e1 = -1;
+    std::ptrdiff_t e2 = -1;
+    std::ptrdiff_t e3 = -1;
+    Polyline result;
+};
+
+Polyline generate(const GeometryCoordinates& coordinates, const gfx::PolylineGeneratorOptions& options) {
+    Polyline result;
+    LineBucket::VertexVector vertices;
+    LineBucket::TriangleIndexVector indexes;
+    SegmentVector segments;
+    gfx::PolylineGenerator<LineLayoutVertex, SegmentBase> generator(
+        vertices,
+        [&](Point<int16_t> p, Point<double> e, bool round, bool up, int8_t dir, int32_t linesofar) {
+            result.vertices.push_back({p, e, round, up, dir, linesofar});
+            return LineBucket::layoutVertex(p, e, round, up, dir, linesofar);
+        },
+        segments,
+        [](std::size_t vertexOffset, std::size_t indexOffset) -> SegmentBase {
+            return SegmentBase(vertexOffset, indexOffset);
+        },
+        [](auto& seg) -> SegmentBase& { return seg; },
+        indexes);
+    generator.generate(coordinates, options);
+
+    for (std::size_t i = 0; i < indexes.elements(); i += 3) {
+        result.triangles.push_back({indexes.at(i), indexes.at(i + 1), indexes.at(i + 2)});
+    }
+    return result;
+}
+
+// Sharp and shallow corners, a U-turn, a repeated coordinate and segments long enough for extra vertices at
+// sharp corners
+const GeometryCoordinates line{{0, 0},
+                               {1000, 0},
+                               {1000, 800},
+                               {200, 900},
+                               {200, 900},
+                               {1800, 1000},
+                               {1700, 2500},
+                               {1710, 2540},
+                               {1700, 1500},
+                               {3000, 1520},
+                               {3200, 4000}};
+
+const GeometryCoordinates ring{{0, 0}, {2000, 0}, {2000, 300}, {300, 600}, {2000, 2000}, {0, 2000}, {0, 0}};
+
+// A line longer than the distance that fits in a vertex, which restarts the distance
+const GeometryCoordinates longLine{{-8000, 0}, {8000, 0}, {8000, 8000}, {-8000, 8000}, {-8000, 16000}};
+
+} // namespace
+
+TEST(PolylineGenerator, MatchesPerVertexComputation) {
+    struct Case {
+        style::LineJoinType join;
+        style::LineCapType cap;
+    };
+    const std::vector<Case> cases = {
+        {style::LineJoinType::Miter, style::LineCapType::Butt},
+        {style::LineJoinType::Bevel, style::LineCapType::Butt},
+        {style::LineJoinType::Round, style::LineCapType::Round},
+        {style::LineJoinType::FakeRound, style::LineCapType::Butt},
+        {style::LineJoinType::Miter, style::LineCapType::Square},
+    };
+
+    for (const auto& [join, cap] : cases) {
+        for (const auto type : {FeatureType::LineString, FeatureType::Polygon}) {
+            for (const auto& coordinates : {line, ring, longLine}) {
+                gfx::PolylineGeneratorOptions options;
+                options.type = type;
+                options.joinType = join;
+                options.beginCap = cap;
+                options.endCap = cap;
+
+                const auto expected = ReferenceGenerator().generate(coordinates, options);
+                const auto actual = generate(coordinates, options);
+
+                ASSERT_FALSE(expected.vertices.empty());
+                EXPECT_TRUE(expected.vertices == actual.vertices);
+                EXPECT_TRUE(expected.triangles == actual.triangles);
+            }
+        }
+    }
+}
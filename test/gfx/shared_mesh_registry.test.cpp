@@ -0,0 +1,73 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/attribute.hpp>
+#include <mbgl/gfx/index_vector.hpp>
+#include <mbgl/gfx/shared_mesh_registry.hpp>
+#include <mbgl/gfx/vertex_vector.hpp>
+
+#include <memory>
+
+using namespace mbgl;
+
+namespace {
+
+using Vertex = gfx::detail::VertexType<gfx::AttributeType<int16_t, 2>>;
+using VertexVector = gfx::VertexVector<Vertex>;
+
+std::shared_ptr<VertexVector> quad(int16_t size) {
+    auto vertices = std::make_shared<VertexVector>();
+    vertices->emplace_back(Vertex{{{0, 0}}});
+    vertices->emplace_back(Vertex{{{size, 0}}});
+    vertices->emplace_back(Vertex{{{0, size}}});
+    vertices->emplace_back(Vertex{{{size, size}}});
+    return vertices;
+}
+
+} // namespace
+
+TEST(SharedMeshRegistry, SharesIdenticalVertices) {
+    gfx::SharedMeshRegistry registry;
+
+    const auto first = registry.share(quad(8192));
+    const auto second = registry.share(quad(8192));
+    const auto other = registry.share(quad(4096));
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(2u, registry.size());
+}
+
+TEST(SharedMeshRegistry, SharesIdenticalIndexes) {
+    gfx::SharedMeshRegistry registry;
+
+    const auto first = registry.share(std::make_shared<gfx::IndexVectorBase>(std::vector<uint16_t>{0, 1, 2, 1, 2, 3}));
+    const auto second = registry.share(std::make_shared<gfx::IndexVectorBase>(std::vector<uint16_t>{0, 1, 2, 1, 2, 3}));
+    const auto other = registry.share(std::make_shared<gfx::IndexVectorBase>(std::vector<uint16_t>{0, 1, 2}));
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(2u, registry.size());
+}
+
+TEST(SharedMeshRegistry, ReleasesUnusedMeshes) {
+    gfx::SharedMeshRegistry registry;
+
+    auto first = registry.share(quad(8192));
+    EXPECT_EQ(1u, registry.size());
+
+    first.reset();
+    EXPECT_EQ(0u, registry.size());
+
+    // A new mesh with the same contents is registered again rather than resurrecting the old one
+    const auto second = registry.share(quad(8192));
+    EXPECT_TRUE(second);
+    EXPECT_EQ(1u, registry.size());
+}
+
+TEST(SharedMeshRegistry, IgnoresEmptyMeshes) {
+    gfx::SharedMeshRegistry registry;
+
+    const auto empty = std::make_shared<VertexVector>();
+    EXPECT_EQ(empty, registry.share(empty));
+    EXPECT_EQ(0u, registry.size());
+}
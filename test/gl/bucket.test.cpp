@@ -4,15 +4,22 @@
 #include <mbgl/test/stub_geometry_tile_feature.hpp>
 
 #include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/vector_pool.hpp>
 #include <mbgl/renderer/buckets/circle_bucket.hpp>
 #include <mbgl/renderer/buckets/fill_bucket.hpp>
+#include <mbgl/renderer/buckets/fill_extrusion_bucket.hpp>
 #include <mbgl/renderer/buckets/line_bucket.hpp>
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer_impl.hpp>
+#include <mbgl/style/layers/fill_extrusion_layer_properties.hpp>
 #include <mbgl/style/layers/symbol_layer_properties.hpp>
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/headless_backend.hpp>
+#include <mbgl/gl/upload_pass.hpp>
+#include <mbgl/gl/vertex_buffer_resource.hpp>
 
 #include <mbgl/map/mode.hpp>
 
@@ -194,6 +201,131 @@ TEST(Buckets, SymbolBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 }
 
+TEST(Buckets, PartialVertexBufferUpdate) {
+    gl::HeadlessBackend backend({512, 256});
+    gfx::BackendScope scope{backend};
+
+    gl::Context context{backend};
+    auto vertices = std::make_shared<FillBucket::VertexVector>();
+    for (int16_t i = 0; i < 100; ++i) {
+        vertices->emplace_back(FillLayoutVertex{{{i, i}}});
+    }
+    ASSERT_TRUE(vertices->isFullyModified());
+
+    auto commandEncoder = context.createCommandEncoder();
+    auto uploadPass = commandEncoder->createUploadPass("upload", backend.getDefaultRenderable());
+    auto& glUploadPass = static_cast<gl::UploadPass&>(*uploadPass);
+    const auto& buffer = glUploadPass.getBuffer(vertices, gfx::BufferUsageType::StaticDraw);
+    ASSERT_TRUE(buffer);
+    ASSERT_FALSE(vertices->isFullyModified());
+
+    // Two features change state
+    vertices->fill(10, 20, FillLayoutVertex{{{0, 0}}});
+    vertices->at(50) = FillLayoutVertex{{{0, 0}}};
+    vertices->at(51) = FillLayoutVertex{{{0, 0}}};
+    vertices->updateModified();
+    EXPECT_EQ((gfx::VertexVectorBase::ModifiedRanges{{10, 20}, {50, 52}}), vertices->getModifiedRanges());
+
+    // Only those ranges are uploaded
+    static_cast<gl::VertexBufferResource&>(*buffer).setLastUpdated({});
+    const auto before = context.renderingStats();
+    glUploadPass.getBuffer(vertices, gfx::BufferUsageType::StaticDraw);
+    const auto& after = context.renderingStats();
+    EXPECT_EQ(before.vertexPartialUpdates + 2, after.vertexPartialUpdates);
+    EXPECT_EQ(before.vertexPartialUpdateBytes + 12 * sizeof(FillLayoutVertex), after.vertexPartialUpdateBytes);
+    EXPECT_TRUE(vertices->getModifiedRanges().empty());
+
+    // Growing the vector requires a full upload again
+    vertices->emplace_back(FillLayoutVertex{{{0, 0}}});
+    EXPECT_TRUE(vertices->isFullyModified());
+}
+
+TEST(Buckets, PooledVertexStorage) {
+    struct Vertex {
+        std::array<float, 4> data;
+    };
+    using Pool = gfx::VectorPool<Vertex>;
+    constexpr std::size_t count = 1024;
+    const auto before = gfx::getVectorPoolStats();
+
+    {
+        gfx::VertexVector<Vertex> vertices;
+        vertices.reserve(count);
+        vertices.extend(count, Vertex{});
+    }
+    // Storage of the destroyed vector is kept for the next bucket
+    EXPECT_EQ(1u, Pool::get().size());
+
+    gfx::VertexVector<Vertex> vertices;
+    vertices.reserve(count / 2);
+    EXPECT_EQ(0u, Pool::get().size());
+    EXPECT_LE(count, vertices.vector().capacity());
+
+    const auto after = gfx::getVectorPoolStats();
+    EXPECT_EQ(before.acquired + 2, after.acquired);
+    EXPECT_EQ(before.reused + 1, after.reused);
+    EXPECT_EQ(before.returned + 1, after.returned);
+
+    // Small vectors aren't worth pooling
+    {
+        gfx::VertexVector<Vertex> small;
+        small.emplace_back(Vertex{});
+    }
+    EXPECT_EQ(0u, Pool::get().size());
+}
+
+TEST(Buckets, ClearVectorPools) {
+    struct Vertex {
+        std::array<float, 4> data;
+    };
+    using Pool = gfx::VectorPool<Vertex>;
+    constexpr std::size_t count = 1024;
+
+    {
+        gfx::VertexVector<Vertex> vertices;
+        vertices.reserve(count);
+    }
+    ASSERT_EQ(1u, Pool::get().size());
+    const auto before = gfx::getVectorPoolStats();
+
+    gfx::clearVectorPools();
+    EXPECT_EQ(0u, Pool::get().size());
+    EXPECT_EQ(before.retainedBytes - count * sizeof(Vertex), gfx::getVectorPoolStats().retainedBytes);
+}
+
+TEST(Buckets, FillExtrusionBucketSharedWalls) {
+    style::FillExtrusionLayer layer("extrusion", "source");
+    const std::map<std::string, Immutable<style::LayerProperties>> layerProperties{
+        {"extrusion",
+         makeMutable<style::FillExtrusionLayerProperties>(
+             staticImmutableCast<style::FillExtrusionLayer::Impl>(layer.baseImpl))}};
+
+    // Two buildings sharing the edge x = 10
+    GeometryCollection left{{{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}}};
+    GeometryCollection right{{{10, 0}, {20, 0}, {20, 10}, {10, 10}, {10, 0}}};
+    StubGeometryTileFeature leftFeature{{}, FeatureType::Polygon, left, properties};
+    StubGeometryTileFeature rightFeature{{}, FeatureType::Polygon, right, properties};
+    const PatternLayerMap patterns;
+
+    // Five roof vertices and four walls of four vertices each
+    FillExtrusionBucket serial{{}, layerProperties, 16.0f, 1};
+    serial.addFeature(leftFeature, left, {}, patterns, 0, CanonicalTileID(0, 0, 0));
+    serial.addFeature(rightFeature, right, {}, patterns, 1, CanonicalTileID(0, 0, 0));
+    EXPECT_EQ(42u, serial.vertices.elements());
+
+    // Laid out together, the two walls along the shared edge are dropped
+    FillExtrusionBucket batch{{}, layerProperties, 16.0f, 1};
+    batch.addFeatures({{leftFeature, left, patterns, 0}, {rightFeature, right, patterns, 1}},
+                      {},
+                      CanonicalTileID(0, 0, 0),
+                      TaggedScheduler{Scheduler::GetBackground(), {}});
+    EXPECT_EQ(34u, batch.vertices.elements());
+    EXPECT_EQ(serial.triangles.elements() - 12, batch.triangles.elements());
+    ASSERT_EQ(1u, batch.triangleSegments.size());
+    EXPECT_EQ(34u, batch.triangleSegments[0].vertexLength);
+    EXPECT_EQ(batch.triangles.elements(), batch.triangleSegments[0].indexLength);
+}
+
 TEST(Buckets, RasterBucket) {
     gl::HeadlessBackend backend({512, 256});
     gfx::BackendScope scope{backend};
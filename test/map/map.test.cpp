@@ -8,10 +8,16 @@
 #include <mbgl/test/map_adapter.hpp>
 
 #include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/context.hpp>
 #include <mbgl/gfx/headless_frontend.hpp>
+#include <mbgl/gfx/renderer_backend.hpp>
 #include <mbgl/gfx/shader_registry.hpp>
+#include <mbgl/gfx/vector_pool.hpp>
+#include <mbgl/gfx/vertex_vector.hpp>
 #include <mbgl/map/map_options.hpp>
 #include <mbgl/math/log2.hpp>
+#include <mbgl/renderer/render_layer.hpp>
+#include <mbgl/renderer/render_orchestrator.hpp>
 #include <mbgl/renderer/renderer.hpp>
 #include <mbgl/renderer/update_parameters.hpp>
 #include <mbgl/storage/file_source_manager.hpp>
@@ -25,12 +31,14 @@
 #include <mbgl/style/layers/background_layer.hpp>
 #include <mbgl/style/layers/background_layer.hpp>
 #include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/fill_layer_properties.hpp>
 #include <mbgl/style/layers/line_layer.hpp>
 #include <mbgl/style/layers/raster_layer.hpp>
 #include <mbgl/style/layers/symbol_layer.hpp>
 #include <mbgl/style/sources/custom_geometry_source.hpp>
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/style/sources/image_source.hpp>
+#include <mbgl/style/sources/raster_source.hpp>
 #include <mbgl/style/sources/vector_source.hpp>
 #include <mbgl/style/style_impl.hpp>
 #include <mbgl/style/style.hpp>
@@ -38,11 +46,14 @@
 #include <mbgl/util/client_options.hpp>
 #include <mbgl/util/color.hpp>
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_pool.hpp>
 #include <mbgl/util/io.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/util/run_loop.hpp>
 
+#include <array>
 #include <atomic>
+#include <cstdlib>
 
 using namespace mbgl;
 using namespace mbgl::style;
@@ -751,6 +762,66 @@ TEST(Map, RemoveLayer) {
     test::checkImage("test/fixtures/map/remove_layer", test.frontend.render(test.map).image);
 }
 
+TEST(Map, AddLayerOutsideZoomRange) {
+    class CapturingHeadlessFrontend : public HeadlessFrontend {
+    public:
+        using HeadlessFrontend::HeadlessFrontend;
+        void update(std::shared_ptr<UpdateParameters> params) override {
+            lastParameters = params;
+            HeadlessFrontend::update(std::move(params));
+        }
+        std::shared_ptr<UpdateParameters> lastParameters;
+    };
+    MapTest<StubFileSource, CapturingHeadlessFrontend> test{1, MapMode::Continuous};
+
+    // A renderer of our own, to look at the render layers it holds
+    TaggedScheduler threadPool{Scheduler::GetBackground(), {}};
+    RenderOrchestrator orchestrator(false, threadPool, std::nullopt);
+    const RenderOrchestrator& renderer = orchestrator;
+    const auto renderAtZoom = [&](double zoom) {
+        test.map.jumpTo(CameraOptions().withZoom(zoom));
+        ASSERT_TRUE(test.frontend.lastParameters);
+        orchestrator.createRenderTree(test.frontend.lastParameters, nullptr, {});
+    };
+
+    test.map.getStyle().loadJSON(R"STYLE({
+        "version": 8,
+        "sources": {
+            "geojson": {
+                "type": "geojson",
+                "data": { "type": "Polygon", "coordinates": [[[0, 0], [10, 0], [10, 10], [0, 0]]] }
+            }
+        },
+        "layers": []
+    })STYLE");
+    renderAtZoom(0.0);
+
+    auto layer = std::make_unique<FillLayer>("fill", "geojson");
+    layer->setFillColor(PropertyExpression<Color>(expression::dsl::toColor(expression::dsl::get("color"))));
+    layer->setMinZoom(10.0f);
+    test.map.getStyle().addLayer(std::move(layer));
+
+    // Far outside of its zoom range, and still more than one zoom level away, the layer isn't evaluated
+    renderAtZoom(0.0);
+    EXPECT_EQ(nullptr, renderer.getRenderLayer("fill"));
+    renderAtZoom(8.5);
+    EXPECT_EQ(nullptr, renderer.getRenderLayer("fill"));
+    EXPECT_NE(nullptr, test.map.getStyle().getLayer("fill"));
+
+    // Approaching the zoom range creates and evaluates it ahead of time
+    renderAtZoom(9.5);
+    const RenderLayer* renderLayer = renderer.getRenderLayer("fill");
+    ASSERT_NE(nullptr, renderLayer);
+    const auto& evaluated = static_cast<const FillLayerProperties&>(*renderLayer->evaluatedProperties).evaluated;
+    EXPECT_FALSE(evaluated.get<FillColor>().isConstant());
+    EXPECT_NE(nullptr, test.map.getStyle().getLayer("fill"));
+
+    // Once created, it is kept when the camera moves away again
+    renderAtZoom(0.0);
+    EXPECT_EQ(renderLayer, renderer.getRenderLayer("fill"));
+    EXPECT_NE(nullptr, test.map.getStyle().getLayer("fill"));
+}
+
 TEST(Map, DisabledSources) {
     MapTest<> test;
 
@@ -1613,6 +1684,236 @@ TEST(Map, ObserveShaderRegistration) {
     EXPECT_EQ(observedRegistry, false);
 }
 
+TEST(Map, SkipUnchangedFrames) {
+    MapTest<> test{1, MapMode::Continuous};
+    test.frontend.getRenderer()->setSkipUnchangedFrames(true);
+
+    std::size_t drawnFrames = 0;
+    bool settled = false;
+    test.observer.didFinishRenderingFrameCallback = [&](MapObserver::RenderFrameStatus status) {
+        drawnFrames++;
+        settled = status.mode == MapObserver::RenderMode::Full && !status.needsRepaint && !status.placementChanged;
+    };
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    for (int i = 0; i < 100 && !settled; ++i) {
+        test.runLoop.runOnce();
+        test.frontend.renderFrame();
+    }
+    ASSERT_TRUE(settled);
+
+    // Nothing changed since the last frame
+    drawnFrames = 0;
+    test.frontend.renderFrame();
+    test.frontend.renderFrame();
+    EXPECT_EQ(0u, drawnFrames);
+
+    // A change to the map comes with a new update
+    test.map.jumpTo(CameraOptions().withZoom(2));
+    test.runLoop.runOnce();
+    test.frontend.renderFrame();
+    EXPECT_LT(0u, drawnFrames);
+
+    drawnFrames = 0;
+    test.frontend.getRenderer()->setSkipUnchangedFrames(false);
+    test.frontend.renderFrame();
+    EXPECT_EQ(1u, drawnFrames);
+}
+
+TEST(Map, RasterPreviewIsRefined) {
+    const auto style = R"STYLE({
+        "version": 8,
+        "sources": {
+            "raster": { "type": "raster", "tiles": [ "asset://tile.jpeg" ], "tileSize": 256 }
+        },
+        "layers": [{ "id": "raster", "type": "raster", "source": "raster", "paint": { "raster-fade-duration": 0 } }]
+    })STYLE";
+    const auto tileResponse = [](const Resource& res) -> std::optional<Response> {
+        if (res.url == "asset://tile.jpeg") {
+            Response response;
+            response.data = std::make_shared<std::string>(util::read_file("test/fixtures/image/tile.jpeg"));
+            return {std::move(response)};
+        }
+        return {};
+    };
+
+    // Still images are rendered from the full resolution image only
+    PremultipliedImage expected;
+    {
+        MapTest<> test;
+        test.fileSource->response = tileResponse;
+        test.map.getStyle().loadJSON(style);
+        expected = test.frontend.render(test.map).image;
+    }
+
+    // A continuously rendered map may draw the preview first, and has to end up drawing the full image as well
+    MapTest<> test{1, MapMode::Continuous};
+    test.fileSource->response = tileResponse;
+    bool settled = false;
+    test.observer.didFinishRenderingFrameCallback = [&](MapObserver::RenderFrameStatus status) {
+        settled = status.mode == MapObserver::RenderMode::Full && !status.needsRepaint && !status.placementChanged;
+    };
+    test.map.getStyle().loadJSON(style);
+    for (int i = 0; i < 1000 && !settled; ++i) {
+        test.runLoop.runOnce();
+        test.frontend.renderFrame();
+    }
+    ASSERT_TRUE(settled);
+
+    const auto actual = test.frontend.readStillImage();
+    ASSERT_EQ(expected.size, actual.size);
+    std::size_t differentPixels = 0;
+    for (std::size_t i = 0; i < actual.bytes(); i += 4) {
+        for (std::size_t channel = 0; channel < 4; ++channel) {
+            if (std::abs(actual.data[i + channel] - expected.data[i + channel]) > 2) {
+                differentPixels++;
+                break;
+            }
+        }
+    }
+    EXPECT_EQ(0u, differentPixels);
+}
+
+TEST(Map, RasterTextureCompression) {
+    const auto render = [](Tileset::TextureCompression compression) {
+        MapTest<> test;
+        test.fileSource->response = [](const Resource& res) -> std::optional<Response> {
+            if (res.url == "asset://tile.jpeg") {
+                Response response;
+                response.data = std::make_shared<std::string>(util::read_file("test/fixtures/image/tile.jpeg"));
+                return {std::move(response)};
+            }
+            return {};
+        };
+        test.map.getStyle().loadJSON(R"STYLE({ "version": 8, "sources": {}, "layers": [] })STYLE");
+        test.map.getStyle().addSource(std::make_unique<RasterSource>(
+            "raster", Tileset{{"asset://tile.jpeg"}}, 256, RasterOptions{.textureCompression = compression}));
+        auto layer = std::make_unique<RasterLayer>("raster", "raster");
+        layer->setRasterFadeDuration(0.0f);
+        test.map.getStyle().addLayer(std::move(layer));
+        return test.frontend.render(test.map);
+    };
+
+    {
+        MapTest<> test;
+        gfx::BackendScope scope{*test.frontend.getBackend()};
+        const auto supported = test.frontend.getBackend()->getContext().getTextureCompressionSupport();
+        if (!supported.etc2 && !supported.bc1) {
+            GTEST_SKIP() << "The renderer supports neither ETC2 nor BC1 textures";
+        }
+    }
+
+    const auto expected = render(Tileset::TextureCompression::None);
+    const auto actual = render(Tileset::TextureCompression::Automatic);
+
+    // Compressed tiles take a fraction of the texture memory
+    EXPECT_GT(expected.stats.textureUpdateBytes, actual.stats.textureUpdateBytes);
+
+    // And look the same, up to the loss of the block compression
+    ASSERT_EQ(expected.image.size, actual.image.size);
+    std::size_t difference = 0;
+    for (std::size_t i = 0; i < actual.image.bytes(); ++i) {
+        difference += std::abs(actual.image.data[i] - expected.image.data[i]);
+    }
+    EXPECT_GT(8.0, static_cast<double>(difference) / actual.image.bytes());
+}
+
+TEST(Map, RasterLayersShareStaticGeometry) {
+    const auto render = [](std::size_t layerCount) {
+        MapTest<> test;
+        test.fileSource->response = [](const Resource& res) -> std::optional<Response> {
+            if (res.url == "asset://tile.jpeg") {
+                Response response;
+                response.data = std::make_shared<std::string>(util::read_file("test/fixtures/image/tile.jpeg"));
+                return {std::move(response)};
+            }
+            return {};
+        };
+        test.map.getStyle().loadJSON(R"STYLE({
+            "version": 8,
+            "sources": {
+                "raster": { "type": "raster", "tiles": [ "asset://tile.jpeg" ], "tileSize": 256 }
+            },
+            "layers": []
+        })STYLE");
+        for (std::size_t i = 0; i < layerCount; ++i) {
+            auto layer = std::make_unique<RasterLayer>("raster-" + std::to_string(i), "raster");
+            layer->setRasterOpacity(0.5f);
+            layer->setRasterFadeDuration(0.0f);
+            test.map.getStyle().addLayer(std::move(layer));
+        }
+        return test.frontend.render(test.map).stats;
+    };
+
+    // Every raster layer draws the same quad for its tiles, from the same buffers
+    const auto single = render(1);
+    const auto multiple = render(4);
+    EXPECT_LT(0, single.numVertexBuffers);
+    EXPECT_EQ(single.numVertexBuffers, multiple.numVertexBuffers);
+    EXPECT_EQ(single.numIndexBuffers, multiple.numIndexBuffers);
+}
+
+TEST(Map, CullFillExtrusionsOutsideFrustum) {
+    // A single building, extruded 100m, seen from the south at the highest pitch
+    const auto render = [](const std::string& footprint) {
+        const std::string style = R"STYLE({
+            "version": 8,
+            "sources": {
+                "buildings": { "type": "geojson", "data": { "type": "Polygon", "coordinates": [ )STYLE" +
+                                  footprint + R"STYLE( ] } }
+            },
+            "layers": [
+                { "id": "background", "type": "background", "paint": { "background-color": "white" } },
+                {
+                    "id": "buildings",
+                    "type": "fill-extrusion",
+                    "source": "buildings",
+                    "paint": { "fill-extrusion-color": "black", "fill-extrusion-height": 100 }
+                }
+            ]
+        })STYLE";
+        MapTest<> test;
+        test.map.getStyle().loadJSON(style);
+        test.map.jumpTo(CameraOptions().withCenter(LatLng{-0.0005, 0.001}).withZoom(16).withPitch(60));
+        return test.frontend.render(test.map);
+    };
+
+    // Behind and below the camera, in a tile that's visible
+    const auto behind = render(
+        "[[0.0009, -0.0046], [0.0011, -0.0046], [0.0011, -0.0048], [0.0009, -0.0048], [0.0009, -0.0046]]");
+    EXPECT_LT(0, behind.stats.numCulledDrawables);
+
+    // Just below the bottom of the view, and tall enough to rise into it
+    const auto below = render(
+        "[[0.0009, -0.00243], [0.0011, -0.00243], [0.0011, -0.00265], [0.0009, -0.00265], [0.0009, -0.00243]]");
+    EXPECT_EQ(0, below.stats.numCulledDrawables);
+    const auto& image = below.image;
+    const auto bottomCenter = ((image.size.height - 1) * image.size.width + image.size.width / 2) * 4;
+    EXPECT_GT(128, image.data[bottomCenter]);
+}
+
+TEST(Map, ReduceMemoryUseClearsPools) {
+    MapTest<> test;
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/empty.json"));
+    test.frontend.render(test.map);
+
+    struct Vertex {
+        std::array<float, 4> data;
+    };
+    {
+        gfx::VertexVector<Vertex> vertices;
+        vertices.reserve(1024);
+    }
+    ASSERT_LT(0u, gfx::getVectorPoolStats().retainedBytes);
+
+    ImagePool::get().release(PremultipliedImage({256, 256}));
+    ASSERT_LT(0u, ImagePool::get().size());
+
+    test.frontend.getRenderer()->reduceMemoryUse();
+    EXPECT_EQ(0u, gfx::getVectorPoolStats().retainedBytes);
+    EXPECT_EQ(0u, ImagePool::get().size());
+}
+
 TEST(Map, ResourceError) {
     MapTest<> test;
     test.fileSource->glyphsResponse = [&](const Resource&) {
@@ -0,0 +1,82 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/context.hpp>
+#include <mbgl/gfx/drawable.hpp>
+#include <mbgl/gfx/drawable_builder.hpp>
+#include <mbgl/gfx/headless_backend.hpp>
+#include <mbgl/gfx/renderer_backend.hpp>
+#include <mbgl/renderer/layer_group.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace mbgl;
+
+namespace {
+
+class TileLayerGroupTest {
+public:
+    TileLayerGroupTest()
+        : backend(gfx::HeadlessBackend::Create()),
+          scope(*backend->getRendererBackend()),
+          context(backend->getRendererBackend()->getContext()),
+          layerGroup(context.createTileLayerGroup(0, 4, "test")) {}
+
+    // Add a drawable to the group, with the line width standing in for its state
+    gfx::Drawable* addDrawable(RenderPass pass, const OverscaledTileID& tileID, float lineWidth) {
+        auto builder = context.createDrawableBuilder("test");
+        builder->setRenderPass(pass);
+        builder->setLineWidth(lineWidth);
+        builder->addQuad(0, 0, 8, 8);
+        builder->flush(context);
+
+        auto drawables = builder->clearDrawables();
+        auto* drawable = drawables.front().get();
+        drawable->setTileID(tileID);
+        layerGroup->addDrawable(pass, tileID, std::move(drawables.front()));
+        return drawable;
+    }
+
+    std::unique_ptr<gfx::HeadlessBackend> backend;
+    gfx::BackendScope scope;
+    gfx::Context& context;
+    TileLayerGroupPtr layerGroup;
+};
+
+const OverscaledTileID tileA{1, 0, 0};
+const OverscaledTileID tileB{1, 1, 0};
+
+} // namespace
+
+TEST(TileLayerGroup, RegroupsOpaqueDrawables) {
+    TileLayerGroupTest test;
+    auto* fillA = test.addDrawable(RenderPass::Opaque, tileA, 1.0f);
+    auto* outlineA = test.addDrawable(RenderPass::Opaque, tileA, 2.0f);
+    auto* fillB = test.addDrawable(RenderPass::Opaque, tileB, 1.0f);
+    auto* outlineB = test.addDrawable(RenderPass::Opaque, tileB, 2.0f);
+
+    // Opaque drawables are depth tested, so those with the same state are drawn together
+    const auto& batches = test.layerGroup->batchDrawables(RenderPass::Opaque);
+    EXPECT_EQ(2u, batches.size());
+    EXPECT_EQ((std::vector<gfx::Drawable*>{fillA, fillB, outlineA, outlineB}),
+              test.layerGroup->getBatchedDrawables());
+}
+
+TEST(TileLayerGroup, KeepsTranslucentOrder) {
+    TileLayerGroupTest test;
+    auto* iconA = test.addDrawable(RenderPass::Translucent, tileA, 1.0f);
+    auto* textA = test.addDrawable(RenderPass::Translucent, tileA, 2.0f);
+    auto* iconB = test.addDrawable(RenderPass::Translucent, tileB, 1.0f);
+    auto* textB = test.addDrawable(RenderPass::Translucent, tileB, 2.0f);
+    auto* textC = test.addDrawable(RenderPass::Translucent, OverscaledTileID{1, 1, 1}, 2.0f);
+
+    // The text of one tile can be covered by the icons of the next one, so blended drawables are drawn in the same
+    // order as without batching, and only consecutive ones with the same state share a batch
+    const auto& batches = test.layerGroup->batchDrawables(RenderPass::Translucent);
+    EXPECT_EQ((std::vector<gfx::Drawable*>{iconA, textA, iconB, textB, textC}),
+              test.layerGroup->getBatchedDrawables());
+    ASSERT_EQ(4u, batches.size());
+    EXPECT_EQ(3u, batches.back().begin);
+    EXPECT_EQ(5u, batches.back().end);
+}
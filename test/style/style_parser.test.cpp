@@ -30,8 +30,10 @@ using Messages = std::vector<Message>;
 
 class StyleParserTest : public ::testing::TestWithParam<std::string> {};
 
-TEST_P(StyleParserTest, ParseStyle) {
-    const std::string base = std::string("test/fixtures/style_parser/") + GetParam();
+namespace {
+
+void checkStyleFixture(const std::string& name, bool streaming) {
+    const std::string base = std::string("test/fixtures/style_parser/") + name;
 
     using namespace std::string_literals;
     SCOPED_TRACE("Loading: "s + base);
@@ -44,7 +46,8 @@ TEST_P(StyleParserTest, ParseStyle) {
     ASSERT_TRUE(infoDoc.IsObject());
 
     style::Parser parser;
-    if (auto error = parser.parse(util::read_file(base + ".style.json"))) {
+    const auto json = util::read_file(base + ".style.json");
+    if (auto error = streaming ? parser.parseStreaming(json) : parser.parse(json)) {
         Log::Error(Event::ParseStyle, "Failed to parse style: " + util::toString(error));
     }
 
@@ -88,6 +91,16 @@ TEST_P(StyleParserTest, ParseStyle) {
     }
 }
 
+} // namespace
+
+TEST_P(StyleParserTest, ParseStyle) {
+    checkStyleFixture(GetParam(), false);
+}
+
+TEST_P(StyleParserTest, ParseStyleStreaming) {
+    checkStyleFixture(GetParam(), true);
+}
+
 static void populateNames(std::vector<std::string>& names) {
     const std::string ending = ".info.json";
 
@@ -315,3 +328,55 @@ TEST(StyleParser, ZoomCurve) {
     ASSERT_TRUE(expr2);
     ASSERT_TRUE(findZoomCurveChecked(*expr2).is<std::nullptr_t>());
 }
+
+TEST(StyleParser, StreamingMatchesDocument) {
+    const std::string json = R"({
+        "version": 8,
+        "name": "streaming",
+        "zoom": 3,
+        "sources": {
+            "points": {
+                "type": "geojson",
+                "data": { "type": "FeatureCollection", "features": [
+                    { "type": "Feature", "properties": { "a": [1, 2.5, true, null] },
+                      "geometry": { "type": "Point", "coordinates": [1, 2] } }
+                ] }
+            },
+            "vector": { "type": "vector", "tiles": ["https://example.com/{z}/{x}/{y}.pbf"] }
+        },
+        "layers": [
+            { "id": "forward", "ref": "base", "paint": { "circle-color": "red" } },
+            { "id": "base", "type": "circle", "source": "points" },
+            { "id": "backward", "ref": "base" },
+            { "id": "fill", "type": "fill", "source": "vector", "source-layer": "water" }
+        ],
+        "glyphs": "https://example.com/{fontstack}/{range}.pbf"
+    })";
+
+    style::Parser document;
+    ASSERT_FALSE(document.parse(json));
+    style::Parser streaming;
+    ASSERT_FALSE(streaming.parseStreaming(json));
+
+    EXPECT_EQ(document.name, streaming.name);
+    EXPECT_EQ(document.zoom, streaming.zoom);
+    EXPECT_EQ(document.glyphURL, streaming.glyphURL);
+
+    ASSERT_EQ(document.sources.size(), streaming.sources.size());
+    for (std::size_t i = 0; i < document.sources.size(); ++i) {
+        EXPECT_EQ(document.sources[i]->getID(), streaming.sources[i]->getID());
+        EXPECT_EQ(document.sources[i]->getType(), streaming.sources[i]->getType());
+    }
+
+    ASSERT_EQ(4u, streaming.layers.size());
+    ASSERT_EQ(document.layers.size(), streaming.layers.size());
+    for (std::size_t i = 0; i < document.layers.size(); ++i) {
+        EXPECT_EQ(document.layers[i]->getID(), streaming.layers[i]->getID());
+        EXPECT_EQ(document.layers[i]->getTypeInfo(), streaming.layers[i]->getTypeInfo());
+    }
+}
+
+TEST(StyleParser, StreamingErrors) {
+    EXPECT_TRUE(style::Parser().parseStreaming("[]"));
+    EXPECT_TRUE(style::Parser().parseStreaming(R"({ "version": 8, "layers": [ )"));
+}
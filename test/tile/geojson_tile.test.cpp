@@ -6,10 +6,18 @@
 
 #include <mbgl/annotation/annotation_manager.hpp>
 #include <mbgl/map/transform.hpp>
+#include <mbgl/gfx/vector_pool.hpp>
+#include <mbgl/renderer/buckets/fill_bucket.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/renderer/tile_render_data.hpp>
+#include <mbgl/style/conversion/filter.hpp>
+#include <mbgl/style/conversion/json.hpp>
 #include <mbgl/style/layers/circle_layer.hpp>
 #include <mbgl/style/layers/circle_layer_impl.hpp>
+#include <mbgl/style/layers/fill_layer.hpp>
+#include <mbgl/style/layers/fill_layer_impl.hpp>
+#include <mbgl/style/layers/fill_layer_properties.hpp>
 #include <mbgl/style/sources/geojson_source.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/text/glyph_manager.hpp>
@@ -146,3 +154,109 @@ TEST(GeoJSONTile, Issue9927) {
     ASSERT_TRUE(tile.isRenderable());
     ASSERT_TRUE(tile.layerPropertiesUpdated(layerProperties));
 }
+
+// Changing the filter of one layer must only re-parse that layer's layout group,
+// the buckets of the other groups are carried over.
+TEST(GeoJSONTile, ReuseUnchangedBuckets) {
+    GeoJSONTileTest test;
+
+    CircleLayer layerA("circleA", "source");
+    CircleLayer layerB("circleB", "source");
+
+    const auto parseFilter = [](const std::string& json) {
+        conversion::Error error;
+        auto filter = conversion::convertJSON<Filter>(json, error);
+        EXPECT_TRUE(bool(filter));
+        return *filter;
+    };
+    layerB.setFilter(parseFilter(R"(["==", "$type", "Point"])"));
+
+    mapbox::feature::feature_collection<int16_t> features;
+    features.push_back(mapbox::feature::feature<int16_t>{mapbox::geometry::point<int16_t>(0, 0)});
+    auto data = std::make_shared<FakeGeoJSONData>(std::move(features));
+    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, data);
+    StubTileObserver observer;
+    tile.setObserver(&observer);
+
+    const auto makeProperties = [](const CircleLayer& layer) -> Immutable<LayerProperties> {
+        return makeMutable<CircleLayerProperties>(staticImmutableCast<CircleLayer::Impl>(layer.baseImpl));
+    };
+    const auto propertiesA = makeProperties(layerA);
+    tile.setLayers({propertiesA, makeProperties(layerB)});
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+
+    EXPECT_EQ(2u, tile.getLayoutStats().builtBuckets);
+    EXPECT_EQ(0u, tile.getLayoutStats().reusedBuckets);
+    const Bucket* bucketA = tile.createRenderData()->getBucket(*layerA.baseImpl);
+    const Bucket* bucketB = tile.createRenderData()->getBucket(*layerB.baseImpl);
+    ASSERT_NE(nullptr, bucketA);
+    ASSERT_NE(nullptr, bucketB);
+
+    layerB.setFilter(parseFilter(R"(["!=", "$type", "Polygon"])"));
+    const auto propertiesB = makeProperties(layerB);
+    tile.setLayers({propertiesA, propertiesB});
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+
+    EXPECT_EQ(3u, tile.getLayoutStats().builtBuckets);
+    EXPECT_EQ(1u, tile.getLayoutStats().reusedBuckets);
+    EXPECT_EQ(bucketA, tile.createRenderData()->getBucket(*layerA.baseImpl));
+    EXPECT_NE(nullptr, tile.createRenderData()->getBucket(*propertiesB->baseImpl));
+
+    // New data invalidates everything
+    tile.updateData(data);
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+
+    EXPECT_EQ(5u, tile.getLayoutStats().builtBuckets);
+    EXPECT_EQ(1u, tile.getLayoutStats().reusedBuckets);
+}
+
+// A re-parse reserves the geometry sizes of the previous layout instead of growing the buffers as features are added
+TEST(GeoJSONTile, ReserveSizeOfPreviousLayout) {
+    GeoJSONTileTest test;
+
+    FillLayer layer("fill", "source");
+
+    mapbox::feature::feature_collection<int16_t> features;
+    for (int16_t i = 0; i < 3; ++i) {
+        const auto x = static_cast<int16_t>(i * 1000);
+        features.push_back(mapbox::feature::feature<int16_t>{mapbox::geometry::polygon<int16_t>{
+            {{x, 0}, {static_cast<int16_t>(x + 500), 0}, {static_cast<int16_t>(x + 500), 500}, {x, 500}, {x, 0}}}});
+    }
+    auto data = std::make_shared<FakeGeoJSONData>(std::move(features));
+    GeoJSONTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, data);
+    StubTileObserver observer;
+    tile.setObserver(&observer);
+
+    tile.setLayers({makeMutable<FillLayerProperties>(staticImmutableCast<FillLayer::Impl>(layer.baseImpl))});
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+
+    // Keep the first bucket, so that its storage doesn't go back to the pool
+    const auto firstData = tile.createRenderData();
+    const auto* first = static_cast<const FillBucket*>(firstData->getBucket(*layer.baseImpl));
+    ASSERT_NE(nullptr, first);
+    const auto vertices = first->vertices.elements();
+    const auto indexes = first->triangles.elements();
+    ASSERT_NE(vertices, first->vertices.vector().capacity());
+
+    gfx::clearVectorPools();
+    tile.updateData(data);
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+
+    const auto* second = static_cast<const FillBucket*>(tile.createRenderData()->getBucket(*layer.baseImpl));
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(first, second);
+    EXPECT_EQ(vertices, second->vertices.elements());
+    EXPECT_EQ(vertices, second->vertices.vector().capacity());
+    EXPECT_EQ(indexes, second->triangles.elements());
+    EXPECT_EQ(indexes, second->triangles.vector().capacity());
+}
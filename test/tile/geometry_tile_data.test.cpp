@@ -100,3 +100,34 @@ TEST(GeometryTileData, limitHoles3) {
     ASSERT_EQ(original.at(1), polygon.at(1));
     ASSERT_EQ(original.at(3), polygon.at(2));
 }
+
+TEST(GeometryTileData, simplifyLine) {
+    const GeometryCoordinates line{{0, 0}, {10, 1}, {20, -1}, {30, 0}, {30, 10}, {31, 20}, {30, 30}};
+
+    // Points within the tolerance of the simplified line are dropped, the end points are kept
+    const GeometryCoordinates simplified{{0, 0}, {30, 0}, {30, 30}};
+    ASSERT_EQ(simplifyLine(line, 2), simplified);
+
+    // A smaller tolerance keeps more of the detail
+    ASSERT_GT(simplifyLine(line, 0.5).size(), simplified.size());
+    ASSERT_EQ(simplifyLine(line, 0), line);
+}
+
+TEST(GeometryTileData, simplifyGeometry) {
+    const GeometryCollection polygon = {{{0, 0}, {0, 20}, {1, 40}, {40, 40}, {40, 0}, {0, 0}},
+                                        {{10, 10}, {11, 10}, {11, 11}, {10, 10}}};
+
+    GeometryCollection simplified = simplifyGeometry(polygon, FeatureType::Polygon, 2);
+    ASSERT_EQ(simplified.size(), 2u);
+
+    // The exterior ring loses its detail but keeps its winding
+    ASSERT_EQ(simplified[0], GeometryCoordinates({{0, 0}, {1, 40}, {40, 40}, {40, 0}, {0, 0}}));
+    ASSERT_EQ(_signedArea(simplified[0]) > 0, _signedArea(polygon[0]) > 0);
+
+    // The interior ring would collapse, so it's kept as is
+    ASSERT_EQ(simplified[1], polygon[1]);
+
+    // Points are never simplified
+    const GeometryCollection points = {{{0, 0}, {1, 0}, {2, 0}}};
+    ASSERT_EQ(simplifyGeometry(points, FeatureType::Point, 2), points);
+}
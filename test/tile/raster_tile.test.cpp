@@ -4,14 +4,22 @@
 #include <mbgl/tile/tile_loader_impl.hpp>
 
 #include <mbgl/style/style.hpp>
+#include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/map/transform.hpp>
 #include <mbgl/annotation/annotation_manager.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/renderer/tile_render_data.hpp>
+#include <mbgl/style/layers/raster_layer.hpp>
 #include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/gfx/backend_scope.hpp>
+#include <mbgl/gfx/context.hpp>
 #include <mbgl/gfx/dynamic_texture_atlas.hpp>
+#include <mbgl/gfx/headless_backend.hpp>
+#include <mbgl/gfx/renderer_backend.hpp>
+#include <mbgl/gfx/texture2d.hpp>
 
 using namespace mbgl;
 
@@ -95,3 +103,91 @@ TEST(RasterTile, onParsedEmpty) {
     EXPECT_TRUE(tile.isLoaded());
     EXPECT_TRUE(tile.isComplete());
 }
+
+TEST(RasterTile, onParsedReplacesPreview) {
+    RasterTileTest test;
+    RasterTile tile(OverscaledTileID(0, 0, 0), "testSource", test.tileParameters, test.tileset);
+    const style::RasterLayer layer("raster", "testSource");
+
+    tile.onPreview(std::make_shared<PremultipliedImage>(Size{64, 64}), 0);
+    EXPECT_TRUE(tile.isRenderable());
+    tile.setMask({CanonicalTileID(1, 0, 0)});
+
+    const auto previewData = tile.createRenderData();
+    const auto* preview = static_cast<const RasterBucket*>(previewData->getBucket(*layer.baseImpl));
+    ASSERT_NE(nullptr, preview);
+    EXPECT_EQ(Size(64, 64), preview->image->size);
+
+    tile.onParsed(std::make_unique<RasterBucket>(PremultipliedImage{{256, 256}}), 0);
+    EXPECT_TRUE(tile.isRenderable());
+    EXPECT_TRUE(tile.isComplete());
+
+    // The full image comes in a bucket of its own, so that render layers rebuild the drawables of the tile
+    const auto fullData = tile.createRenderData();
+    const auto* full = static_cast<const RasterBucket*>(fullData->getBucket(*layer.baseImpl));
+    ASSERT_NE(nullptr, full);
+    EXPECT_NE(preview->getID(), full->getID());
+    EXPECT_EQ(Size(256, 256), full->image->size);
+    EXPECT_TRUE(full->mask == TileMask{CanonicalTileID(1, 0, 0)});
+
+    // Later previews don't replace the full image
+    tile.onPreview(std::make_shared<PremultipliedImage>(Size{64, 64}), 0);
+    EXPECT_EQ(full, tile.createRenderData()->getBucket(*layer.baseImpl));
+}
+
+TEST(RasterTile, TimeToFirstPixel) {
+    RasterTileTest test;
+    RasterTile tile(OverscaledTileID(0, 0, 0), "testSource", test.tileParameters, test.tileset);
+    const auto before = getRasterTileStats();
+
+    tile.setData(std::make_shared<std::string>(util::read_file("test/fixtures/image/tile.jpeg")));
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+    ASSERT_TRUE(tile.isRenderable());
+    ASSERT_TRUE(tile.getTimeToFirstPixel());
+
+    const auto after = getRasterTileStats();
+    EXPECT_EQ(before.tiles + 1, after.tiles);
+    EXPECT_LE(before.previews, after.previews);
+    EXPECT_EQ(before.totalTimeToFirstPixel + *tile.getTimeToFirstPixel(), after.totalTimeToFirstPixel);
+    EXPECT_LE(*tile.getTimeToFirstPixel(), after.maxTimeToFirstPixel);
+}
+
+TEST(RasterTile, TextureCompression) {
+    auto backend = gfx::HeadlessBackend::Create();
+    gfx::BackendScope scope{*backend->getRendererBackend()};
+    auto& context = backend->getRendererBackend()->getContext();
+    const auto supported = context.getTextureCompressionSupport();
+    if (!supported.etc2 && !supported.bc1) {
+        GTEST_SKIP() << "The renderer supports neither ETC2 nor BC1 textures";
+    }
+    const auto format = supported.etc2 ? gfx::TexturePixelType::ETC2 : gfx::TexturePixelType::BC1;
+
+    RasterTileTest test;
+    test.tileset.textureCompression = Tileset::TextureCompression::Automatic;
+    test.tileParameters.textureCompressionSupport = supported;
+    RasterTile tile(OverscaledTileID(0, 0, 0), "testSource", test.tileParameters, test.tileset);
+    const style::RasterLayer layer("raster", "testSource");
+
+    tile.setData(std::make_shared<std::string>(util::read_file("test/fixtures/image/tile.jpeg")));
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+    ASSERT_TRUE(tile.isRenderable());
+
+    // The decoded image is compressed on the worker, in the best format of the renderer
+    const auto renderData = tile.createRenderData();
+    const auto* bucket = static_cast<const RasterBucket*>(renderData->getBucket(*layer.baseImpl));
+    ASSERT_NE(nullptr, bucket);
+    EXPECT_FALSE(bucket->image);
+    ASSERT_TRUE(bucket->compressedImage);
+    EXPECT_EQ(format, bucket->compressedImage->format);
+
+    // And uploaded as it is
+    auto texture = context.createTexture2D();
+    texture->setCompressedImage(bucket->compressedImage);
+    texture->upload();
+    EXPECT_EQ(format, texture->getFormat());
+    EXPECT_EQ(Size(256, 256), texture->getSize());
+}
@@ -152,3 +152,15 @@ TEST(BoundingVolumes, AabbIntersectsFrustumEdgeCase) {
     EXPECT_EQ(frustum.intersects(aabb), util::IntersectionResult::Intersects);
     EXPECT_EQ(frustum.intersectsPrecise(aabb), util::IntersectionResult::Separate);
 }
+
+TEST(BoundingVolumes, ElevatedAabbIntersectsFrustum) {
+    const util::Frustum frustum = createTestFrustum(pi / 2, 1.0, 0.1, 100.0, -5.0, 0.0);
+
+    // Boxes above the camera are behind it, even if their footprint is in view
+    EXPECT_EQ(frustum.intersects(util::AABB({-1, -1, 6}, {1, 1, 8})), util::IntersectionResult::Separate);
+    EXPECT_EQ(frustum.intersects(util::AABB({-1, -1, 0}, {1, 1, 8})), util::IntersectionResult::Intersects);
+    EXPECT_EQ(frustum.intersects(util::AABB({-1, -1, 0}, {1, 1, 3})), util::IntersectionResult::Contains);
+
+    // Boxes that rise from outside the view lean away from it
+    EXPECT_EQ(frustum.intersects(util::AABB({6, -1, 0}, {7, 1, 4})), util::IntersectionResult::Separate);
+}
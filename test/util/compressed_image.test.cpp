@@ -0,0 +1,142 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/compressed_image.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+using namespace mbgl;
+
+namespace {
+
+PremultipliedImage solidImage(Size size, uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255) {
+    PremultipliedImage image(size);
+    for (std::size_t i = 0; i < size.area(); i++) {
+        image.data[i * 4 + 0] = r;
+        image.data[i * 4 + 1] = g;
+        image.data[i * 4 + 2] = b;
+        image.data[i * 4 + 3] = a;
+    }
+    return image;
+}
+
+void writeUInt32(std::string& data, std::size_t offset, uint32_t value) {
+    for (std::size_t i = 0; i < 4; i++) {
+        data[offset + i] = static_cast<char>(value >> (8 * i));
+    }
+}
+
+std::string ktx2(uint32_t vkFormat, Size size, uint32_t supercompression = 0) {
+    const uint32_t dataOffset = 104;
+    const uint32_t dataSize = static_cast<uint32_t>(compressedDataSize(gfx::TexturePixelType::BC1, size));
+    std::string data(dataOffset + dataSize, '\0');
+    const char identifier[] = {'\xAB', 'K', 'T', 'X', ' ', '2', '0', '\xBB', '\r', '\n', '\x1A', '\n'};
+    data.replace(0, sizeof(identifier), identifier, sizeof(identifier));
+    writeUInt32(data, 12, vkFormat);
+    writeUInt32(data, 20, size.width);
+    writeUInt32(data, 24, size.height);
+    writeUInt32(data, 36, 1);
+    writeUInt32(data, 40, 1);
+    writeUInt32(data, 44, supercompression);
+    writeUInt32(data, 80, dataOffset);
+    writeUInt32(data, 88, dataSize);
+    for (uint32_t i = 0; i < dataSize; i++) {
+        data[dataOffset + i] = static_cast<char>(i);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST(CompressedImage, DataSize) {
+    EXPECT_EQ(8u, compressedDataSize(gfx::TexturePixelType::BC1, {4, 4}));
+    EXPECT_EQ(8u * 64 * 64, compressedDataSize(gfx::TexturePixelType::ETC2, {256, 256}));
+    EXPECT_EQ(16u * 4, compressedDataSize(gfx::TexturePixelType::ASTC, {5, 5}));
+    EXPECT_EQ(0u, compressedDataSize(gfx::TexturePixelType::RGBA, {4, 4}));
+}
+
+TEST(CompressedImage, SkipsTransparentImages) {
+    EXPECT_FALSE(compressImage(solidImage({8, 8}, 10, 20, 30, 128), gfx::TexturePixelType::BC1).valid());
+    EXPECT_FALSE(compressImage(solidImage({8, 8}, 10, 20, 30), gfx::TexturePixelType::ASTC).valid());
+}
+
+TEST(CompressedImage, BC1SolidColor) {
+    const auto compressed = compressImage(solidImage({6, 6}, 255, 0, 0), gfx::TexturePixelType::BC1);
+    ASSERT_TRUE(compressed.valid());
+    ASSERT_EQ(32u, compressed.bytes());
+    for (std::size_t block = 0; block < 4; block++) {
+        const uint8_t* data = compressed.data.get() + block * 8;
+        // Both endpoints are pure red in RGB565 and every pixel uses the first one
+        EXPECT_EQ(0x00, data[0]);
+        EXPECT_EQ(0xF8, data[1]);
+        EXPECT_EQ(0x00, data[2]);
+        EXPECT_EQ(0xF8, data[3]);
+        for (std::size_t i = 4; i < 8; i++) {
+            EXPECT_EQ(0, data[i]);
+        }
+    }
+}
+
+TEST(CompressedImage, ETC2SolidColor) {
+    const auto compressed = compressImage(solidImage({4, 4}, 200, 100, 50), gfx::TexturePixelType::ETC2);
+    ASSERT_TRUE(compressed.valid());
+    ASSERT_EQ(8u, compressed.bytes());
+    const uint8_t* data = compressed.data.get();
+
+    // Differential mode, with the same base color for both half blocks
+    EXPECT_TRUE(data[3] & 2);
+    for (std::size_t c = 0; c < 3; c++) {
+        EXPECT_EQ(0, data[c] & 0x7);
+    }
+
+    // Every pixel decodes to within a modifier step of the source color
+    const int table = data[3] >> 5;
+    const int modifiers[8][2] = {{2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}};
+    const uint32_t bits = (data[4] << 24) | (data[5] << 16) | (data[6] << 8) | data[7];
+    const int source[3] = {200, 100, 50};
+    for (uint32_t i = 0; i < 16; i++) {
+        const int index = (((bits >> (16 + i)) & 1) << 1) | ((bits >> i) & 1);
+        const int modifier = (index & 2) ? -modifiers[table][index & 1] : modifiers[table][index & 1];
+        for (std::size_t c = 0; c < 3; c++) {
+            const int base5 = data[c] >> 3;
+            const int decoded = std::clamp(((base5 << 3) | (base5 >> 2)) + modifier, 0, 255);
+            EXPECT_LE(std::abs(decoded - source[c]), 4);
+        }
+    }
+}
+
+TEST(CompressedImage, KTX2) {
+    const auto data = ktx2(133, {8, 8});
+    EXPECT_TRUE(isKTX2(data));
+    EXPECT_FALSE(isKTX2("\x89PNG\r\n\x1A\n"));
+
+    const auto image = decodeKTX2(data);
+    ASSERT_TRUE(image.valid());
+    EXPECT_EQ(gfx::TexturePixelType::BC1, image.format);
+    EXPECT_EQ(Size(8, 8), image.size);
+    ASSERT_EQ(32u, image.bytes());
+    for (uint32_t i = 0; i < image.bytes(); i++) {
+        EXPECT_EQ(i, image.data[i]);
+    }
+
+    // Uncompressed formats, supercompression and truncated data are rejected
+    EXPECT_THROW(decodeKTX2(ktx2(37, {8, 8})), std::runtime_error);
+    EXPECT_THROW(decodeKTX2(ktx2(133, {8, 8}, 1)), std::runtime_error);
+    EXPECT_THROW(decodeKTX2(data.substr(0, data.size() - 1)), std::runtime_error);
+}
+
+TEST(CompressedImage, KTX2RejectsBogusSizes) {
+    // A small container claiming a 65536x65536 ETC2 texture is rejected without allocating it
+    auto huge = ktx2(147, {8, 8});
+    writeUInt32(huge, 20, 65536);
+    writeUInt32(huge, 24, 65536);
+    EXPECT_THROW(decodeKTX2(huge), std::runtime_error);
+
+    // A width that would wrap the block count around to zero doesn't pass for an empty level
+    auto wrapped = ktx2(147, {8, 8});
+    writeUInt32(wrapped, 20, 0xFFFFFFFD);
+    writeUInt32(wrapped, 88, 0);
+    EXPECT_THROW(decodeKTX2(wrapped), std::runtime_error);
+    EXPECT_LT(0u, compressedDataSize(gfx::TexturePixelType::ETC2, {0xFFFFFFFD, 8}));
+}
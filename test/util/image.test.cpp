@@ -2,6 +2,7 @@
 
 #include <mbgl/util/premultiply.hpp>
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_pool.hpp>
 #include <mbgl/util/io.hpp>
 
 using namespace mbgl;
@@ -78,6 +79,35 @@ TEST(Image, JPEGTile) {
     EXPECT_EQ(256u, image.size.height);
 }
 
+TEST(Image, JPEGTileAllocator) {
+    std::size_t allocations = 0;
+    PremultipliedImage image = decodeImage(util::read_file("test/fixtures/image/tile.jpeg"), [&](Size size) {
+        allocations++;
+        return PremultipliedImage(size);
+    });
+    EXPECT_EQ(256u, image.size.width);
+    EXPECT_EQ(256u, image.size.height);
+#if !defined(__APPLE__) && !defined(__ANDROID__) && !defined(__QT__)
+    EXPECT_EQ(1u, allocations);
+#endif
+}
+
+#if !defined(__APPLE__) && !defined(__ANDROID__) && !defined(__QT__)
+TEST(Image, JPEGTilePreview) {
+    const auto data = util::read_file("test/fixtures/image/tile.jpeg");
+    const auto allocate = [](Size size) {
+        return PremultipliedImage(size);
+    };
+
+    PremultipliedImage preview = decodeImagePreview(data, 4, allocate);
+    EXPECT_EQ(64u, preview.size.width);
+    EXPECT_EQ(64u, preview.size.height);
+
+    // Only JPEG can be decoded at a reduced size
+    EXPECT_FALSE(decodeImagePreview(util::read_file("test/fixtures/image/tile.png"), 4, allocate).valid());
+}
+#endif
+
 #if !defined(__QT__) // WebP support is not enabled in Qt by default
 TEST(Image, WebPTile) {
     PremultipliedImage image = decodeImage(util::read_file("test/fixtures/image/tile.webp"));
@@ -163,3 +193,37 @@ TEST(Image, Premultiply) {
     EXPECT_EQ(0u, rgba.size.width);
     EXPECT_EQ(0u, rgba.size.height);
 }
+
+TEST(Image, Pool) {
+    auto& pool = ImagePool::get();
+    pool.clear();
+
+    PremultipliedImage image = pool.acquire({256, 256});
+    EXPECT_EQ(256u, image.size.width);
+    const auto* storage = image.data.get();
+
+    pool.release(std::move(image));
+    EXPECT_EQ(1u, pool.size());
+    EXPECT_FALSE(image.valid());
+
+    // Storage of the same byte size is reused, whatever its dimensions
+    PremultipliedImage reused = pool.acquire({512, 128});
+    EXPECT_EQ(storage, reused.data.get());
+    EXPECT_EQ(512u, reused.size.width);
+    EXPECT_EQ(0u, pool.size());
+
+    // Shared images return their storage once the last reference is gone
+    auto shared = pool.share(std::move(reused));
+    auto copy = shared;
+    shared.reset();
+    EXPECT_EQ(0u, pool.size());
+    copy.reset();
+    EXPECT_EQ(1u, pool.size());
+
+    PremultipliedImage other = pool.acquire({16, 16});
+    EXPECT_NE(storage, other.data.get());
+    EXPECT_EQ(1u, pool.size());
+
+    pool.clear();
+    EXPECT_EQ(0u, pool.size());
+}
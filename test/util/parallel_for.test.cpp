@@ -0,0 +1,51 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/actor/scheduler.hpp>
+#include <mbgl/util/parallel_for.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace mbgl;
+
+TEST(ParallelFor, CoversRange) {
+    TaggedScheduler pool{Scheduler::GetBackground(), {}};
+
+    std::vector<std::atomic<int>> visits(1000);
+    util::parallelFor(pool, visits.size(), 7, [&](std::size_t begin, std::size_t end) {
+        EXPECT_LE(end - begin, 7u);
+        for (auto i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+
+    for (const auto& visit : visits) {
+        EXPECT_EQ(1, visit.load());
+    }
+}
+
+TEST(ParallelFor, Nested) {
+    TaggedScheduler pool{Scheduler::GetBackground(), {}};
+
+    // Ranges running on the pool can split their work over the same pool
+    std::atomic<std::size_t> total{0};
+    util::parallelFor(pool, 16, 1, [&](std::size_t, std::size_t) {
+        util::parallelFor(pool, 100, 10, [&](std::size_t begin, std::size_t end) { total += end - begin; });
+    });
+    EXPECT_EQ(1600u, total.load());
+}
+
+TEST(ParallelFor, Exception) {
+    TaggedScheduler pool{Scheduler::GetBackground(), {}};
+
+    EXPECT_THROW(util::parallelFor(pool,
+                                   100,
+                                   10,
+                                   [](std::size_t begin, std::size_t) {
+                                       if (begin == 50) {
+                                           throw std::runtime_error("range failed");
+                                       }
+                                   }),
+                 std::runtime_error);
+}
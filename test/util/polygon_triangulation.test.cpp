@@ -0,0 +1,94 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/gfx/polygon_triangulation.hpp>
+
+#include <algorithm>
+#include <utility>
+
+using namespace mbgl;
+using namespace mbgl::gfx;
+
+namespace {
+
+GeometryCoordinates square(int16_t x, int16_t y, int16_t size, bool clockwise) {
+    GeometryCoordinates ring{{x, y}, {x, static_cast<int16_t>(y + size)},
+                             {static_cast<int16_t>(x + size), static_cast<int16_t>(y + size)},
+                             {static_cast<int16_t>(x + size), y}};
+    if (!clockwise) {
+        std::reverse(ring.begin(), ring.end());
+    }
+    return ring;
+}
+
+// A grid of square holes in a square outer ring
+GeometryCollection gridPolygon(int16_t holesPerSide) {
+    GeometryCollection polygon;
+    polygon.push_back(square(0, 0, static_cast<int16_t>(holesPerSide * 20 + 10), false));
+    for (int16_t i = 0; i < holesPerSide; ++i) {
+        for (int16_t j = 0; j < holesPerSide; ++j) {
+            polygon.push_back(square(static_cast<int16_t>(10 + i * 20), static_cast<int16_t>(10 + j * 20), 10, true));
+        }
+    }
+    return polygon;
+}
+
+// Sum of the triangle areas, and whether they all wind the same way as earcut's output
+std::pair<int64_t, bool> triangulatedArea(const GeometryCollection& polygon, const std::vector<uint32_t>& indices) {
+    std::vector<GeometryCoordinate> vertices;
+    for (const auto& ring : polygon) {
+        vertices.insert(vertices.end(), ring.begin(), ring.end());
+    }
+    int64_t area = 0;
+    bool wound = true;
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const auto& a = vertices[indices[i]];
+        const auto& b = vertices[indices[i + 1]];
+        const auto& c = vertices[indices[i + 2]];
+        const int64_t cross = int64_t(b.x - a.x) * (c.y - a.y) - int64_t(b.y - a.y) * (c.x - a.x);
+        wound = wound && cross > 0;
+        area += cross;
+    }
+    return {area / 2, wound};
+}
+
+} // namespace
+
+TEST(PolygonTriangulation, Strategy) {
+    EXPECT_EQ(TriangulationStrategy::Fan, selectTriangulationStrategy({square(0, 0, 10, true)}));
+
+    // Concave
+    EXPECT_EQ(TriangulationStrategy::Earcut,
+              selectTriangulationStrategy({{{0, 0}, {10, 0}, {5, 2}, {10, 10}, {0, 10}}}));
+
+    // Few holes
+    EXPECT_EQ(TriangulationStrategy::Earcut, selectTriangulationStrategy(gridPolygon(2)));
+
+    // Many holes
+    EXPECT_EQ(TriangulationStrategy::Monotone, selectTriangulationStrategy(gridPolygon(5)));
+}
+
+TEST(PolygonTriangulation, Fan) {
+    // Convex, with a collinear point on one edge
+    const GeometryCollection polygon{{{0, 0}, {5, 0}, {10, 0}, {12, 8}, {4, 12}}};
+    ASSERT_EQ(TriangulationStrategy::Fan, selectTriangulationStrategy(polygon));
+
+    const auto indices = triangulatePolygon(polygon);
+    EXPECT_EQ(0u, indices.size() % 3);
+    const auto [area, wound] = triangulatedArea(polygon, indices);
+    EXPECT_EQ(96, area);
+    EXPECT_TRUE(wound);
+}
+
+TEST(PolygonTriangulation, Monotone) {
+    const auto polygon = gridPolygon(8);
+    ASSERT_EQ(TriangulationStrategy::Monotone, selectTriangulationStrategy(polygon));
+
+    const auto indices = triangulatePolygon(polygon);
+    const auto [area, wound] = triangulatedArea(polygon, indices);
+    EXPECT_EQ(170 * 170 - 64 * 100, area);
+    EXPECT_TRUE(wound);
+
+    // Same coverage as earcut
+    const auto earcut = triangulatePolygon(polygon, TriangulationStrategy::Earcut);
+    EXPECT_EQ(triangulatedArea(polygon, earcut).first, area);
+}